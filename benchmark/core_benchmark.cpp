@@ -0,0 +1,428 @@
+// Measures the YimMenuCore hot paths on synthetic data, so they can be compared between changes without the game.
+// usage: YimMenuBenchmark [filter], only benchmarks whose name contains filter are run
+#include "file_manager/file.hpp"
+#include "gta/joaat.hpp"
+#include "lua/subscriber_table.hpp"
+#include "memory/pattern.hpp"
+#include "memory/range.hpp"
+#include "services/custom_text/label_filter.hpp"
+#include "services/gta_data/cache_file.hpp"
+#include "services/players/player_slots.hpp"
+#include "services/players/rate_limiter.hpp"
+#include "util/sync_node_lookup.hpp"
+
+// the invoker is written against the Windows headers (FORCEINLINE, __declspec)
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include "invoker/native_batch.hpp"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	// keeps the compiler from dropping the measured work
+	volatile std::uint64_t sink;
+
+	const char* filter = nullptr;
+
+	template<typename F>
+	void run(const char* name, std::size_t iterations, F&& func)
+	{
+		if (filter && !std::strstr(name, filter))
+			return;
+
+		func(); // warm up
+
+		const auto start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < iterations; i++)
+			func();
+		const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+		std::printf("%-32s %14.1f ns/op %10zu iterations\n", name, elapsed / iterations, iterations);
+	}
+
+	// xorshift, the data has to be the same on every run
+	std::uint64_t next_random(std::uint64_t& state)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+
+	// random bytes with the signature planted near the end, so the scan has to cover most of the image
+	std::vector<std::uint8_t> make_module_image(std::size_t size, const std::vector<std::uint8_t>& signature)
+	{
+		std::vector<std::uint8_t> image(size);
+
+		std::uint64_t state = 0x9E3779B97F4A7C15;
+		for (auto& byte : image)
+			byte = static_cast<std::uint8_t>(next_random(state));
+
+		std::memcpy(image.data() + size - size / 8, signature.data(), signature.size());
+		return image;
+	}
+
+	std::vector<std::string> make_names(std::size_t count)
+	{
+		std::vector<std::string> names;
+		names.reserve(count);
+
+		std::uint64_t state = 0xD1B54A32D192ED03;
+		for (std::size_t i = 0; i < count; i++)
+			names.push_back("prop_model_" + std::to_string(next_random(state) % 1000000));
+
+		return names;
+	}
+
+	// label names laid out back to back like the game's string table, every 10th one is customized
+	struct label_table
+	{
+		std::vector<char> m_text;
+		std::vector<const char*> m_labels;
+		std::map<rage::joaat_t, const char*> m_overwrites;
+	};
+
+	label_table make_labels(const std::vector<std::string>& names, std::size_t count)
+	{
+		label_table table;
+		for (std::size_t i = 0; i < count; i++)
+			table.m_text.insert(table.m_text.end(), names[i].c_str(), names[i].c_str() + names[i].size() + 1);
+
+		for (std::size_t i = 0, offset = 0; i < count; offset += names[i++].size() + 1)
+		{
+			table.m_labels.push_back(table.m_text.data() + offset);
+			if (i % 10 == 0)
+				table.m_overwrites.emplace(rage::constexpr_joaat(names[i]), "overwritten");
+		}
+
+		return table;
+	}
+
+	// what custom_text_service::get_text does, with an overwrite map in place of the callbacks
+	const char* get_label_text(const big::label_filter& filter, const label_table& table, const char* label)
+	{
+		const auto tag = filter.tag(label);
+		if (filter.is_memoized_miss(label, tag))
+			return nullptr;
+
+		const auto hash = rage::constexpr_joaat(label);
+		if (filter.may_be_customized(hash))
+			if (const auto it = table.m_overwrites.find(hash); it != table.m_overwrites.end())
+				return it->second;
+
+		filter.memoize_miss(label, tag);
+		return nullptr;
+	}
+
+	// a lua_module as far as dispatch is concerned, its state lock and its callbacks by event
+	struct fake_module
+	{
+		std::mutex m_state_lock;
+		std::unordered_map<int, std::vector<std::function<int(int)>>> m_event_callbacks;
+	};
+
+	// what lua_module_snapshot holds for events
+	struct fake_snapshot
+	{
+		std::vector<std::shared_ptr<fake_module>> m_modules;
+		big::subscriber_table<int, fake_module> m_event_subscribers;
+	};
+
+	// every module subscribes to the same few events out of many, like most scripts only listen to a handful
+	std::shared_ptr<const fake_snapshot> make_lua_snapshot(std::size_t module_count, int event_count)
+	{
+		auto snapshot = std::make_shared<fake_snapshot>();
+
+		std::uint64_t state = 0x2545F4914F6CDD1D;
+		for (std::size_t i = 0; i < module_count; i++)
+		{
+			auto module = std::make_shared<fake_module>();
+			for (int j = 0; j < 2; j++)
+				module->m_event_callbacks[static_cast<int>(next_random(state) % (event_count / 4))].push_back([](int arg) {
+					return arg + 1;
+				});
+
+			for (const auto& [event, callbacks] : module->m_event_callbacks)
+				snapshot->m_event_subscribers.add(event, module.get());
+			snapshot->m_modules.push_back(std::move(module));
+		}
+
+		return snapshot;
+	}
+
+	// the part of a player the lookups read, the real one reads it from CNetGamePlayer
+	struct fake_player
+	{
+		std::uint32_t m_msg_id;
+	};
+
+	// vftable addresses spread like the game's sync nodes, 8 byte aligned in one image
+	big::sync_node_vft_to_ids make_sync_nodes(std::size_t count)
+	{
+		big::sync_node_vft_to_ids nodes;
+		nodes.reserve(count);
+
+		std::uint64_t state = 0x94D049BB133111EB;
+		for (std::size_t i = 0; i < count; i++)
+			nodes.emplace_back(0x7FF700000000 + (next_random(state) % 0x4000000 & ~7ull), big::sync_node_id("CSectorDataNode"));
+
+		nodes.freeze();
+		return nodes;
+	}
+
+#ifdef _WIN32
+	// stands in for a game native, adds up its first two arguments
+	void fake_native(rage::scrNativeCallContext* context)
+	{
+		context->set_return_value<int>(context->get_arg<int>(0) + context->get_arg<int>(1));
+	}
+#endif
+}
+
+#ifdef _WIN32
+// the handlers normally come from the game's registration table, every native is the fake one here
+void big::native_invoker::cache_handlers()
+{
+	std::fill(std::begin(m_handlers), std::end(m_handlers), fake_native);
+	m_are_handlers_cached = true;
+}
+
+// the fake native doesn't return vectors
+void big::native_batch_context::fix_vectors()
+{
+}
+#endif
+
+int main(int argc, char** argv)
+{
+	if (argc > 1)
+		filter = argv[1];
+
+	constexpr auto ida_signature = "48 8B 05 ? ? ? ? 48 85 C0 74 ? 8B 48 ? E8";
+	const std::vector<std::uint8_t> planted{0x48, 0x8B, 0x05, 0x11, 0x22, 0x33, 0x44, 0x48, 0x85, 0xC0, 0x74, 0x10, 0x8B, 0x48, 0x08, 0xE8};
+
+	auto image = make_module_image(64 * 1024 * 1024, planted);
+	const memory::range module(image.data(), image.size());
+	const memory::pattern pattern(ida_signature);
+
+	run("pattern/parse", 100000, [&] {
+		sink = memory::pattern(ida_signature).m_bytes.size();
+	});
+
+	run("range/scan 64MB", 20, [&] {
+		sink = module.scan(pattern)->as<std::uintptr_t>();
+	});
+
+	run("range/scan_all 64MB", 20, [&] {
+		sink = module.scan_all(pattern).size();
+	});
+
+	const auto names = make_names(100000);
+	run("joaat/100k names", 100, [&] {
+		std::uint64_t sum = 0;
+		for (const auto& name : names)
+			sum += rage::constexpr_joaat(name);
+		sink = sum;
+	});
+
+	big::rate_limiter limiter(std::chrono::seconds(1), 5);
+	run("rate_limiter/process", 1000000, [&] {
+		sink = limiter.process();
+	});
+
+#ifdef _WIN32
+	constexpr int native_calls = 32;
+	run("native/invoke x32", 100000, [&] {
+		std::uint64_t sum = 0;
+		for (int i = 0; i < native_calls; i++)
+			sum += big::native_invoker::invoke<0, false, int>(i, 1);
+		sink = sum;
+	});
+
+	run("native/batch x32", 100000, [&] {
+		int results[native_calls];
+		{
+			big::native_batch<native_calls> batch;
+			for (int i = 0; i < native_calls; i++)
+				batch.add_with_result<0>(&results[i], i, 1);
+		}
+
+		std::uint64_t sum = 0;
+		for (int result : results)
+			sum += result;
+		sink = sum;
+	});
+#endif
+
+	// about as many nodes as all sync trees together, hit in random order like a busy session would
+	const auto sync_nodes = make_sync_nodes(128);
+	const std::unordered_map<std::uint64_t, big::sync_node_id> sync_node_map(sync_nodes.begin(), sync_nodes.end()); // what find() used before
+	std::vector<std::uint64_t> sync_node_queries;
+	std::uint64_t query_state = 0xBF58476D1CE4E5B9;
+	for (int i = 0; i < 1024; i++)
+		sync_node_queries.push_back(sync_nodes.begin()[next_random(query_state) % sync_nodes.size()].first);
+
+	run("sync_node/find x1024", 10000, [&] {
+		std::uint64_t sum = 0;
+		for (const auto addr : sync_node_queries)
+			sum += sync_nodes.find(addr);
+		sink = sum;
+	});
+
+	run("sync_node/unordered_map x1024", 10000, [&] {
+		std::uint64_t sum = 0;
+		for (const auto addr : sync_node_queries)
+			sum += sync_node_map.find(addr)->second;
+		sink = sum;
+	});
+
+	// the labels a menu resolves every frame: a hot set that fits the miss memo, or spread over the table
+	// with no customized label or with every 10th one customized
+	const auto labels = make_labels(names, 2000);
+	big::label_filter label_filter;
+	label_filter.add_read_only_range(reinterpret_cast<std::uintptr_t>(labels.m_text.data()),
+	    reinterpret_cast<std::uintptr_t>(labels.m_text.data() + labels.m_text.size()));
+	label_filter.rebuild(labels.m_overwrites);
+
+	std::vector<const char*> label_hot, label_misses, label_mixed;
+	for (int i = 0; i < 1024; i++)
+	{
+		const auto index = next_random(query_state) % labels.m_labels.size();
+		label_hot.push_back(labels.m_labels[index % 64 * 10 + 1]);
+		label_misses.push_back(labels.m_labels[index % 10 ? index : index + 1]);
+		label_mixed.push_back(labels.m_labels[index]);
+	}
+
+	for (const auto& [name, queries] : {std::pair{"label/filter hot x1024", &label_hot},
+	         std::pair{"label/filter 0% hits x1024", &label_misses},
+	         std::pair{"label/filter 10% hits x1024", &label_mixed}})
+		run(name, 10000, [&] {
+			std::uint64_t sum = 0;
+			for (const auto label : *queries)
+				sum += get_label_text(label_filter, labels, label) != nullptr;
+			sink = sum;
+		});
+
+	// what get_text did before the filter, hash every label and probe the map
+	for (const auto& [name, queries] : {std::pair{"label/map hot x1024", &label_hot},
+	         std::pair{"label/map 0% hits x1024", &label_misses},
+	         std::pair{"label/map 10% hits x1024", &label_mixed}})
+		run(name, 10000, [&] {
+			std::uint64_t sum = 0;
+			for (const auto label : *queries)
+				sum += labels.m_overwrites.contains(rage::constexpr_joaat(label));
+			sink = sum;
+		});
+
+	// events fired from the network hooks with 64 scripts loaded, a quarter of the events have subscribers
+	constexpr int lua_event_count = 64;
+	std::atomic<std::shared_ptr<const fake_snapshot>> lua_snapshot = make_lua_snapshot(64, lua_event_count);
+	std::vector<int> lua_events;
+	for (int i = 0; i < 1024; i++)
+		lua_events.push_back(static_cast<int>(next_random(query_state) % lua_event_count));
+
+	run("lua_dispatch/subscribers x1024", 1000, [&] {
+		std::uint64_t sum = 0;
+		for (const auto event : lua_events)
+		{
+			const auto snapshot = lua_snapshot.load();
+			for (const auto module : snapshot->m_event_subscribers.find(event))
+			{
+				std::lock_guard guard(module->m_state_lock);
+				if (const auto it = module->m_event_callbacks.find(event); it != module->m_event_callbacks.end())
+					for (const auto& cb : it->second)
+						sum += cb(event);
+			}
+		}
+		sink = sum;
+	});
+
+	// what trigger_event did before the subscriber lists, lock and probe every module
+	run("lua_dispatch/all modules x1024", 1000, [&] {
+		std::uint64_t sum = 0;
+		for (const auto event : lua_events)
+		{
+			const auto snapshot = lua_snapshot.load();
+			for (const auto& module : snapshot->m_modules)
+			{
+				std::lock_guard guard(module->m_state_lock);
+				if (const auto it = module->m_event_callbacks.find(event); it != module->m_event_callbacks.end())
+					for (const auto& cb : it->second)
+						sum += cb(event);
+			}
+		}
+		sink = sum;
+	});
+
+	// a full session, looked up by msg id like the network hooks do for every received event
+	constexpr std::size_t session_size = 32;
+	big::player_slots<fake_player, session_size> player_slots;
+	std::array<std::uint32_t, session_size> player_msg_ids{};
+	std::multimap<std::string, std::shared_ptr<fake_player>> player_map; // what the lookups walked before
+	for (std::uint32_t id = 0; id < session_size; id++)
+	{
+		auto plyr = std::make_shared<fake_player>(fake_player{id * 7 + 3});
+		player_slots.set(id, plyr);
+		player_msg_ids[id] = plyr->m_msg_id;
+		player_map.emplace(names[id], std::move(plyr));
+	}
+	std::vector<std::uint32_t> player_queries;
+	for (int i = 0; i < 1024; i++)
+		player_queries.push_back(static_cast<std::uint32_t>(next_random(query_state) % session_size) * 7 + 3);
+
+	run("player_slots/find x1024", 10000, [&] {
+		std::uint64_t sum = 0;
+		for (const auto msg_id : player_queries)
+			sum += player_slots.find(player_msg_ids, msg_id, [](const fake_player& plyr) {
+				return plyr.m_msg_id;
+			})->m_msg_id;
+		sink = sum;
+	});
+
+	run("player_map/walk x1024", 10000, [&] {
+		std::uint64_t sum = 0;
+		for (const auto msg_id : player_queries)
+			for (const auto& [_, plyr] : player_map)
+				if (plyr->m_msg_id == msg_id)
+				{
+					sum += plyr->m_msg_id;
+					break;
+				}
+		sink = sum;
+	});
+
+	const auto cache_path = std::filesystem::temp_directory_path() / "yimmenu_benchmark.bin";
+	constexpr std::uint64_t cache_size = 16 * 1024 * 1024;
+	run("cache_file/write+load 16MB", 20, [&] {
+		big::cache_file writer(big::file(cache_path), 1);
+		writer.set_data(std::make_unique<std::uint8_t[]>(cache_size), cache_size);
+		writer.set_header_version(1);
+		writer.write();
+
+		big::cache_file reader(big::file(cache_path), 1);
+		reader.load();
+		sink = reader.up_to_date(1) ? reader.data_size() : 0;
+	});
+
+	std::error_code ec;
+	std::filesystem::remove(cache_path, ec);
+
+	return 0;
+}
@@ -81,6 +81,8 @@ def write_crossmap_header():
         open("crossmap.hpp", "w+").write(f"""#pragma once
 #include <script/scrNativeHandler.hpp>
 
+#include <array>
+
 namespace big
 {{
 	constexpr std::array<rage::scrNativeHash, {len(crossmap_hash_list)}> g_crossmap = {{{",".join([f"0x{x:X}" for x in crossmap_hash_list])}}};
@@ -10,6 +10,7 @@
 #include "services/ped_animations/ped_animations_service.hpp"
 #include "services/script_connection/script_connection_service.hpp"
 #include "services/squad_spawner/squad_spawner.hpp"
+#include "services/streaming/model_streaming_service.hpp"
 #include "services/tunables/tunables_service.hpp"
 #include "services/vehicle/vehicle_control_service.hpp"
 #include "services/vehicle/xml_vehicles_service.hpp"
@@ -38,12 +39,13 @@ namespace big
 			looped::system_spoofing();
 			looped::system_mission_creator();
 
-			for (auto command : g_looped_commands)
-				if (command->is_enabled())
-					command->on_tick();
+			g_looped_command_dispatcher.tick();
+			g_model_streaming_service.tick();
 
 			script::get_current()->yield();
 		}
+
+		g_model_streaming_service.release_all();
 	}
 
 	void backend::self_loop()
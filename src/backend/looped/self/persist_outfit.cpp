@@ -8,6 +8,8 @@
 
 namespace big
 {
+	static tunable<BOOL> disable_clothing_save_slot_validation{"DISABLE_CLOTHING_SAVE_SLOT_VALIDATION"_J};
+
 	inline bool is_taking_shower(Hash model)
 	{
 		int offset = 0;
@@ -29,8 +31,8 @@ namespace big
 	{
 		//Disable clothing validation
 		*scr_globals::reset_clothing.as<PBOOL>() = FALSE;
-		if (auto tunable = g_tunables_service->get_tunable<PBOOL>("DISABLE_CLOTHING_SAVE_SLOT_VALIDATION"_J)) [[likely]]
-			*tunable = TRUE;
+		if (disable_clothing_save_slot_validation) [[likely]]
+			*disable_clothing_save_slot_validation = TRUE;
 
 		if (g.self.persist_outfit.empty())
 			return; //Off
@@ -12,6 +12,7 @@ namespace big
 	{
 		using looped_command::looped_command;
 
+		tunable<int> m_passive_time_after_disable{"VC_PASSIVE_TIME_AFTER_DISABLE"_J};
 
 		virtual void on_tick() override
 		{
@@ -22,7 +23,7 @@ namespace big
 				g_notification_service.push_warning("PASSIVE"_T.data(), "BACKEND_LOOPED_SELF_TOGGLE_PASSIVE_DISABLED_PASSIVE_MODE_MESSAGE"_T.data());
 				return;
 			}
-			*g_tunables_service->get_tunable<int*>("VC_PASSIVE_TIME_AFTER_DISABLE"_J) = 0; // End Passive Time = 0s
+			m_passive_time_after_disable.set(0); // End Passive Time = 0s
 			*scr_globals::passive.as<PBOOL>() = TRUE;
 		}
 
@@ -30,7 +31,7 @@ namespace big
 		{
 			*scr_globals::passive.as<PBOOL>() = FALSE;
 			NETWORK::SET_LOCAL_PLAYER_AS_GHOST(false, false);
-			*g_tunables_service->get_tunable<int*>("VC_PASSIVE_TIME_AFTER_DISABLE"_J) = 30000;
+			m_passive_time_after_disable.set(30000);
 			PED::SET_PED_CONFIG_FLAG(self::ped, 342, false); // Disable NotAllowedToJackAnyPlayers
 			PED::SET_PED_CONFIG_FLAG(self::ped, 122, false); // Disable DisableMelee
 			PLAYER::SET_PLAYER_VEHICLE_DEFENSE_MODIFIER(self::ped, 1.f);
@@ -7,21 +7,20 @@ namespace big
 	{
 		using looped_command::looped_command;
 
+		tunable<BOOL> m_kick_out_with_weapon{"KICK_OUT_OF_NIGHTCLUB_WITH_WEAPON"_J};
+
 		virtual void on_tick() override
 		{
-			if (auto tunable = g_tunables_service->get_tunable<PBOOL>("KICK_OUT_OF_NIGHTCLUB_WITH_WEAPON"_J)) [[likely]]
+			if (m_kick_out_with_weapon) [[likely]]
 			{
-				if (*tunable == TRUE) [[unlikely]]
-					*tunable = FALSE;
+				if (*m_kick_out_with_weapon == TRUE) [[unlikely]]
+					*m_kick_out_with_weapon = FALSE;
 			}
 		}
 
 		virtual void on_disable() override
 		{
-			if (auto tunable = g_tunables_service->get_tunable<PBOOL>("KICK_OUT_OF_NIGHTCLUB_WITH_WEAPON"_J)) [[likely]]
-			{
-				*tunable = TRUE;
-			}
+			m_kick_out_with_weapon.set(TRUE);
 		}
 	};
 
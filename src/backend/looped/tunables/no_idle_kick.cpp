@@ -12,7 +12,7 @@ namespace big
 		std::array<int, 8> m_restore;
 		bool m_backed_up;
 
-		const std::vector<Hash> m_tunable_hashes = {"IDLEKICK_WARNING1"_J, "IDLEKICK_WARNING2"_J, "IDLEKICK_WARNING3"_J, "IDLEKICK_KICK"_J, "ConstrainedKick_Warning1"_J, "ConstrainedKick_Warning2"_J, "ConstrainedKick_Warning3"_J, "ConstrainedKick_Kick"_J};
+		std::array<tunable<int>, 8> m_tunables{tunable<int>{"IDLEKICK_WARNING1"_J}, tunable<int>{"IDLEKICK_WARNING2"_J}, tunable<int>{"IDLEKICK_WARNING3"_J}, tunable<int>{"IDLEKICK_KICK"_J}, tunable<int>{"ConstrainedKick_Warning1"_J}, tunable<int>{"ConstrainedKick_Warning2"_J}, tunable<int>{"ConstrainedKick_Warning3"_J}, tunable<int>{"ConstrainedKick_Kick"_J}};
 
 		virtual void on_tick() override
 		{
@@ -21,9 +21,9 @@ namespace big
 				bool did_fail = false;
 				for (int i = 0; i < m_restore.size(); i++)
 				{
-					if (auto tunable = g_tunables_service->get_tunable<int*>(m_tunable_hashes[i]))
+					if (m_tunables[i])
 					{
-						m_restore[i] = *tunable;
+						m_restore[i] = *m_tunables[i];
 					}
 					else
 					{
@@ -34,11 +34,11 @@ namespace big
 			}
 			else
 			{
-				for (Hash hash_iter : m_tunable_hashes)
+				for (auto& tunable : m_tunables)
 				{
-					if (auto tunable_ptr = g_tunables_service->get_tunable<int*>(hash_iter))
+					if (tunable)
 					{
-						*tunable_ptr = INT_MAX;
+						*tunable = INT_MAX;
 					}
 				}
 			}
@@ -49,7 +49,7 @@ namespace big
 			if (m_backed_up)
 			{
 				for (int i = 0; i < m_restore.size(); ++i)
-					*g_tunables_service->get_tunable<int*>(m_tunable_hashes[i]) = m_restore[i];
+					m_tunables[i].set(m_restore[i]);
 			}
 		}
 	};
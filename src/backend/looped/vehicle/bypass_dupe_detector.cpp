@@ -7,12 +7,14 @@ namespace big
 	{
 		using looped_command::looped_command;
 
+		tunable<BOOL> m_dozer_detector{"ENABLED_DOZER_DETECTOR"_J};
+
 		virtual void on_tick() override
 		{
-			if (auto tunable = g_tunables_service->get_tunable<PBOOL>("ENABLED_DOZER_DETECTOR"_J)) [[likely]]
+			if (m_dozer_detector) [[likely]]
 			{
-				if (*tunable == TRUE) [[unlikely]]
-					*tunable = FALSE;
+				if (*m_dozer_detector == TRUE) [[unlikely]]
+					*m_dozer_detector = FALSE;
 			}
 		}
 	};
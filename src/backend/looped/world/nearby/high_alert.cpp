@@ -1,4 +1,5 @@
 #include "backend/looped_command.hpp"
+#include "invoker/native_batch.hpp"
 #include "natives.hpp"
 #include "pointers.hpp"
 #include "util/entity.hpp"
@@ -11,12 +12,13 @@ namespace big
 
 		virtual void on_tick() override
 		{
+			native_batch<32> batch;
 			for (auto ped : entity::get_entities(false, true))
 			{
-				PED::SET_PED_HIGHLY_PERCEPTIVE(ped, true);
-				PED::SET_PED_HEARING_RANGE(ped, 1000.0);
-				PED::SET_PED_SEEING_RANGE(ped, 1000.0);
-				PED::SET_PED_VISUAL_FIELD_MIN_ANGLE(ped, 1000.0);
+				batch.add<NativeIndex::SET_PED_HIGHLY_PERCEPTIVE>(ped, TRUE);
+				batch.add<NativeIndex::SET_PED_HEARING_RANGE>(ped, 1000.f);
+				batch.add<NativeIndex::SET_PED_SEEING_RANGE>(ped, 1000.f);
+				batch.add<NativeIndex::SET_PED_VISUAL_FIELD_MIN_ANGLE>(ped, 1000.f);
 			}
 		}
 	};
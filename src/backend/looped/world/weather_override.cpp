@@ -12,15 +12,12 @@ namespace big
 	class weather_override : looped_command
 	{
 		int current_weather_idx = -1;
-		bool* turn_snow_on_off  = nullptr;
+		tunable<bool> turn_snow_on_off{"TURN_SNOW_ON_OFF"_J};
 
 		using looped_command::looped_command;
 
 		virtual void on_tick() override
 		{
-			if (!turn_snow_on_off)
-				turn_snow_on_off = g_tunables_service->get_tunable<bool*>("TURN_SNOW_ON_OFF"_J);
-
 			if (current_weather_idx != g.world.local_weather)
 			{
 				MISC::SET_OVERRIDE_WEATHER(weathers[g.world.local_weather]);
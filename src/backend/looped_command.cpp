@@ -2,9 +2,81 @@
 
 namespace big
 {
-	looped_command::looped_command(const std::string& name, const std::string& label, const std::string& description, bool& toggle) :
-	    bool_command(name, label, description, toggle)
+	looped_command::looped_command(const std::string& name, const std::string& label, const std::string& description, bool& toggle, std::uint32_t tick_interval) :
+	    bool_command(name, label, description, toggle),
+	    m_tick_probe(std::format("looped_command {}", name)),
+	    m_tick_interval(std::max(tick_interval, 1u))
 	{
 		g_looped_commands.push_back(this);
 	}
-}
\ No newline at end of file
+
+	void looped_command::refresh()
+	{
+		bool_command::refresh();
+		g_looped_command_dispatcher.invalidate();
+	}
+
+	void looped_command::enable()
+	{
+		bool_command::enable();
+		g_looped_command_dispatcher.invalidate();
+	}
+
+	void looped_command::disable()
+	{
+		bool_command::disable();
+		g_looped_command_dispatcher.invalidate();
+	}
+
+	void looped_command_dispatcher::rebuild()
+	{
+		m_active.clear();
+
+		for (auto command : g_looped_commands)
+		{
+			const bool enabled = command->is_enabled();
+			if (enabled && !command->m_dispatch_active)
+				command->m_next_frame = m_frame;
+
+			command->m_dispatch_active = enabled;
+			if (enabled)
+				m_active.push_back(command);
+		}
+	}
+
+	bool looped_command_dispatcher::has_untracked_changes() const
+	{
+		for (const auto command : g_looped_commands)
+			if (command->is_enabled() && !command->m_dispatch_active)
+				return true;
+
+		return false;
+	}
+
+	void looped_command_dispatcher::tick()
+	{
+		// rebuilt before ticking so that a command switched on through the command system starts on the same tick
+		if (m_dirty.exchange(false, std::memory_order_acquire)
+		    || (m_frame % untracked_check_interval == 0 && has_untracked_changes()))
+			rebuild();
+
+		for (auto command : m_active)
+		{
+			if (!command->is_enabled()) [[unlikely]]
+			{
+				invalidate();
+				continue;
+			}
+
+			if (m_frame < command->m_next_frame)
+				continue;
+
+			command->m_next_frame = m_frame + command->m_tick_interval;
+
+			telemetry_scope tick_scope(command->m_tick_probe);
+			command->on_tick();
+		}
+
+		m_frame++;
+	}
+}
@@ -1,15 +1,70 @@
 #pragma once
 #include "bool_command.hpp"
+#include "services/telemetry/telemetry_service.hpp"
 
 namespace big
 {
 	class looped_command : public bool_command
 	{
+		friend class looped_command_dispatcher;
+
 	public:
-		looped_command(const std::string& name, const std::string& label, const std::string& description, bool& toggle);
+		// tick_interval is the amount of game frames between two on_tick calls, 1 means every frame
+		looped_command(const std::string& name, const std::string& label, const std::string& description, bool& toggle, std::uint32_t tick_interval = 1);
 
 		virtual void on_tick() = 0;
+
+		virtual void refresh() override;
+		virtual void enable() override;
+		virtual void disable() override;
+
+		std::uint32_t get_tick_interval() const
+		{
+			return m_tick_interval;
+		}
+
+	private:
+		telemetry_probe m_tick_probe;
+		std::uint32_t m_tick_interval;
+
+		// only touched by the dispatcher on the game thread
+		bool m_dispatch_active     = false;
+		std::uint64_t m_next_frame = 0;
 	};
 
 	inline std::vector<looped_command*> g_looped_commands;
-}
\ No newline at end of file
+
+	// Keeps a compact list of the looped commands that are currently enabled so that only those are ticked.
+	// Everything that goes through the command system invalidates the list and is picked up on the next tick.
+	// Toggles written directly (settings, raw checkboxes) are caught by comparing every toggle against the
+	// list, which only happens every untracked_check_interval frames so the idle cost stays with the active list.
+	class looped_command_dispatcher
+	{
+	public:
+		static constexpr std::uint32_t untracked_check_interval = 30;
+
+		// can be called from any thread, the active list is rebuilt on the next tick
+		void invalidate()
+		{
+			m_dirty.store(true, std::memory_order_release);
+		}
+
+		void tick();
+
+		std::size_t get_active_count() const
+		{
+			return m_active.size();
+		}
+
+	private:
+		void rebuild();
+		// true if a toggle was switched on behind the dispatcher's back
+		bool has_untracked_changes() const;
+
+		std::vector<looped_command*> m_active;
+		std::atomic_bool m_dirty{true};
+		std::uint64_t m_frame = 0;
+	};
+
+	inline looped_command_dispatcher g_looped_command_dispatcher;
+}
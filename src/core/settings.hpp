@@ -120,6 +120,21 @@ namespace big
 				int metric_logs{};
 				int packet_logs{};
 
+				struct packet_filter
+				{
+					// skipped in FILTERS mode, by default the types every session is flooded with:
+					// clone syncs and their acks, packed events and reliables, array manager updates, script handshakes and joins, object ids and time syncs
+					std::vector<std::uint32_t> excluded_types = {0x4E, 0x3B, 0x4F, 0x30, 0x20, 0x60, 0x25, 0x5D, 0x5B, 0x57, 0x5C, 0x43, 0x4D, 0x29, 0x09, 0x38};
+					// one bit per player id
+					std::uint32_t players = 0xFFFFFFFF;
+					// peers that don't have a player yet, i.e. everything before their physical
+					bool unknown_players = true;
+					bool incoming        = true;
+					bool outgoing        = true;
+
+					NLOHMANN_DEFINE_TYPE_INTRUSIVE(packet_filter, excluded_types, players, unknown_players, incoming, outgoing)
+				} packet_filter{};
+
 				bool script_hook_logs{};
 
 				struct script_event
@@ -134,7 +149,7 @@ namespace big
 					NLOHMANN_DEFINE_TYPE_INTRUSIVE(script_event, logs, filter_player, player_id)
 				} script_event{};
 
-				NLOHMANN_DEFINE_TYPE_INTRUSIVE(logs, metric_logs, packet_logs, script_hook_logs, script_event)
+				NLOHMANN_DEFINE_TYPE_INTRUSIVE(logs, metric_logs, packet_logs, packet_filter, script_hook_logs, script_event)
 			} logs{};
 
 			struct fuzzer
@@ -149,8 +164,10 @@ namespace big
 			bool external_console = true;
 			bool window_hook      = false;
 			bool block_all_metrics = false;
+			// wraps every detour in a telemetry timer, only read when the hooks are created
+			bool time_detours = false;
 
-			NLOHMANN_DEFINE_TYPE_INTRUSIVE(debug, logs, external_console, window_hook, block_all_metrics)
+			NLOHMANN_DEFINE_TYPE_INTRUSIVE(debug, logs, external_console, window_hook, block_all_metrics, time_detours)
 		} debug{};
 
 		struct tunables
@@ -1,5 +1,7 @@
 #include "file_manager.hpp"
 
+#include <stdexcept>
+
 namespace big
 {
 	bool file_manager::init(const std::filesystem::path& base_dir)
@@ -1,8 +1,9 @@
 #pragma once
-#include "common.hpp"
 #include "file_manager/file.hpp"
 #include "file_manager/folder.hpp"
 
+#include <filesystem>
+
 namespace big
 {
 	class file_manager final
@@ -1,5 +1,9 @@
 #include "folder.hpp"
 
+#include "file.hpp"
+
+#include <stdexcept>
+
 namespace big
 {
 	folder::folder(const std::filesystem::path& folder_path) :
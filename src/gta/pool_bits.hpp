@@ -0,0 +1,42 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <emmintrin.h>
+
+// Walks the validity arrays of the game's entity pools, see pools.hpp.
+
+// Calls func(index) for every set bit of a bit array, one 32 bit word at a time.
+template<typename F>
+inline void for_each_set_bit(const std::uint32_t* words, std::uint32_t size, F&& func)
+{
+	for (std::uint32_t word_index = 0; word_index * 32 < size; word_index++)
+	{
+		for (std::uint32_t word = words[word_index]; word; word &= word - 1)
+		{
+			const std::uint32_t index = word_index * 32 + std::countr_zero(word);
+			if (index >= size)
+				return;
+
+			func(index);
+		}
+	}
+}
+
+// Calls func(index) for every byte that has its high bit cleared, 16 bytes at a time.
+template<typename F>
+inline void for_each_clear_high_bit(const std::uint8_t* bytes, std::uint32_t size, F&& func)
+{
+	std::uint32_t base = 0;
+	for (; base + 16 <= size; base += 16)
+	{
+		const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + base));
+		for (std::uint32_t mask = ~static_cast<std::uint32_t>(_mm_movemask_epi8(chunk)) & 0xFFFF; mask; mask &= mask - 1)
+			func(base + std::countr_zero(mask));
+	}
+
+	for (; base < size; base++)
+	{
+		if (!(bytes[base] & 0x80))
+			func(base);
+	}
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "natives.hpp"
 #include "pointers.hpp"
+#include "pool_bits.hpp"
 
 // everything pasted from https://github.com/gta-chaos-mod/ChaosModV/blob/master/ChaosMod/Util/EntityIterator.h
 // Thanks to menyoo for most of these!!
@@ -54,15 +55,24 @@ public:
 	inline auto to_array()
 	{
 		std::vector<Entity> arr;
-		for (auto entity : *static_cast<T*>(this))
-		{
-			if (entity)
-				arr.push_back(big::g_pointers->m_gta.m_ptr_to_handle(entity));
-		}
+		for_each_entity([&arr](rage::CEntity* entity) {
+			arr.push_back(big::g_pointers->m_gta.m_ptr_to_handle(entity));
+		});
 
 		return arr;
 	}
 
+	// Faster than the iterator as it checks the validity bit array a word at a time
+	template<typename F>
+	inline void for_each_entity(F&& func)
+	{
+		auto pool = static_cast<T*>(this);
+		pool->for_each_valid_index([pool, &func](UINT32 i) {
+			if (auto entity = (rage::CEntity*)pool->get_address(i))
+				func(entity);
+		});
+	}
+
 	auto begin()
 	{
 		return ++pool_iterator<T>(static_cast<T*>(this), -1);
@@ -93,6 +103,12 @@ public:
 	{
 		return m_pool_address[i];
 	}
+
+	template<typename F>
+	inline void for_each_valid_index(F&& func)
+	{
+		for_each_set_bit(m_bit_array, m_size, func);
+	}
 };
 
 class GenericPool : public PoolUtils<GenericPool>
@@ -120,6 +136,12 @@ public:
 		return (4 * m_item_count) >> 2;
 	}
 
+	template<typename F>
+	inline void for_each_valid_index(F&& func)
+	{
+		for_each_clear_high_bit(m_bit_array, m_size, func);
+	}
+
 private:
 	inline long long mask(UINT32 i)
 	{
@@ -0,0 +1,61 @@
+#include "hook_group.hpp"
+
+namespace big
+{
+	hook_group::hook_group(std::string name, std::vector<std::string> owners) :
+	    m_name(std::move(name)),
+	    m_owners(std::move(owners)),
+	    m_active_owners(m_owners.size(), false)
+	{
+	}
+
+	void hook_group::add(detour_hook* hook)
+	{
+		m_detour_hooks.push_back(hook);
+	}
+
+	void hook_group::add(vtable_hook* hook)
+	{
+		m_vtable_hooks.push_back(hook);
+	}
+
+	void hook_group::set_owner_active(std::string_view owner, bool active)
+	{
+		for (std::size_t i = 0; i < m_owners.size(); i++)
+			if (m_owners[i] == owner)
+				m_active_owners[i] = active;
+
+		update();
+	}
+
+	void hook_group::set_hooking_enabled(bool enabled)
+	{
+		m_hooking_enabled = enabled;
+		update();
+	}
+
+	void hook_group::update()
+	{
+		const bool should_install = m_hooking_enabled && std::find(m_active_owners.begin(), m_active_owners.end(), true) != m_active_owners.end();
+		if (should_install == m_installed)
+			return;
+
+		if (should_install)
+		{
+			for (const auto hook : m_vtable_hooks)
+				hook->enable();
+			for (const auto hook : m_detour_hooks)
+				hook->enable();
+		}
+		else
+		{
+			for (const auto hook : m_detour_hooks)
+				hook->disable();
+			for (const auto hook : m_vtable_hooks)
+				hook->disable();
+		}
+
+		m_installed = should_install;
+		LOG(VERBOSE) << (m_installed ? "Installed" : "Removed") << " hook group " << m_name;
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "detour_hook.hpp"
+#include "vtable_hook.hpp"
+
+namespace big
+{
+	// A set of hooks that are only needed while a feature is in use.
+	// They are installed once hooking is enabled and at least one of their owners is active, and removed again
+	// when the last owner goes inactive, so the default configuration runs with fewer detours on hot engine paths.
+	class hook_group
+	{
+	public:
+		explicit hook_group(std::string name, std::vector<std::string> owners);
+
+		hook_group(const hook_group&)            = delete;
+		hook_group& operator=(const hook_group&) = delete;
+
+		void add(detour_hook* hook);
+		void add(vtable_hook* hook);
+
+		// owners this group wasn't declared with are ignored, setting the same state twice does nothing
+		void set_owner_active(std::string_view owner, bool active);
+		void set_hooking_enabled(bool enabled);
+
+		[[nodiscard]] bool is_installed() const
+		{
+			return m_installed;
+		}
+
+		const std::string& name() const
+		{
+			return m_name;
+		}
+
+	private:
+		// queues the detours, the caller applies them so that several groups can be switched with one MH_ApplyQueued
+		void update();
+
+		std::string m_name;
+		std::vector<std::string> m_owners;
+		std::vector<bool> m_active_owners;
+
+		std::vector<detour_hook*> m_detour_hooks;
+		std::vector<vtable_hook*> m_vtable_hooks;
+
+		bool m_hooking_enabled = false;
+		bool m_installed       = false;
+	};
+}
@@ -7,6 +7,7 @@ namespace big
 	hooking::hooking() :
 	    m_swapchain_hook(*g_pointers->m_gta.m_swapchain, hooks::swapchain_num_funcs),
 	    m_sync_data_reader_hook(g_pointers->m_gta.m_sync_data_reader_vtable, 27),
+	    m_fuzzer_hooks("fuzzer", {"fuzzer"}),
 	    m_error_packet_memmove_hook(g_pointers->m_gta.m_error_packet_memmove, hooks::error_packet_memmove)
 	{
 		m_swapchain_hook.hook(hooks::swapchain_present_index, &hooks::swapchain_present);
@@ -31,6 +32,7 @@ namespace big
 		m_sync_data_reader_hook.hook(19, &hooks::sync_reader_serialize_vec3);
 		m_sync_data_reader_hook.hook(21, &hooks::sync_reader_serialize_vec3_signed);
 		m_sync_data_reader_hook.hook(23, &hooks::sync_reader_serialize_array);
+		m_fuzzer_hooks.add(&m_sync_data_reader_hook);
 
 		// The only instances in that vector at this point should only be the "lazy" hooks
 		// aka the ones that still don't have their m_target assigned
@@ -129,7 +131,7 @@ namespace big
 		detour_hook_helper::add<hooks::render_entity>("RE", g_pointers->m_gta.m_render_entity);
 		detour_hook_helper::add<hooks::render_big_ped>("RBP", g_pointers->m_gta.m_render_big_ped);
 
-		detour_hook_helper::add<hooks::read_bits_single>("RBS", g_pointers->m_gta.m_read_bits_single);
+		detour_hook_helper::add_owned<hooks::read_bits_single>("RBS", g_pointers->m_gta.m_read_bits_single, m_fuzzer_hooks);
 
 		detour_hook_helper::add<hooks::received_clone_remove>("RCR", g_pointers->m_gta.m_received_clone_remove);
 
@@ -172,7 +174,6 @@ namespace big
 	void hooking::enable()
 	{
 		m_swapchain_hook.enable();
-		m_sync_data_reader_hook.enable();
 		m_error_packet_memmove_hook.enable();
 		m_og_wndproc = WNDPROC(SetWindowLongPtrW(g_pointers->m_hwnd, GWLP_WNDPROC, LONG_PTR(&hooks::wndproc)));
 
@@ -181,6 +182,11 @@ namespace big
 			detour_hook_helper.m_detour_hook->enable();
 		}
 
+		{
+			std::lock_guard lock(m_hook_groups_mutex);
+			m_fuzzer_hooks.set_hooking_enabled(true);
+		}
+
 		MH_ApplyQueued();
 
 		m_enabled = true;
@@ -195,9 +201,13 @@ namespace big
 			detour_hook_helper.m_detour_hook->disable();
 		}
 
+		{
+			std::lock_guard lock(m_hook_groups_mutex);
+			m_fuzzer_hooks.set_hooking_enabled(false);
+		}
+
 		SetWindowLongPtrW(g_pointers->m_hwnd, GWLP_WNDPROC, reinterpret_cast<LONG_PTR>(m_og_wndproc));
 		m_error_packet_memmove_hook.disable();
-		m_sync_data_reader_hook.disable();
 		m_swapchain_hook.disable();
 
 		MH_ApplyQueued();
@@ -205,6 +215,15 @@ namespace big
 		m_detour_hook_helpers.clear();
 	}
 
+	void hooking::set_owner_active(std::string_view owner, bool active)
+	{
+		std::lock_guard lock(m_hook_groups_mutex);
+
+		m_fuzzer_hooks.set_owner_active(owner, active);
+
+		MH_ApplyQueued();
+	}
+
 	hooking::detour_hook_helper::~detour_hook_helper()
 	{
 	}
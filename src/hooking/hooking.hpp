@@ -1,9 +1,11 @@
 #pragma once
 #include "MinHook.h"
 #include "detour_hook.hpp"
+#include "hook_group.hpp"
 #include "vmt_hook.hpp"
 #include "vtable_hook.hpp"
 #include "call_hook.hpp"
+#include "services/telemetry/telemetry_service.hpp"
 
 #include <gta/enums.hpp>
 #include <network/netConnection.hpp> // cannot stub this
@@ -215,6 +217,14 @@ namespace big
 		static void* create_pool_item(GenericPool* pool);
 	};
 
+	// hooks that look at their own return address, they can't have the telemetry wrapper between them and the game
+	template<auto detour_function>
+	inline constexpr bool inspects_return_address = false;
+	template<>
+	inline constexpr bool inspects_return_address<&hooks::format_int> = true;
+	template<>
+	inline constexpr bool inspects_return_address<&hooks::create_pool_item> = true;
+
 	class minhook_keepalive
 	{
 	public:
@@ -239,6 +249,9 @@ namespace big
 		void enable();
 		void disable();
 
+		// installs or removes the hook groups declared with this owner, e.g. "fuzzer"
+		void set_owner_active(std::string_view owner, bool active);
+
 		class detour_hook_helper
 		{
 			friend hooking;
@@ -257,11 +270,43 @@ namespace big
 				static inline detour_hook m_detour_hook;
 			};
 
+			// sits between the game and the detour so that every hook is measured by the telemetry service,
+			// only installed when debug.time_detours was set at startup since it costs every hook an extra call frame
+			template<auto detour_function>
+			struct timed_detour;
+
+			template<typename ret_t, typename... args_t, ret_t (*detour_function)(args_t...)>
+			struct timed_detour<detour_function>
+			{
+				static inline telemetry_probe m_probe;
+
+				static ret_t invoke(args_t... args)
+				{
+					telemetry_scope scope(m_probe);
+					return detour_function(std::forward<args_t>(args)...);
+				}
+			};
+
+			template<auto detour_function>
+			static void* get_detour(const std::string& name)
+			{
+				if constexpr (!inspects_return_address<detour_function>)
+				{
+					if (g.debug.time_detours)
+					{
+						timed_detour<detour_function>::m_probe.set_name(std::format("detour {}", name));
+						return reinterpret_cast<void*>(&timed_detour<detour_function>::invoke);
+					}
+				}
+
+				return reinterpret_cast<void*>(detour_function);
+			}
+
 		public:
 			template<auto detour_function>
 			static void add(const std::string& name, void* target)
 			{
-				hook_to_detour_hook_helper<detour_function>::m_detour_hook.set_instance(name, target, detour_function);
+				hook_to_detour_hook_helper<detour_function>::m_detour_hook.set_instance(name, target, get_detour<detour_function>(name));
 
 				detour_hook_helper d{};
 				d.m_detour_hook = &hook_to_detour_hook_helper<detour_function>::m_detour_hook;
@@ -271,10 +316,19 @@ namespace big
 				m_detour_hook_helpers.push_back(d);
 			}
 
+			// the detour is only enabled while the group is installed
+			template<auto detour_function>
+			static void add_owned(const std::string& name, void* target, hook_group& group)
+			{
+				hook_to_detour_hook_helper<detour_function>::m_detour_hook.set_instance(name, target, get_detour<detour_function>(name));
+
+				group.add(&hook_to_detour_hook_helper<detour_function>::m_detour_hook);
+			}
+
 			template<auto detour_function>
 			static void* add_lazy(const std::string& name, detour_hook_helper::ret_ptr_fn on_hooking_available)
 			{
-				hook_to_detour_hook_helper<detour_function>::m_detour_hook.set_instance(name, detour_function);
+				hook_to_detour_hook_helper<detour_function>::m_detour_hook.set_instance(name, get_detour<detour_function>(name));
 
 				detour_hook_helper d{};
 				d.m_detour_hook          = &hook_to_detour_hook_helper<detour_function>::m_detour_hook;
@@ -303,6 +357,10 @@ namespace big
 		vmt_hook m_swapchain_hook;
 		vtable_hook m_sync_data_reader_hook;
 
+		// hooks that only do something while the fuzzer is enabled, they sit on every clone sync read
+		hook_group m_fuzzer_hooks;
+		std::mutex m_hook_groups_mutex;
+
 		call_hook m_error_packet_memmove_hook;
 
 		WNDPROC m_og_wndproc = nullptr;
@@ -1183,9 +1183,9 @@ namespace big
 		}
 		else if (node->IsDataNode())
 		{
-			const auto addr     = (uintptr_t)node;
-			auto sender_plyr    = g_player_service->get_by_id(sender->m_player_id);
-			const auto& node_id = sync_node_finder::find((eNetObjType)object->m_object_type, addr);
+			const auto addr         = (uintptr_t)node;
+			const auto& sender_plyr = g_player_service->get_by_id(sender->m_player_id);
+			const auto& node_id     = sync_node_finder::find((eNetObjType)object->m_object_type, addr);
 
 			if ((((CProjectBaseSyncDataNode*)node)->flags & 1) == 0)
 				return false;
@@ -1,14 +1,16 @@
 #include "backend/command.hpp"
 #include "backend/context/chat_command_context.hpp"
-#include "core/data/packet_types.hpp"
 #include "gta/enums.hpp"
 #include "gta/net_game_event.hpp"
 #include "gta_util.hpp"
 #include "hooking/hooking.hpp"
 #include "lua/lua_manager.hpp"
 #include "natives.hpp"
+#include "services/net_capture/net_capture.hpp"
+#include "services/packet_log/packet_log.hpp"
 #include "services/players/player_service.hpp"
 #include "util/chat.hpp"
+#include "util/net_message.hpp"
 #include "util/session.hpp"
 #include "gta/net_object_mgr.hpp"
 
@@ -40,32 +42,6 @@ inline bool is_kick_instruction(rage::datBitBuffer& buffer)
 
 namespace big
 {
-	bool try_read_secondary_header(rage::datBitBuffer& buffer)
-	{
-		auto data = buffer.Read<std::uint32_t>(20);
-		return data == 0x8C253 || data == 0x8924F;
-	}
-
-	bool get_msg_type(rage::eNetMessage& msgType, rage::datBitBuffer& buffer)
-	{
-		uint32_t pos;
-		uint32_t magic;
-		uint32_t length;
-		uint32_t extended{};
-		if ((buffer.m_flagBits & 2) != 0 || (buffer.m_flagBits & 1) == 0 ? (pos = buffer.m_curBit) : (pos = buffer.m_maxBit),
-		    buffer.m_bitsRead + 15 > pos || !buffer.ReadDword(&magic, 14) || magic != 0x3246 || !buffer.ReadDword(&extended, 1))
-		{
-			msgType = rage::eNetMessage::MsgInvalid;
-			return false;
-		}
-		length = extended ? 16 : 8;
-		if ((buffer.m_flagBits & 1) == 0 ? (pos = buffer.m_curBit) : (pos = buffer.m_maxBit),
-		    length + buffer.m_bitsRead <= pos && buffer.ReadDword((uint32_t*)&msgType, length))
-			return true;
-		else
-			return false;
-	}
-
 	static void script_id_deserialize(CGameScriptId& id, rage::datBitBuffer& buffer)
 	{
 		id.m_hash      = buffer.Read<uint32_t>(32);
@@ -110,53 +86,25 @@ namespace big
 
 	void log_net_message(rage::eNetMessage message_type, rage::datBitBuffer& data_buffer, rage::netEvent* event, rage::SecurityPeer* sec_peer)
 	{
-		if (g.debug.logs.packet_logs == 1 || //ALL
-		    (g.debug.logs.packet_logs == 2 && message_type != rage::eNetMessage::MsgCloneSync && message_type != rage::eNetMessage::MsgPackedCloneSyncACKs && message_type != rage::eNetMessage::MsgPackedEvents && message_type != rage::eNetMessage::MsgPackedReliables && message_type != rage::eNetMessage::MsgPackedEventReliablesMsgs && message_type != rage::eNetMessage::MsgNetArrayMgrUpdate && message_type != rage::eNetMessage::MsgNetArrayMgrSplitUpdateAck && message_type != rage::eNetMessage::MsgNetArrayMgrUpdateAck && message_type != rage::eNetMessage::MsgScriptHandshakeAck && message_type != rage::eNetMessage::MsgScriptHandshake && message_type != rage::eNetMessage::MsgScriptJoin && message_type != rage::eNetMessage::MsgScriptJoinAck && message_type != rage::eNetMessage::MsgScriptJoinHostAck && message_type != rage::eNetMessage::MsgRequestObjectIds && message_type != rage::eNetMessage::MsgInformObjectIds && message_type != rage::eNetMessage::MsgNetTimeSync)) //FILTERED
-		{
-			const char* packet_type = "<UNKNOWN>";
-			for (const auto& p : packet_types)
-			{
-				if (p.second == (int)message_type)
-				{
-					packet_type = p.first;
-					break;
-				}
-			}
+		packet_log_entry entry{};
+		entry.m_time          = std::chrono::system_clock::now();
+		entry.m_type          = message_type;
+		entry.m_direction     = ePacketDirection::INCOMING;
+		entry.m_size          = data_buffer.GetDataLength();
+		entry.m_connection_id = event->m_connection_identifier;
+		entry.m_peer_id       = event->m_peer_id;
+		entry.m_msg_id        = event->m_msg_id;
 
-			auto now        = std::chrono::system_clock::now();
-			auto ms         = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-			auto timer      = std::chrono::system_clock::to_time_t(now);
-			auto local_time = *std::localtime(&timer);
-
-			std::string name = "";
-			rage::rlGamerHandle rid{};
-
-			if (sec_peer)
-			{
-				if (sec_peer->m_info.handle.m_platform == 3)
-					rid = sec_peer->m_info.handle;
-				else if (sec_peer->m_unverified_handle.m_platform == 3)
-					rid = sec_peer->m_unverified_handle;
-				name = sec_peer->m_info.name;
-			}
-
-			if (name.empty())
-				name = "???";
-
-			std::string log_msg = std::format("PKT | {} (0x{:X}) [size=0x{:X}, cxnId={:X}, peerId={}, msgId={}] from {} ({})",
-			    packet_type,
-			    (int)message_type,
-			    data_buffer.GetDataLength(),
-			    event->m_connection_identifier,
-			    event->m_peer_id,
-			    event->m_msg_id,
-			    name,
-			    rid.m_rockstar_id);
-
-			static std::ofstream log(g_file_manager.get_project_file("./packets.log").get_path(), std::ios::app);
-			log << "[" << std::put_time(&local_time, "%m/%d/%Y %I:%M:%S") << ":" << std::setfill('0') << std::setw(3) << ms.count() << " " << std::put_time(&local_time, "%p") << "] " << log_msg << std::endl;
-			log.flush();
+		if (sec_peer)
+		{
+			if (sec_peer->m_info.handle.m_platform == 3)
+				entry.m_rockstar_id = sec_peer->m_info.handle.m_rockstar_id;
+			else if (sec_peer->m_unverified_handle.m_platform == 3)
+				entry.m_rockstar_id = sec_peer->m_unverified_handle.m_rockstar_id;
+			strncpy(entry.m_name, sec_peer->m_info.name, sizeof(entry.m_name) - 1);
 		}
+
+		g_packet_log.push(entry);
 	}
 
 	bool is_host_of_session(rage::snSession* session, std::uint32_t peer_id)
@@ -272,21 +220,13 @@ namespace big
 
 
 		rage::datBitBuffer buffer(message_data, message_size);
-		buffer.m_flagBits = 1;
-
-		if (try_read_secondary_header(buffer))
-		{
-			buffer = rage::datBitBuffer(((char*)message_data) + 7, message_size - 7);
-			buffer.m_flagBits = 1;
-		}
-		else
-		{
-			buffer.Seek(0);
-		}
-
 		rage::eNetMessage msgType;
+		const bool parsed = read_net_message_header(buffer, message_data, message_size, msgType);
 
-		if (!get_msg_type(msgType, buffer))
+		if (g_net_capture.is_recording()) [[unlikely]]
+			g_net_capture.record(eNetCaptureSource::NET_MESSAGE, parsed ? (uint32_t)msgType : net_capture_record::unknown_type, event->m_connection_identifier, message_data, message_size * 8);
+
+		if (!parsed)
 		{
 			LOGF(stream::net_messages, WARNING, "Received message that we cannot parse from cxn id {}", event->m_connection_identifier);
 			return g_hooking->get_original<hooks::receive_net_message>()(a1, net_cxn_mgr, event);
@@ -338,7 +278,7 @@ namespace big
 			return true;
 		}
 
-		if (g.debug.logs.packet_logs)
+		if (g_packet_log.should_log(msgType, ePacketDirection::INCOMING, player ? player->id() : -1))
 		{
 			log_net_message(msgType, buffer, event, peer);
 		}
@@ -370,7 +310,7 @@ namespace big
 		}
 		case rage::eNetMessage::MsgKickPlayer:
 		{
-			KickReason reason = buffer.Read<KickReason>(3);
+			msg_kick_player kick(buffer);
 
 			if (!is_host_of_session(gta_util::get_network()->m_game_session_ptr, event->m_peer_id))
 			{
@@ -378,13 +318,13 @@ namespace big
 				return true;
 			}
 
-			if (reason == KickReason::VOTED_OUT)
+			if (kick.block_reason())
 			{
 				g_notification_service.push_warning("PROTECTIONS"_T.data(), "YOU_HAVE_BEEN_KICKED"_T.data());
 				return true;
 			}
 
-			LOGF(stream::net_messages, VERBOSE, "{} sent us a MsgKickPlayer, reason = {}", peer->m_info.name, (int)reason);
+			LOGF(stream::net_messages, VERBOSE, "{} sent us a MsgKickPlayer, reason = {}", peer->m_info.name, (int)kick.m_reason);
 			break;
 		}
 		case rage::eNetMessage::MsgRadioStationSyncRequest:
@@ -482,16 +422,16 @@ namespace big
 				return true;
 			}
 
-			int num_objects_in_our_range = buffer.Read<int>(13);
+			msg_inform_object_ids ids(buffer);
 
-			if (num_objects_in_our_range > 256)
+			if (auto reason = ids.block_reason())
 			{
-				LOGF(stream::net_messages, WARNING, "{} sent MsgInformObjectIds, but they have given us an unusual amount of occupied object IDs in our object range", peer->m_info.name);
+				LOGF(stream::net_messages, WARNING, "{} sent MsgInformObjectIds, but {}", peer->m_info.name, reason);
 				gta_util::get_net_object_ids()->m_object_id_response_pending_players &= (1 << player->id());
 				return true;
 			}
 
-			buffer.SeekForward(num_objects_in_our_range * 13); // we don't really care about this segment
+			buffer.SeekForward(ids.m_num_objects_in_our_range * 13); // we don't really care about this segment
 
 			int num_replacement_objects = buffer.Read<int>(13);
 
@@ -512,21 +452,15 @@ namespace big
 		}
 		case rage::eNetMessage::MsgRoamingJoinBubbleAck:
 		{
-			int status = buffer.Read<int>(2);
-			int bubble = buffer.Read<int>(4);
+			msg_roaming_join_bubble_ack ack(buffer);
 
-			if (status == 0 && bubble == 10)
+			if (auto reason = ack.block_reason())
 			{
-				LOGF(stream::net_messages, WARNING, "{} sent MsgRoamingJoinBubbleAck with a null bubble id", peer->m_info.name);
-				if (player)
+				LOGF(stream::net_messages, WARNING, "{} sent MsgRoamingJoinBubbleAck for bubble {}, but {}", peer->m_info.name, ack.m_bubble, reason);
+				if (ack.is_null_bubble() && player)
 					g.reactions.break_game.process(player);
 				return true;
 			}
-			else if (status == 0)
-			{
-				LOGF(stream::net_messages, WARNING, "{} wants us to join their bubble {}, but this is not a good idea", peer->m_info.name, bubble);
-				return true;
-			}
 
 			break;
 		}
@@ -539,89 +473,56 @@ namespace big
 				return true;
 			}
 
-			int my_bubble = buffer.Read<int>(4);
-			int my_pid = buffer.Read<int>(6);
-			int their_bubble = buffer.Read<int>(4);
-			int their_pid = buffer.Read<int>(6);
-
-			if (their_bubble == 10) [[unlikely]]
-			{
-				LOGF(stream::net_messages, WARNING, "{} sent MsgRoamingInitialBubble, but the host doesn't have a bubble?", peer->m_info.name);
-				return true;
-			}
+			msg_roaming_initial_bubble bubble(buffer);
 
-			if (my_bubble == 10) [[unlikely]]
+			if (auto reason = bubble.block_reason()) [[unlikely]]
 			{
-				LOGF(stream::net_messages, WARNING, "{} sent MsgRoamingInitialBubble, but the host didn't actually give us a valid bubble", peer->m_info.name);
+				LOGF(stream::net_messages, WARNING, "{} sent MsgRoamingInitialBubble, but {} ({} / {})", peer->m_info.name, reason, bubble.m_their_bubble, bubble.m_my_bubble);
 				return true;
 			}
 
-			if (my_bubble > 10 || their_bubble > 10) [[unlikely]]
+			if (bubble.m_my_bubble != 0) [[unlikely]]
 			{
-				LOGF(stream::net_messages, WARNING, "{} sent MsgRoamingInitialBubble, but the host is trying to crash us by giving us an out of bounds bubble id", peer->m_info.name);
-				return true;
-			}
-
-			if (my_bubble != 0) [[unlikely]]
-			{
-				LOGF(stream::net_messages, WARNING, "{} sent MsgRoamingInitialBubble with a non-standard bubble id: {}", peer->m_info.name, my_bubble);
-			}
-
-			if (my_bubble != their_bubble) [[unlikely]]
-			{
-				LOGF(stream::net_messages, WARNING, "{} sent MsgRoamingInitialBubble, but the host's bubble id doesn't match our bubble id ({} != {})", peer->m_info.name, their_bubble, my_bubble);
-				return true;
+				LOGF(stream::net_messages, WARNING, "{} sent MsgRoamingInitialBubble with a non-standard bubble id: {}", peer->m_info.name, bubble.m_my_bubble);
 			}
 
-			if (my_pid >= 32 || their_pid >= 32) [[unlikely]]
+			if (bubble.m_my_pid >= 32 || bubble.m_their_pid >= 32) [[unlikely]]
 			{
 				LOGF(stream::net_messages, WARNING, "{} sent MsgRoamingInitialBubble, but the host gave us invalid player ids (or made us pick our own player ids)", peer->m_info.name);
 			}
 
-			if (my_pid == their_pid) [[unlikely]]
-			{
-				LOGF(stream::net_messages, WARNING, "{} sent MsgRoamingInitialBubble, but the host has the same player id as us", peer->m_info.name);
-				return true;
-			}
-
 			break;
 		}
 		case rage::eNetMessage::MsgNonPhysicalData:
 		{
-			buffer.Read<int>(7); // size
-			int bubble_id = buffer.Read<int>(4);
-			int player_id = buffer.Read<int>(6);
+			msg_non_physical_data data(buffer);
 
 			if (player)
 			{
 				return true; // we don't need this message anymore
 			}
 
-			if (bubble_id == 10) [[unlikely]]
+			if (auto reason = data.block_reason()) [[unlikely]]
 			{
-				LOGF(stream::net_messages, VERBOSE, "{} sent MsgNonPhysicalData and indicated that they are not in a bubble", peer->m_info.name);
-				return true; // might as well drop it
-			}
-
-			if (bubble_id > 10) [[unlikely]]
-			{
-				LOGF(stream::net_messages, WARNING, "{} sent MsgNonPhysicalData, but are trying to crash us by giving us an out of bounds bubble id", peer->m_info.name);
+				// not being in a bubble is harmless, might as well drop it quietly
+				if (data.m_bubble_id == 10)
+				{
+					LOGF(stream::net_messages, VERBOSE, "{} sent MsgNonPhysicalData, but {}", peer->m_info.name, reason);
+				}
+				else
+				{
+					LOGF(stream::net_messages, WARNING, "{} sent MsgNonPhysicalData, but {}", peer->m_info.name, reason);
+				}
 				return true;
 			}
 
-			if (bubble_id != 0) [[unlikely]]
+			if (data.m_bubble_id != 0) [[unlikely]]
 			{
-				LOGF(stream::net_messages, WARNING, "{} sent MsgNonPhysicalData with a non-standard bubble id: {}. This may cause problems during join", peer->m_info.name, bubble_id);
-			}
-
-			if (player_id >= 32) [[unlikely]]
-			{
-				LOG(WARNING) << peer->m_info.name << " sent MsgNonPhysicalData, but has an invalid player id (or is trying to make us pick our own)";
-				return true;
+				LOGF(stream::net_messages, WARNING, "{} sent MsgNonPhysicalData with a non-standard bubble id: {}. This may cause problems during join", peer->m_info.name, data.m_bubble_id);
 			}
 
 			if (g_player_service->get_self() && g_player_service->get_self()->id() != -1
-				&& g_player_service->get_self()->id() == player_id) [[unlikely]]
+				&& g_player_service->get_self()->id() == data.m_player_id) [[unlikely]]
 			{
 				LOGF(stream::net_messages, VERBOSE, "{} sent MsgNonPhysicalData, but are trying to replace us", peer->m_info.name);
 				return true;
@@ -629,7 +530,7 @@ namespace big
 
 			for (auto& player : g_player_service->players())
 			{
-				if (player.second->id() == player_id) [[unlikely]]
+				if (player.second->id() == data.m_player_id) [[unlikely]]
 				{
 					LOGF(stream::net_messages, VERBOSE, "{} sent MsgNonPhysicalData, but are trying to replace {}", peer->m_info.name, player.second->get_name());
 					return true;
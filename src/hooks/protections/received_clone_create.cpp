@@ -72,7 +72,7 @@ namespace big
 			gta_util::get_net_object_ids()->remove_object_id(object_id);
 		}
 
-		auto plyr = g_player_service->get_by_id(src->m_player_id);
+		const auto& plyr = g_player_service->get_by_id(src->m_player_id);
 
 		if (plyr && plyr->block_clone_create) [[unlikely]]
 			return;
@@ -1,12 +1,17 @@
 #include "hooking/hooking.hpp"
+#include "services/net_capture/net_capture.hpp"
 #include "services/players/player_service.hpp"
+#include "util/net_message.hpp"
 #include "util/notify.hpp"
 
 namespace big
 {
 	eAckCode hooks::received_clone_sync(CNetworkObjectMgr* mgr, CNetGamePlayer* src, CNetGamePlayer* dst, eNetObjType object_type, uint16_t object_id, rage::datBitBuffer* buffer, uint16_t unk, uint32_t timestamp)
 	{
-		if (object_type < eNetObjType::NET_OBJ_TYPE_AUTOMOBILE || object_type > eNetObjType::NET_OBJ_TYPE_TRAIN) [[unlikely]]
+		if (g_net_capture.is_recording()) [[unlikely]]
+			g_net_capture.record(eNetCaptureSource::CLONE_SYNC, (uint32_t)object_type, src->m_player_id, buffer->m_data, buffer->m_maxBit);
+
+		if (!is_valid_sync_object_type(object_type)) [[unlikely]]
 		{
 			notify::crash_blocked(src, "out of bounds object type");
 			return eAckCode::ACKCODE_FAIL;
@@ -40,7 +45,7 @@ namespace big
 			}
 		}
 
-		auto plyr = g_player_service->get_by_id(src->m_player_id);
+		const auto& plyr = g_player_service->get_by_id(src->m_player_id);
 
 		if (plyr && plyr->block_clone_sync) [[unlikely]]
 			return eAckCode::ACKCODE_FAIL;
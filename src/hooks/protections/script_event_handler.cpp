@@ -2,6 +2,7 @@
 #include "gta_util.hpp"
 #include "hooking/hooking.hpp"
 #include "lua/lua_manager.hpp"
+#include "services/net_capture/net_capture.hpp"
 #include "util/math.hpp"
 #include "util/protection.hpp"
 #include "util/session.hpp"
@@ -24,7 +25,7 @@ namespace big
 
 	inline bool is_player_driver_of_local_vehicle(Player sender)
 	{
-		auto plyr = g_player_service->get_by_id(sender);
+		const auto& plyr = g_player_service->get_by_id(sender);
 
 		if (!plyr || !plyr->get_current_vehicle() || !g_player_service->get_self()->get_current_vehicle())
 			return false;
@@ -60,12 +61,15 @@ namespace big
 		const auto args       = scripted_game_event->m_args;
 		const auto args_count = scripted_game_event->m_args_size / 8;
 
+		if (g_net_capture.is_recording()) [[unlikely]]
+			g_net_capture.record(eNetCaptureSource::SCRIPT_EVENT, static_cast<uint32_t>(args[0]), player->m_player_id, args, scripted_game_event->m_args_size * 8);
+
 		const auto hash        = static_cast<eRemoteEvent>(args[0]);
 		const auto player_name = player->get_name();
 
-		auto plyr = g_player_service->get_by_id(player->m_player_id);
+		const auto& plyr = g_player_service->get_by_id(player->m_player_id);
 
-		if (g_lua_manager && g_lua_manager->get_module_count() > 0)
+		if (g_lua_manager && g_lua_manager->has_event_subscribers(menu_event::ScriptedGameEventReceived))
 		{
 			std::vector<int32_t> script_event_args;
 
@@ -78,6 +82,15 @@ namespace big
 				return true; // don't care, block event if any bool is returned
 		}
 
+		if (const auto verdict = protection::check_script_event_args(args); verdict.m_reason) [[unlikely]]
+		{
+			if (verdict.m_infraction && plyr)
+				session::add_infraction(plyr, *verdict.m_infraction);
+			if (verdict.m_reaction)
+				verdict.m_reaction->process(plyr);
+			return true;
+		}
+
 		switch (hash)
 		{
 		case eRemoteEvent::Bounty:
@@ -109,31 +122,6 @@ namespace big
 				return true;
 			}
 			break;
-		case eRemoteEvent::Crash: g.reactions.crash.process(plyr); return true;
-		case eRemoteEvent::Crash2:
-			if (args[3] > 32) // actual crash condition is if args[2] is above 255
-			{
-				g.reactions.crash.process(plyr);
-				return true;
-			}
-			break;
-		case eRemoteEvent::Crash3:
-		{
-			if (isnan(*(float*)&args[3]) || isnan(*(float*)&args[4]) || isnan(*(float*)&args[5]))
-			{
-				session::add_infraction(plyr, Infraction::TRIED_CRASH_PLAYER);
-				g.reactions.crash.process(plyr);
-				return true;
-			}
-			if (args[3] == -4640169 && args[7] == -36565476 && args[8] == -53105203)
-			{
-				session::add_infraction(plyr, Infraction::TRIED_CRASH_PLAYER);
-				g.reactions.crash.process(plyr);
-
-				return true;
-			}
-			break;
-		}
 		case eRemoteEvent::Notification:
 		{
 			switch (static_cast<eRemoteEvent>(args[3]))
@@ -141,9 +129,6 @@ namespace big
 			case eRemoteEvent::NotificationMoneyBanked: // never used
 			case eRemoteEvent::NotificationMoneyRemoved:
 			case eRemoteEvent::NotificationMoneyStolen: g.reactions.fake_deposit.process(plyr); return true;
-			case eRemoteEvent::NotificationCrash1:                             // this isn't used by the game
-				session::add_infraction(plyr, Infraction::TRIED_CRASH_PLAYER); // stand user detected
-				return true;
 			case eRemoteEvent::NotificationCrash2:
 				if (!gta_util::find_script_thread("gb_salvage"_J))
 				{
@@ -178,7 +163,7 @@ namespace big
 			}
 			break;
 		case eRemoteEvent::MCTeleport:
-			if (g.protections.script_events.mc_teleport && args[4] <= 32 && !is_player_our_boss(plyr->id()))
+			if (g.protections.script_events.mc_teleport && !is_player_our_boss(plyr->id()))
 			{
 				for (int i = 0; i < 32; i++)
 				{
@@ -189,11 +174,6 @@ namespace big
 					}
 				}
 			}
-			else if (args[4] > 32)
-			{
-				g.reactions.crash.process(plyr);
-				return true;
-			}
 			break;
 		case eRemoteEvent::PersonalVehicleDestroyed:
 			if (g.protections.script_events.personal_vehicle_destroyed)
@@ -308,7 +288,6 @@ namespace big
 				return true;
 			}
 			break;
-		case eRemoteEvent::TransactionError: g.reactions.transaction_error.process(plyr); return true;
 		case eRemoteEvent::VehicleKick:
 			if (g.protections.script_events.vehicle_kick)
 			{
@@ -316,10 +295,6 @@ namespace big
 				return true;
 			}
 			break;
-		case eRemoteEvent::NetworkBail:
-			session::add_infraction(plyr, Infraction::TRIED_KICK_PLAYER);
-			g.reactions.kick.process(plyr);
-			return true;
 		case eRemoteEvent::TeleportToWarehouse:
 			if (g.protections.script_events.teleport_to_warehouse && !is_player_driver_of_local_vehicle(player->m_player_id))
 			{
@@ -358,11 +333,6 @@ namespace big
 					return true;
 				}
 			}
-			else if (activity == eActivityType::Tennis)
-			{
-				g.reactions.crash.process(plyr);
-				return true;
-			}
 
 			if (g.protections.script_events.start_activity && !is_player_our_goon(player->m_player_id))
 			{
@@ -374,15 +344,6 @@ namespace big
 		}
 		case eRemoteEvent::InteriorControl:
 		{
-			int interior = (int)args[3];
-			if (interior < 0 || interior > 171) // the upper bound will change after an update
-			{
-				if (auto plyr = g_player_service->get_by_id(player->m_player_id))
-					session::add_infraction(plyr, Infraction::TRIED_KICK_PLAYER);
-				g.reactions.kick.process(plyr);
-				return true;
-			}
-
 			if (NETWORK::NETWORK_IS_ACTIVITY_SESSION())
 				break;
 
@@ -403,7 +364,6 @@ namespace big
 
 			break;
 		}
-		case eRemoteEvent::DestroyPersonalVehicle: g.reactions.destroy_personal_vehicle.process(plyr); return true;
 		case eRemoteEvent::KickFromInterior:
 			if (scr_globals::globalplayer_bd.as<GlobalPlayerBD*>()->Entries[self::id].SimpleInteriorData.Owner != plyr->id())
 			{
@@ -455,8 +415,7 @@ namespace big
 		}
 		}
 
-		// detect pasted menus setting args[1] to something other than PLAYER_ID()
-		if (*(int*)&args[1] != player->m_player_id && player->m_player_id != -1) [[unlikely]]
+		if (protection::is_script_event_sender_mismatch(args, player->m_player_id)) [[unlikely]]
 		{
 			LOG(INFO) << "Hash = " << (int)args[0];
 			LOG(INFO) << "Sender = " << args[1];
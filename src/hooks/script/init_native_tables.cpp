@@ -1,5 +1,6 @@
 #include "hooking/hooking.hpp"
 #include "native_hooks/native_hooks.hpp"
+#include "script_function.hpp"
 #include "services/script_patcher/script_patcher_service.hpp"
 
 namespace big
@@ -11,6 +12,7 @@ namespace big
 		if (program->m_code_size && program->m_code_blocks) // ensure that we aren't hooking SHV threads
 		{
 			g_script_patcher_service->on_script_load(program);
+			script_function::on_script_load(program);
 			g_native_hooks->hook_program(program);
 		}
 
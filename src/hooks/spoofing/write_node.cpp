@@ -21,7 +21,7 @@ namespace big
 			}
 		}
 
-		if (auto plyr = g_player_service->get_by_id(player); (plyr && plyr->spam_killfeed) || g.session.spam_killfeed)
+		if (const auto& plyr = g_player_service->get_by_id(player); (plyr && plyr->spam_killfeed) || g.session.spam_killfeed)
 		{
 			auto& type = sync_node_finder::find(reinterpret_cast<uint64_t>(node));
 
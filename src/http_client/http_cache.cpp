@@ -0,0 +1,85 @@
+#include "http_cache.hpp"
+
+namespace big
+{
+	void http_cache::set_folder(const std::filesystem::path& folder)
+	{
+		std::lock_guard lock(m_mutex);
+		m_folder = folder;
+	}
+
+	std::optional<http_cache_entry> http_cache::find(const std::string& url)
+	{
+		std::lock_guard lock(m_mutex);
+
+		if (const auto it = m_index.find(url); it != m_index.end())
+		{
+			m_entries.splice(m_entries.begin(), m_entries, it->second);
+			return it->second->second;
+		}
+
+		if (m_folder.empty())
+			return std::nullopt;
+
+		// first line is "<expiry in seconds since epoch> <etag>", then the url, the body follows as is
+		std::ifstream file(path_for(url), std::ios::binary);
+		if (!file)
+			return std::nullopt;
+
+		std::int64_t expires{};
+		http_cache_entry entry;
+		std::string stored_url;
+		if (!(file >> expires) || file.get() != ' ' || !std::getline(file, entry.m_etag) || !std::getline(file, stored_url))
+			return std::nullopt;
+
+		// files are only named by the hash of the url, a collision must not serve another url's body
+		if (stored_url != url)
+			return std::nullopt;
+
+		entry.m_expires = std::chrono::system_clock::time_point(std::chrono::seconds(expires));
+		entry.m_body.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+		return insert(url, std::move(entry));
+	}
+
+	void http_cache::store(const std::string& url, http_cache_entry entry)
+	{
+		std::lock_guard lock(m_mutex);
+
+		if (!m_folder.empty())
+		{
+			std::ofstream file(path_for(url), std::ios::binary | std::ios::trunc);
+			file << std::chrono::duration_cast<std::chrono::seconds>(entry.m_expires.time_since_epoch()).count() << ' '
+			     << entry.m_etag << '\n'
+			     << url << '\n'
+			     << entry.m_body;
+		}
+
+		insert(url, std::move(entry));
+	}
+
+	http_cache_entry& http_cache::insert(const std::string& url, http_cache_entry entry)
+	{
+		if (const auto it = m_index.find(url); it != m_index.end())
+		{
+			it->second->second = std::move(entry);
+			m_entries.splice(m_entries.begin(), m_entries, it->second);
+			return it->second->second;
+		}
+
+		if (m_entries.size() >= max_memory_entries)
+		{
+			m_index.erase(m_entries.back().first);
+			m_entries.pop_back();
+		}
+
+		m_entries.emplace_front(url, std::move(entry));
+		m_index.emplace(url, m_entries.begin());
+		return m_entries.front().second;
+	}
+
+	std::filesystem::path http_cache::path_for(const std::string& url) const
+	{
+		return m_folder / std::format("{:016X}.bin", std::hash<std::string>{}(url));
+	}
+}
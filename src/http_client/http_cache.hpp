@@ -0,0 +1,41 @@
+#pragma once
+#include <list>
+
+namespace big
+{
+	struct http_cache_entry
+	{
+		std::string m_etag;
+		std::chrono::system_clock::time_point m_expires;
+		std::string m_body;
+
+		bool fresh() const
+		{
+			return std::chrono::system_clock::now() < m_expires;
+		}
+	};
+
+	// GET responses keyed by url, kept in memory and mirrored to disk so they survive restarts.
+	// Only the max_memory_entries most recently used responses stay in memory, older ones are read back from disk.
+	class http_cache
+	{
+	public:
+		static constexpr std::size_t max_memory_entries = 128;
+
+		void set_folder(const std::filesystem::path& folder);
+
+		std::optional<http_cache_entry> find(const std::string& url);
+		void store(const std::string& url, http_cache_entry entry);
+
+	private:
+		std::filesystem::path path_for(const std::string& url) const;
+		// stores the entry as the most recently used one, evicting the least recently used one when full
+		http_cache_entry& insert(const std::string& url, http_cache_entry entry);
+
+		std::mutex m_mutex;
+		// most recently used first
+		std::list<std::pair<std::string, http_cache_entry>> m_entries;
+		std::unordered_map<std::string, decltype(m_entries)::iterator> m_index;
+		std::filesystem::path m_folder;
+	};
+}
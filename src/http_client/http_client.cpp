@@ -1,46 +1,200 @@
 #include "http_client.hpp"
 
+#include "thread_pool.hpp"
+
 namespace big
 {
+	static std::string get_host(const std::string& url)
+	{
+		auto begin = url.find("://");
+		begin      = begin == std::string::npos ? 0 : begin + 3;
+		return url.substr(begin, url.find_first_of("/?#", begin) - begin);
+	}
+
 	http_client::http_client() :
-	    m_proxy_mgr(m_session)
+	    m_proxy_mgr()
 	{
-		m_session.SetConnectTimeout(CONNECT_TIMEOUT);
-		m_session.SetTimeout(REQUEST_TIMEOUT);
+	}
+
+	cpr::Response http_client::with_session(const cpr::Url& url, std::chrono::milliseconds timeout, const std::function<cpr::Response(cpr::Session&)>& func)
+	{
+		const auto host     = get_host(url.str());
+		const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+		pooled_session* session = nullptr;
+		{
+			std::unique_lock lock(m_pool_mutex);
+			const auto available = [&] {
+				if (const auto it = m_requests_per_host.find(host); it != m_requests_per_host.end() && it->second >= MAX_SESSIONS_PER_HOST)
+					return false;
+
+				for (auto& pooled : m_sessions)
+				{
+					if (!pooled.m_busy)
+					{
+						session = &pooled;
+						return true;
+					}
+				}
+				return false;
+			};
+
+			if (!m_pool_condition.wait_until(lock, deadline, available))
+			{
+				cpr::Response response;
+				response.url           = url;
+				response.error.code    = cpr::ErrorCode::OPERATION_TIMEDOUT;
+				response.error.message = "Timed out waiting for a free HTTP session";
+				return response;
+			}
+
+			session->m_busy = true;
+			m_requests_per_host[host]++;
+		}
+
+		// hands the session and the host slot back even if func throws, both would be lost for good otherwise
+		struct session_release
+		{
+			http_client& m_client;
+			pooled_session& m_session;
+			const std::string& m_host;
+
+			~session_release()
+			{
+				{
+					std::lock_guard lock(m_client.m_pool_mutex);
+					m_session.m_busy = false;
+					// only hosts with requests in flight are kept, the map would otherwise grow with every host ever contacted
+					if (const auto it = m_client.m_requests_per_host.find(m_host); it != m_client.m_requests_per_host.end() && --it->second == 0)
+						m_client.m_requests_per_host.erase(it);
+				}
+				m_client.m_pool_condition.notify_all();
+			}
+		} release{*this, *session, host};
+
+		if (!session->m_session)
+		{
+			session->m_session = std::make_unique<cpr::Session>();
+			session->m_session->SetConnectTimeout(CONNECT_TIMEOUT);
+		}
+
+		if (const auto generation = m_proxy_mgr.generation(); session->m_proxy_generation != generation)
+		{
+			m_proxy_mgr.apply_proxy_to_session(*session->m_session);
+			session->m_proxy_generation = generation;
+		}
+
+		// whatever time is left after waiting for the session, but never less than the connect timeout
+		const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+		session->m_session->SetTimeout(std::max(remaining, std::chrono::milliseconds(CONNECT_TIMEOUT)));
+		session->m_session->SetUrl(url);
+
+		return func(*session->m_session);
 	}
 
 	bool http_client::download(const cpr::Url& url, const std::filesystem::path& path, cpr::Header headers, cpr::Parameters query_params)
 	{
-		m_session.SetUrl(url);
-		m_session.SetHeader(headers);
-		m_session.SetParameters(query_params);
+		const auto res = with_session(url, std::chrono::milliseconds(REQUEST_TIMEOUT), [&](cpr::Session& session) {
+			session.SetHeader(headers);
+			session.SetParameters(query_params);
+			session.SetBody({});
 
-		std::ofstream of(path, std::ios::binary);
-		auto res = m_session.Download(of);
+			std::ofstream of(path, std::ios::binary);
+			return session.Download(of);
+		});
 
 		return res.status_code == 200;
 	}
 
-	cpr::Response http_client::get(const cpr::Url& url, cpr::Header headers, cpr::Parameters query_params)
+	cpr::Response http_client::get(const cpr::Url& url, cpr::Header headers, cpr::Parameters query_params, std::chrono::milliseconds timeout)
 	{
-		m_session.SetUrl(url);
-		m_session.SetHeader(headers);
-		m_session.SetParameters(query_params);
+		return with_session(url, timeout, [&](cpr::Session& session) {
+			session.SetHeader(headers);
+			session.SetParameters(query_params);
+			session.SetBody({});
 
-		return m_session.Get();
+			return session.Get();
+		});
 	}
 
-	cpr::Response http_client::post(const cpr::Url& url, cpr::Header headers, cpr::Body body)
+	cpr::Response http_client::post(const cpr::Url& url, cpr::Header headers, cpr::Body body, std::chrono::milliseconds timeout)
 	{
-		m_session.SetUrl(url);
-		m_session.SetHeader(headers);
-		m_session.SetBody(body);
+		return with_session(url, timeout, [&](cpr::Session& session) {
+			session.SetHeader(headers);
+			session.SetParameters({});
+			session.SetBody(body);
 
-		return m_session.Post();
+			return session.Post();
+		});
+	}
+
+	void http_client::get_async(const cpr::Url& url, std::function<void(cpr::Response)> callback, cpr::Header headers, cpr::Parameters query_params)
+	{
+		g_thread_pool->push([this, url, callback = std::move(callback), headers = std::move(headers), query_params = std::move(query_params)] {
+			callback(get(url, headers, query_params));
+		});
+	}
+
+	void http_client::post_async(const cpr::Url& url, std::function<void(cpr::Response)> callback, cpr::Header headers, cpr::Body body)
+	{
+		g_thread_pool->push([this, url, callback = std::move(callback), headers = std::move(headers), body = std::move(body)] {
+			callback(post(url, headers, body));
+		});
+	}
+
+	cpr::Response http_client::cached_get(const cpr::Url& url, std::chrono::seconds ttl, cpr::Header headers)
+	{
+		const auto from_cache = [&url](const http_cache_entry& entry) {
+			cpr::Response response;
+			response.url         = url;
+			response.status_code = 200;
+			response.text        = entry.m_body;
+			return response;
+		};
+
+		auto entry = m_cache.find(url.str());
+		if (entry && entry->fresh())
+			return from_cache(*entry);
+
+		if (entry && !entry->m_etag.empty())
+			headers["If-None-Match"] = entry->m_etag;
+
+		auto response = get(url, headers);
+
+		if (const auto cache_control = response.header.find("Cache-Control"); cache_control != response.header.end())
+		{
+			if (cache_control->second.contains("no-store"))
+				return response;
+
+			if (const auto pos = cache_control->second.find("max-age="); pos != std::string::npos)
+				ttl = std::chrono::seconds(std::strtoll(cache_control->second.c_str() + pos + 8, nullptr, 10));
+		}
+
+		if (response.status_code == 304 && entry)
+		{
+			entry->m_expires = std::chrono::system_clock::now() + ttl;
+			m_cache.store(url.str(), *entry);
+			return from_cache(*entry);
+		}
+
+		if (response.status_code == 200)
+		{
+			const auto etag = response.header.find("ETag");
+			m_cache.store(url.str(), {etag != response.header.end() ? etag->second : "", std::chrono::system_clock::now() + ttl, response.text});
+		}
+		else if (response.status_code == 0 && entry)
+		{
+			// offline, stale data is better than none
+			return from_cache(*entry);
+		}
+
+		return response;
 	}
 
 	bool http_client::init(file proxy_settings_file)
 	{
+		m_cache.set_folder(g_file_manager.get_project_folder("./cache/http").get_path());
+
 		return m_proxy_mgr.load(proxy_settings_file);
 	}
-}
\ No newline at end of file
+}
@@ -1,17 +1,37 @@
 #pragma once
 #include <cpr/cpr.h>
+#include "http_cache.hpp"
 #include "proxy_mgr.hpp"
 
 namespace big
 {
     constexpr auto CONNECT_TIMEOUT = 1000;
     constexpr auto REQUEST_TIMEOUT = 5000;
+    // sessions are kept around between requests so that connections stay alive and get reused
+    constexpr auto MAX_SESSIONS          = 8;
+    constexpr auto MAX_SESSIONS_PER_HOST = 4;
+    constexpr auto DEFAULT_CACHE_TTL     = std::chrono::minutes(10);
 
     class http_client
     {
     private:
-        cpr::Session m_session;
+        struct pooled_session
+        {
+            std::unique_ptr<cpr::Session> m_session;
+            std::uint32_t m_proxy_generation = ~0u;
+            bool m_busy                      = false;
+        };
+
+        std::mutex m_pool_mutex;
+        std::condition_variable m_pool_condition;
+        std::array<pooled_session, MAX_SESSIONS> m_sessions;
+        std::unordered_map<std::string, int> m_requests_per_host;
+
         proxy_mgr m_proxy_mgr;
+        http_cache m_cache;
+
+        // Runs func on a free session once the host is below its limit, times out with OPERATION_TIMEDOUT if none frees up before the deadline.
+        cpr::Response with_session(const cpr::Url& url, std::chrono::milliseconds timeout, const std::function<cpr::Response(cpr::Session&)>& func);
 
     public:
         http_client();
@@ -22,9 +42,19 @@ namespace big
         http_client& operator=(http_client&&) noexcept = delete;
 
         bool download(const cpr::Url& url, const std::filesystem::path& path, cpr::Header headers = {}, cpr::Parameters query_params = {});
-        cpr::Response get(const cpr::Url& url, cpr::Header headers = {}, cpr::Parameters query_params = {});
-        cpr::Response post(const cpr::Url& url, cpr::Header headers = {}, cpr::Body body = {});
-        
+        cpr::Response get(const cpr::Url& url, cpr::Header headers = {}, cpr::Parameters query_params = {}, std::chrono::milliseconds timeout = std::chrono::milliseconds(REQUEST_TIMEOUT));
+        cpr::Response post(const cpr::Url& url, cpr::Header headers = {}, cpr::Body body = {}, std::chrono::milliseconds timeout = std::chrono::milliseconds(REQUEST_TIMEOUT));
+
+        // Same as get but runs on the thread pool and hands the response to the callback there.
+        void get_async(const cpr::Url& url, std::function<void(cpr::Response)> callback, cpr::Header headers = {}, cpr::Parameters query_params = {});
+        void post_async(const cpr::Url& url, std::function<void(cpr::Response)> callback, cpr::Header headers = {}, cpr::Body body = {});
+
+        /**
+         * @brief GET that is answered from the cache while the response is fresh and revalidated with its ETag after.
+         * Cache-Control max-age and no-store take precedence over ttl, a stale response is returned if the server can't be reached.
+         */
+        cpr::Response cached_get(const cpr::Url& url, std::chrono::seconds ttl = DEFAULT_CACHE_TTL, cpr::Header headers = {});
+
         proxy_mgr& proxy_mgr()
         {
             return m_proxy_mgr;
@@ -35,4 +65,4 @@ namespace big
     };
 
     inline auto g_http_client = http_client();
-}
\ No newline at end of file
+}
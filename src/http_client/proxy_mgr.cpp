@@ -2,8 +2,7 @@
 
 namespace big
 {
-	proxy_mgr::proxy_mgr(cpr::Session& session) :
-	    m_session(session),
+	proxy_mgr::proxy_mgr() :
 	    m_protocols({
 	        {ProxyProtocol::NONE, "none"},
 	        {ProxyProtocol::HTTP, "http"},
@@ -54,18 +53,22 @@ namespace big
 
 	void proxy_mgr::update(const std::string& host, const int port, const ProxyProtocol protocol)
 	{
+		std::lock_guard lock(m_mutex);
+
 		m_proxy_settings.protocol   = protocol;
 		m_proxy_settings.proxy_host = host;
 		m_proxy_settings.proxy_port = port;
 
 		m_proxy_settings.creds = {};
 
-		apply_proxy_to_session();
+		m_generation++;
 		save();
 	}
 
 	void proxy_mgr::update(const std::string& host, const int port, const ProxyProtocol protocol, const std::string& user, const std::string& password)
 	{
+		std::lock_guard lock(m_mutex);
+
 		m_proxy_settings.protocol   = protocol;
 		m_proxy_settings.proxy_host = host;
 		m_proxy_settings.proxy_port = port;
@@ -74,13 +77,16 @@ namespace big
 		m_proxy_settings.creds.user       = user;
 		m_proxy_settings.creds.password   = password;
 
-		apply_proxy_to_session();
+		m_generation++;
 		save();
 	}
 
 	void proxy_mgr::reset()
 	{
+		std::lock_guard lock(m_mutex);
+
 		m_proxy_settings = {};
+		m_generation++;
 
 		save();
 	}
@@ -95,12 +101,14 @@ namespace big
 		return m_protocols.at(protocol);
 	}
 
-	void proxy_mgr::apply_proxy_to_session()
+	void proxy_mgr::apply_proxy_to_session(cpr::Session& session) const
 	{
+		std::lock_guard lock(m_mutex);
+
 		if (m_proxy_settings.protocol == ProxyProtocol::NONE)
 		{
-			m_session.SetProxies({});
-			m_session.SetProxyAuth({});
+			session.SetProxies({});
+			session.SetProxyAuth({});
 
 			return;
 		}
@@ -118,9 +126,9 @@ namespace big
 			}
 		}
 
-		m_session.SetProxies(proxies);
+		session.SetProxies(proxies);
 		if (m_proxy_settings.creds.uses_creds)
-			m_session.SetProxyAuth(proxy_auths);
+			session.SetProxyAuth(proxy_auths);
 	}
 
 	std::string proxy_mgr::build_url(const std::string& host, const std::string& port) const
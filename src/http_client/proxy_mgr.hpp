@@ -8,7 +8,9 @@ namespace big
 	class proxy_mgr
 	{
 	private:
-		cpr::Session& m_session;
+		mutable std::mutex m_mutex;
+		// bumped every time the settings change so that pooled sessions know to re-apply them
+		std::atomic<std::uint32_t> m_generation = 0;
 		// protocols supported by CURL
         std::unordered_map<ProxyProtocol, std::string> m_protocols;
 		// protocols to be proxied
@@ -18,7 +20,7 @@ namespace big
         file m_proxy_settings_file;
 
 	public:
-		proxy_mgr(cpr::Session& session);
+		proxy_mgr();
 
 		bool load(file proxy_settings_file);
 		void update(const std::string& host, const int port, const ProxyProtocol protocol);
@@ -30,11 +32,19 @@ namespace big
 		const auto& protocols() const
 		{ return m_protocols; }
 
-		const proxy_settings& settings() const
-		{ return m_proxy_settings; }
+		// a copy, the settings can be changed from another thread while the caller looks at them
+		proxy_settings settings() const
+		{
+			std::lock_guard lock(m_mutex);
+			return m_proxy_settings;
+		}
+
+		std::uint32_t generation() const
+		{ return m_generation; }
+
+		void apply_proxy_to_session(cpr::Session& session) const;
 
 	private:
-        void apply_proxy_to_session();
 		std::string build_url(const std::string& host, const std::string& port) const;
 		bool save();
 
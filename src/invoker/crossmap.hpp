@@ -1,6 +1,8 @@
 #pragma once
 #include <script/scrNativeHandler.hpp>
 
+#include <array>
+
 namespace big
 {
 	constexpr std::array<rage::scrNativeHash, 6592> g_crossmap = {0x4EDE34FBADD967A6,0xE81651AD79516E48,0xB8BA7F44DF1575E1,0xEB1C67C3A5333A92,0xC4BB298BD441BE78,0x83666F9FB8FEBD4B,0xC9D9444186B5A374,0xC1B1E9A034A63A62,0x5AE11BC36633DE4E,0x50597EE2,0xBADBFA3B172435F,0xD0FFB162F40A139C,0x71D93B57D07F9804,0xE3621CC40F31FE2E,0xE816E655DE37FE20,0x652D2EEEF1D3E62C,0xA8CEACB4F35AE058,0x2A488C176D52CCA5,0xB7A628320EFF8E47,0xEDD95A39E5544DE8,0x97EF1E5BCE9DC075,0xF34EE736CF047844,0x11E019C8F43ACC8A,0xF2DB717A73826179,0xBBDA792448DB5A89,0x42B65DEEF2EDF2A1,0xEF61EA953D7D9120,0x817F2264835EDDBC,0x24F333D2B21DC3EC,0x9C05D47937B35A7C,0xB0263DDA967C39ED,0x177034FB2F5D6CA1,0x792060B1E40FC4C2,0x6E3671ABA19358C3,0x1E0C7CB82F66748E,0xE231BAAA0221F57B,0x2A160FB19DDAA9B3,0x43183279AE613B06,0x71EAA0F7384D1969,0xAEC6A486BE509E01,0x16AA4E3C2A093DD0,0x898EDBE06F676B56,0xC88197BB8F2056FE,0x1BC60757AC20ACCF,0x129DE7ED6456C4CA,0x92187CF73A8D1B96,0xE87F28FD4128D063,0x56D84C8BC3CE3EF9,0xDD3AA743AB7D4D75,0x4C2ADBAAF83DA56A,0xC401B1960D35A6C4,0x302B7D91564CDE7F,0x353876FDDC0D0E0E,0x34F5E7395D31DAD7,0x6250F3FAA1D0F93E,0x6CBE32FD4ABF9B73,0xC5C39679B6570380,0xABC27367E50604B7,0x4FF8DE2B4C376BE4,0xA406335199BF1001,0x4082E7EF621D1686,0x43D69D4AAC59FA8E,0x22258A5EB34183DC,0x1F9EB85925C3ECD7,0xF7C641B5F6AF0A82,0xE7365CC791D1E4EB,0xF329B991CDE087C7,0xC78B293A5F4EACF9,0xF15249D24BC5ADA,0x329FFB0BB004FDEE,0x695EDD4AD352F831,0xEEC6E2199CA0A2FC,0xC0B57599F426855E,0x8B3770418CACFABE,0x8E1F26D6742EC167,0x6CC88053C1AF072D,0xE60D329593E7759D,0x91476A70AA1CB09A,0xD7E1DF759CD0FFF2,0x329F5E069BAF8209,0x69600B337BEBDC69,0x533FC7490FC4937D,0xAF648ACD10AB3A0F,0x37EFCB45A4F13EB5,0x48FA483FE4F18CFE,0x59E2E0637E7776F3,0x3A2C09DEA2F7A5FB,0xC0BE3854AFD77802,0x9F7EBAD31811A31E,0xCA369FBC0DE29517,0x394AFAC073E1F277,0x85E83A170EF61477,0xBF3D28CA44F3BE2D,0xD35776C4668F2E8D,0xBD618A73193F9982,0x299B36D8A0393C3E,0xF37CDE164C892195,0xBE63C0B214CC5142,0x8E4825CCACA34B58,0xFCF4655788628D0F,0x37964484C6C1561D,0x3F002AA9562BF0BE,0x37605EDCEE5D5944,0xC9695FEF4C4A96F8,0xFFB39CC82F4E6583,0x9F0C06CFBACDD6A1,0x4C016145CE6A18B,0x6F0064B122E0462C,0x4CAD907F190E6F10,0xF4129180F5858D16,0xFABB7252CDD75478,0xEAC3827244C8E5B5,0x892251E58BAE563B,0xEBA2204AAD092B47,0xAE5E74D6FA4EF0D8,0xF010888FF9A380E6,0x5FFA5801E4084FC5,0x397CF4F4C8B17365,0xE0B01E3F4FF01B04,0xD93B65D497A805BA,0x7E30BA14928608A0,0xE315F38FDD0139FF,0x996F4A3208DAD314,0x4349438F7A83A186,0xCE8A758C0ADD192B,0x16DD8628F525A206,0xDCD95AE65EFC28CE,0x912159A05BE6B52E,0xAD0D2187C5FE447D,0x75E315E7679F4F24,0x101615BBD5E614BD,0x8A6F4A122DEA1DA7,0x6B919BD9340E189A,0x8A19BA162BA1DE3E,0xABFC7C2CD8D89949,0xA6A0FE99C58BF725,0xB66A5C25E8DCC180,0x92BAF57CC368DFC5,0xFFC0556FB7074B1F,0xE1799BB6E4C1CDFB,0xA9CB3A11303C5801,0x9A7254C20CB82B70,0x3BB0DC333050E9BD,0xC47E3FF56898A28B,0x93D3C066DE3C5879,0x7CD8D024151C6CF9,0xFB7DD2B09F9CFA1E,0x166878629B365828,0x38911F7BA2D48F10,0x678D5CE177157549,0xC052348A3DF7313F,0xC023C55477474DBE,0x74378390011ACDA4,0xC897319696131088,0xACF36914BA191DCB,0x21880A4FCBA19269,0x51E3279E9437131C,0x5A0A1BD816B9AAB5,0x7D01976EF2600F1C,0x6E5F2B4C6A398419,0xB830B097D0050A2F,0xDB57B7ED2C49BEAD,0x203D79229B3797AE,0xAA4A71CD7DB4FB3B,0xF51244E6BCE779C5,0x91115A9BE4445AA6,0x938C85923AD6778A,0xE42344700E00B10F,0x117ED8E568A3BE94,0x709E956A8CB78CCA,0x7D167E642755C276,0x798A910E92BD7584,0x48A57C4A90E9F0D,0x2044128E627E0951,0x28D9C88BBCC658EF,0x4DC72C4B884A6C59,0xEECA35FE21D7026,0xB1A857E9C5658D10,0x7035CF3AB08A7AF7,0x8044961915B48136,0xE029F4A956BFCCBE,0x247C4DE693AD9B36,0xACF6553AB8A4EA53,0x7C236591DA4F980B,0x68A74A172B90D43E,0x66B137F3AE54333B,0xCA3C8048CFD52E02,0x518DFEC4FCC07749,0x36759581D0633B06,0x604E6C2DCB4B137F,0x7B35A877A492E93,0x19CC911A97AF8F27,0xBFF9D1DD2EA1B515,0x41F9D74D334CF57B,0x57FF2FF5DA6DCB15,0xA9B69A9A9C786B86,0xAE9B78A0E33292A8,0x884A5994C1CC6222,0xCD04ECE71F3A9215,0x6866AF3D8691EDC0,0x80EEE4C5880DA82E,0x8D2FEC38ED93537D,0x91044D2095108F03,0x477B0461E172D182,0x7A9F2D6596A1FF08,0x19F3009F6A632270,0x5D4EC68787718A25,0x7BEAE55022AB21EB,0x1A90E9DC88A85C9D,0x99E0ED93D0644C97,0x58438EA17EA0E85,0x443E60546660D332,0xD61294E5AA976DE5,0x3D6F33E7EFD6D669,0x99BA44ED7240274A,0xB3157976738FC0C0,0xCC32CFCCD0223A2F,0xF60A7646F4B460F7,0x40B0ADC3A86BF939,0x1A44103FB18BB653,0x64B3EF30EAA9FBA3,0x8D4B90E299F8C082,0x22A76EDE2316E9A1,0xFD61BB3B8F1CDB6D,0x789F31BC158A5307,0x8ADC49ACBB4FF0E4,0xEA65800FC08BB2CB,0xE8B33D130955481B,0x4D4012166DD4F5AA,0x9C23276BBB08E098,0x8C9AE8FF021E8F23,0x88B7E0BE68436D8B,0xE868283F11B10F97,0x8D78BCB9B0FC86A6,0x7A608749EC88F3A,0xF8B40A38F93CE540,0xE054C79B87C8FB2,0x27E2D66061E7E264,0x4294356B761DCABE,0xE84254DC19B3CA6B,0xD87145DC228F73CB,0xBE72843E382ACF4E,0x495131016E1A03BE,0xE3DB661464962CF4,0xBA0348CAAB53EC0,0x45FFAC45E551D308,0xEB7D0E1FCC8FE17A,0x2F0DDBBB402A1C2F,0xB37F7EC8F0694F4D,0x8A85315947DF6C94,0x27EC3EC3B245C5CC,0x60F1DCFB89B4F353,0x8093F3812E836BCF,0xDCC6C00DE6C4A799,0xEC62EF361B6CB976,0xBEFB80290414FD4F,0x7104198E063B41C7,0xAA3A5AD85A475137,0xFAE22BD3C12AEFB4,0xB7A02BE66E44058F,0x1FC87F78B679BE3D,0x22FC2EACDDD3CB2,0xCAC4020CCF361AC8,0xB43467C43086A6A1,0x3C6BB574B1895B94,0xBC2EE32DE886BD08,0x82E0064E4F27AFC,0xD7BAEA1C3D6BDB6,0x616C2EAE947E6027,0x1B008A010F2FE6,0x4FAAAB99FFA2702C,0x7507A74A3D963966,0x16088CC55E7F218A,0x2C7FEB8222C29D99,0x86A2BC11844DEEB3,0xFB9CF6B99A98306F,0x1304366BC7BE185B,0x5F3ABB7227973CB8,0xCD8CCE6C07790657,0xC22A1D86EFB5A8CA,0x2995BB5B3AA97FE6,0x30CC8BA35211A422,0x728E3CDB3B64DE89,0xABB26A8481225EDC,0xC876A2D0F41B79C,0x4C6BF3BC14C6F6D6,0xA6274B757A008184,0xFAE67C69C14B564A,0x65CB233333D99E11,0xCDF8A102C63845CC,0x46B7259FABD90750,0x4E7D42A9AC9E71EB,0xD3709D521B87D7B8,0xAD4EECE226A86F5,0x1E0388A9E6A3BF5B,0x1E8AEBD23A5C1511,0x2F0605DFDF7593AB,0xA7047BB729F81596,0xEA602FA4CD3530B8,0x60D61C2E8F5D9601,0xA9C10BD85DD34D7E,0xCFBD89D2F1F18961,0xA8327B614CA7628F,0x20279DB6A8C883E5,0x9DE3D932AA2B055C,0x32FA1FA41E0D63D1,0xB94570412D3EB8C2,0x4FE00B5CFB97782B,0xC5EE3F8EC7822462,0xC73D0514D61174D1,0xFAF6BF5476CB00A8,0x57BCB62796BFF290,0xC7E97C503E2ACEE9,0x8E29D89D4C88997,0xD1E84FD28D4A7B38,0xE9B1F35A218F1FC7,0x583A32C5EA5495CD,0x12E01CD1D5C72213,0x369A4B2B92F12461,0xEEDADE9115768A64,0x315A149C242011DE,0x897DF886E8694302,0x55F4E2629EABB8DD,0x71C1A46B17126AA4,0xA341ACB237C23A75,0x173751E886F8E9AB,0x4C38AD1938C28F80,0xD17268F762AAD469,0x97620981EC3F7099,0x2DB5A63C4A5800E5,0x8C0CA18CAAE89A2D,0xB3D198039DB6F5C6,0xE37AF9002E782BA0,0xC289B882CEF4CAC9,0x69D23632E4288DBD,0x2CB6AB601EB7D2D9,0xBB209150C6081BBE,0x96A32328480B485C,0x85E6A1E36B5E2E4D,0x3AA8CFEBC938A945,0x78411E34CF90EA8C,0x4CBC5D1BC117616B,0xBC886554B5888A64,0x8DE2438443E6A145,0xFCB6553111578B2F,0xA452B06E281A9014,0x9DDBEF363FADFA4C,0x4A1D1AB55229AAF0,0x97410F245819ED32,0xEF763079652110C0,0x4329E0C9A71DAF53,0x2221B1FEFEE35449,0xEDDF0C80A9EEE28A,0xA3774254665BAA82,0x1761457F86AD0EE2,0x5E5CEC33463AD803,0x58BDA5D9262F5D30,0x3AAB5D3F3D4028CC,0x8397B3389E13A5E5,0xFA4389643D1609AE,0x687E31348D8E19AD,0x1991568378B6C0D0,0x12DA57732DE5D8BB,0x4396EEBF487EDFB1,0x75C0D0B8F3E221F1,0x3089A583C66DAC0E,0xB6387DEFC12580A6,0xB6D9A8668A9B769C,0x530423D35DCB5139,0xA1A2D94E99309CF1,0xC316A4E0AF22543B,0x880E454F39FC7F42,0xB44FCE2D38FDEDFE,0x365C28B73347797E,0xF94FC0634C750884,0x7CF3AF51DCFE4108,0x3F10D56CCA2C055,0x19DB71A72065EFB0,0xF81BE163E469E944,0xD5706D462271DC4,0x52013BF2765685F4,0x9BC35A57CAC5458D,0xE2B6CB928D598CBD,0x2ABEBC4952CA3C7F,0xD6B4D02A102485DC,0xA327B87671869834,0xFC8624DF7EBA74FB,0xD49F2340555F9E5D,0x29BBAB7031C36984,0x2F0877034716FB33,0x958B9F165A08995A,0xDAC1F4368A8FB625,0x2BBDA4E1DFD52204,0xC606B0B9BA3D6036,0x327198ED493608E0,0xF5317F0839442D94,0x471C8924B79628DE,0x59EFC8EF65356E09,0x37831F682BE7F41E,0x5B4403BBB70E3566,0x82C9F945AF12EC9F,0x859FFC7F5DEC29DE,0x9A48A1707E9DECA8,0xA054197DA0CA8B1B,0x4BEFD5824C6D529A,0x59CBB7FD3D159D45,0x11BE263E767EF5C3,0x9DE997C45267314A,0x948A3D156F2E0E3A,0xDDA77EE33C005AAF,0x34CFC4C2A38E83E3,0xB56F35D8A770F80F,0x323C4A67159DAD02,0x2A09425009DAD0F5,0x9EFC1351343A6835,0xDD87838D03B64B0A,0x17F06E9D89A05855,0x584EE85BE0BFA70E,0xC62E5824404F8836,0xAEA3DA36109D1029,0x12B42434831D668E,0xB9AB3B8920F1AA69,0xB3F5D7C1E9A4A589,0x73D04EA6A13117B7,0x444069759E788ECD,0xFEA88ACF99028CEA,0x2D34ECA1A2A76C38,0xF9B66DAE101B699C,0xB07CF0F23305413E,0xD141E0743BFCF358,0x4D66F5C6B248BB2A,0xD09DCA9E9F147F36,0xDB27323F0C5EE8D9,0xD5CED097A266DCE,0x15CCE8886267624F,0x9390801B06EE998F,0x78ABC1D11B34F324,0xDDED2C93E8FD5B69,0x10B228D2FDB7AF16,0x8F72AF14CE5AACE4,0xD7C0EA10993D3214,0xE7BF6BF496713374,0xCF141FCD0940B0A3,0xD84A545408A3099A,0x9FA6E15C7A998E4F,0x9B669C0440D2AB57,0xC30B691CAD767629,0x3FAFDC4C824A6C54,0x64BB72494B9DF6DC,0x98F0D28A64EC7D5D,0xD815D4BD1AE9E85A,0xD7C2A6E5CF33E328,0xF42836467278195A,0xED7A3604521A9F67,0xE0A23567157E9B5E,0x7E08E86FBA713FE8,0x2AFB778D9C7EA690,0xD5681045964A2975,0x7F2356076C3D052D,0xB3CAD109683148E3,0x9AFEC71EEA2F7754,0x2C81A7FECD78FF20,0x174DBD3C5DB3557B,0xE976C85F4B1CF1A2,0xB2A95909624C195B,0xA927617A11A54503,0xCCCACE17B42F77EC,0xDD851254D8C7D338,0x159356D054E19158,0x148A0A307698B29B,0xB785349D98C90E5A,0xFE751F9213345C58,0xFFFF1D7E51F1970B,0x29F41DB9F1B4728A,0x7B780C491DEC834E,0xE1259D809F0A778,0x3A7305BBF26DBF65,0x68DE54738FFB5584,0xEF5DC41D990F8FD2,0x19D0C4621093F82B,0xE4C00EFAE138F020,0xE3270F1A682CF48C,0xBC456FB703431785,0xD4592A16D36673ED,0x349F973598822727,0x3968AF3046718EAC,0x5FD79E92E62966FB,0xE71B1E03F658C30C,0xE63C16EA2171C883,0x3B5989D5DB08A155,0xF20AB5C13902BB8A,0x77CDF75A783A0B04,0x82C5BFD25578F440,0x2C57A63E92CDBDF1,0xC1AAF981A4F50898,0xD511F6B5FB8D3854,0x872D985A4B3A9EEF,0x655E58062EC2D269,0x43CE6FFCF2F6963,0xBCF87EE3DC296C2A,0x7938654FF332D78,0xBF03D0685ADC793B,0x108CB90C10285373,0x8AD0D4D95EF3CE16,0xF66C0552C82638D5,0xA9B49F91B35D536,0x196704C916969409,0xD7582282E517A590,0x5EA7A06A1491D450,0xDEE33C748704EC49,0x9B92BDBE805E7967,0xF37AC65898011B1C,0x40C52C6E7C5DE51B,0xBB76112874174E25,0x5842BDBDE92FEEB1,0x668D3078E78F67B0,0x9696D418BC147507,0x5EED3D1AFFDEF57E,0xF009B83B5567CD93,0x2AF3EA0F67D2329,0x958849BB56EC0F07,0xBF807E7C66B0BF4B,0xB99978989A0F4E57,0x6A709291E23386B1,0x8AB042CB33EAECD2,0xD787990C7B67C7F0,0x806E1CB52BAD45A2,0xBAAC16D46CDF2FFE,0xB75F36052800046D,0x861EAB644E1BBA7A,0x388E6B6F47D9ECC1,0xB2BB7DF97FC211F9,0x95AFFEA5EB27D2B9,0x190BA0A3BB48F7FD,0xE37AC296E66C33AF,0x3C44EF9027A21847,0xB0325D55FDB2DD7C,0x2515D479F116B7AA,0xD4CCFE5409D13C37,0x4F5BF7798505A667,0x39723B4B969CC059,0x6CD2A2994586D388,0x4302C09C88CF5356,0x640D5D2C8DE912A2,0xD5864F7F5BC214FF,0xA0A06C514052E80,0x968E8340FCAD4826,0xE31C735DEE2BF705,0xE9A1CE27A31950D,0xAD0E20104A60B568,0xDB37962FDFC63FD7,0x48392085C5B52584,0x59ABC1F373CE1F5B,0x9136D50973A71229,0x513E63C787EE96A7,0xD96CB44D490C047,0x9CA0AFAD60564183,0x18FB9B483F8E71AB,0xF52DD7BA03015AB4,0x20A207437491322B,0x48032DB198A2A820,0xAA4406787205E928,0xEC81A0FB4911A2C2,0x5F0F4F152FB7156C,0x1C74A3A76F738D39,0xE30A5640D9F46CF2,0x6633B158164DCD88,0x54B59CE258DA9A4D,0xD20491305F26874C,0x4358D2A8023C82D3,0xF5EF5C15CE92F236,0x926C3C4443B915,0x2BDEB13CCCC78384,0x735D248F6CA672AE,0x39137FB8EE05456C,0x3835E455014EE7B6,0xFED7E3E3F45F22A4,0x22B1B0E4CDB95977,0xF2BADB0BD95BDD7D,0x37A742571A01BD01,0xCBE10A13619B9FAA,0xB9C1EC5EDDAAA115,0x77A5275126602303,0x2C9A2F8762B95F5C,0x5295501D0862870D,0x18E502A71E28968C,0x4BA5A16068183C5E,0xF13E285EDAB2D255,0xDDA4278694CAA369,0xB12880C92EA6EE15,0x8825A6E0A30BDCB8,0x7598FE4545010A75,0x91C8345B22D52DEC,0x23CB97F04154A594,0x177E5760BD4F49BC,0x2B6A03197E4C7EEF,0x839AD252B0708F35,0x46FF102DCE74A94,0xDD291722ADDCBD60,0xDDDD9D153BCF51F,0xC4ADACBD3FE3F266,0xA82578E07F14DD90,0xB3FA103AA6383C28,0xFE2EB239B608CDF9,0x7901DE0AC779EB29,0x25D5067F6C88E193,0xC0E9475F48788356,0x80933F349127EBB9,0xF4D7464FFDD56FE3,0xED65412F8B26ED99,0x9B3A50426C952520,0xB479965CBAA3EAE1,0xA7E4AA8D29D3DAC1,0x20D6C2B867DA2FCA,0xB638C6C35B6CA9DF,0x15EF8F22A719BE5E,0x710286BC5EF4D6E1,0xA4A6A6336888604F,0xE805BBAA9779838,0xC418F430F1F93AEE,0xD9E3F021F9D8CEF9,0xC9BA6D804FA4FAAA,0xCB7695268A7F50F,0xFD216000DC314A92,0xF9B18AB51CBCDF5C,0xD461826371A3782B,0x6BC87CF59151C630,0xAEF10EAFB97F5540,0x9AF94A69465A9B87,0xF293D66D4452C854,0x4240B5D04F91480C,0x256C30FDAB915E2B,0x9B8E842C8055B05,0x18C8A35E0901C0E2,0xD8FC13DA1BA1DBA2,0x2B60F53D06BC6971,0x9C22AADBAF330B36,0x1837D912F4EDCA95,0x7882946B06ED216B,0x1231218F0BB0653E,0x4A0B7E53EBC937D5,0xF74640C4B28C71BD,0xD0860FF81E162052,0xAF078BC665CCACB9,0xEB234554CFDE9162,0xFABF472ADCE66A1E,0xFE61105198EA3496,0x2F19C4305F0B8DA7,0x24CAD023099769B1,0x60A0A4CD710160D5,0xF1FEB57E542C41F1,0xAF6DC1461CCA36F8,0x6CB3106C584382B9,0xF224222A0E09BF20,0xDC01725421245C5C,0x5661708D0BBCF4DC,0x8CE598AF9875FE1C,0xD1BF9B570A0EBA3A,0x58977C73F104C1B2,0xF3AB7B665999602E,0xC87EAB233B259C6E,0x605AAC6915C9EFC7,0x18EEF6291DBCAC51,0x7C54D010A8B19CEC,0x91052312822C7C59,0x71CC7FE2C69822E1,0x5B82DD87BDF8750F,0x571A025B07823518,0x87BA8B7277ED162C,0x27DEA4A6845A22BC,0x16AC7DBD0702DC76,0x7D2CE2417CB2FE19,0x6C99356A4D3C7B09,0xA8F33BC779C28BFB,0x3CBCE367459737AD,0xB00920C3C99A34C5,0xCCCB75189BBBA6DE,0xEFE2DF6B67066118,0xDC393E3CE8A00E9D,0xC98890A6BBB9A0D4,0xCBF0312D1370143F,0xEA11FA8AE2EB4025,0xA47FC2B828F55E4D,0xD0DC0D28BA9FD4AD,0x5E298CFB85D1AEE8,0xC24FD04ED00751BC,0x9F0EF572EFEE0A9C,0x81A9ADA13F72AEDD,0xA481424344CBC893,0xC2ED3920E9296F36,0xEF1E4460FF33D01E,0x6BDE656A2A2932FC,0x8FBF3E1A58A9D798,0xA8F96580C10C5F9E,0xDE4827405E9BE9A9,0x4BEA39F9F6950599,0xF24467993708BCC,0xABC288F63B017656,0xB8DA6C44772DBE30,0xFA8B98F1023E7B3E,0x2150C2FC641364CC,0xB64F599E8DBD9678,0xCEBBA737179CE3D0,0x446BB52C35DB68A0,0x83D3CBA972660C58,0x5B54BD7ACF637593,0x2A32420E04AE5787,0x939FE19A2CFC3266,0xD54324BF37C12BEE,0xF46ECFD5526E8FF7,0x2475DDACFF83CF93,0xEE8559BBFC27701B,0x3F40AE65F056B43D,0x3D421DC31587DC44,0xE2F6FE9B61232165,0xD130E7CDEE903624,0x97AC7D93ABD65D96,0x93900D232987104E,0x77B62CAA5DF0922A,0x1B3E687F45E0A870,0x822B00714BA99033,0x87611B922B50F13,0xAB737F5FE1576754,0x3FB25645DE01436C,0xDB6AE360ACDD6885,0x859E74838FA7854,0xDCE42B3C644D1A4E,0x55002CD5D725C226,0x80A220AA99C04E50,0xCD2016D0514F1788,0x81F7C34FD4E856D5,0xFC8BFE4B41177C22,0x7C9905528EE2C3AB,0xF98CC1C0E657B6CB,0x4DBCC7D5D01D67FA,0x3D4B0DBFA0E78D88,0x14A90D05363A2A09,0x67C276550F2DBF33,0x6E470765558FCD9E,0xF76AF9D45D6BDA45,0xFFF4FB66DA549D0F,0x9B3D4335E0EDB0BE,0xAD915B5E38F323E5,0x4EAD67A3E57A9458,0x300A997AE991C0A8,0x14E25ED5E75102C8,0xDA02F6FBBDEBF43D,0x28637BDE402A5913,0xB6BF12B4CF844B3E,0x2B2ECB6F6371E59E,0x82E64DE58A6B84A8,0x58C2315AA20FAF06,0x6CEF2D1ADD6A5E7F,0xAD0F9A0F639285AA,0xD1A6A821F5AC81DB,0x90D0E0397D3F7690,0xE4833C1EFC5928A6,0xD7A7E267DEDA742E,0xCFC0C995455A6204,0xC5A566D912050568,0x8D91ADE44AC79BC9,0xF8A78594664D23A6,0xF0259D91B002AE9F,0x12C7364D43F17CF1,0x2399A6E4929050EE,0xAAB58D9C726404C0,0x4B423FAA24E8ABF0,0xAD8278DAEC2CC059,0xD1381B6E0F3987D,0xED4193081E867405,0xB66CD98548798F26,0x5E674CD80769B53A,0x88124E0D60FB8D11,0x47507DD57C93B472,0xED22194AB8539910,0xDF93B3CFAC96698F,0x4ED40BE47D8C1896,0x32CEF99C0D59B73,0xE5741C6B6539231F,0x646D07BB2D516CD,0xBD545F8729E9F413,0xE93EDE86BBB66532,0x75DF72FC74EED046,0xBD9259F686649141,0x87384D2CF86135EB,0xFFBD7052D65BE0FF,0x75A2D1BBA9D95D0E,0xA598E8A456B0A2F7,0x5DA1DE6C940D22C1,0x101C509A6E67F99,0x110821AE6C63DD4F,0x55B80B6E7AB61270,0xBE79A96C521F4432,0x65FFA94B82A71741,0xFAA48325A90263BE,0xA3736D76B0E93E93,0x592E6281C16BB0F2,0x5B9219522937741D,0xB431D60610E7F85F,0x21478251925DBFD7,0x1C2F771CDC87A3A5,0x3F18810075C77D41,0x5105BE70DEF1F5FB,0xFCEB38AB3EDCF9BE,0xDECEB0709855F876,0x69799E0840A34AFB,0x837FF265C016E3B7,0xD1426896B0800D21,0xCB5CAFF0A4A8B74B,0x13CCB1AD131C1082,0xD7186810BF44109,0x685171EED42BC4DF,0xE68E61D23A75BC3E,0xE99B9AC112F55D16,0xD1F1A906BA9226BE,0xE5E2AE8B19267B8A,0x870372B586EFB3EE,0xF6C26AE940C14749,0xB74F8EB686030603,0x642A49B0C066F723,0x96CCECDBC57DA984,0xE592D924D5438108,0x4D306DD94DD6FDBA,0x8026FC64F8CCD292,0xB30977F20556F296,0xDE55146A7765454D,0x168A09D1B25B0BA4,0xD84113E3B923524,0x365DC1E8054AF31A,0xE4DC7B3DD712372B,0x81A7F3CD719DD53B,0x837D67618BF89034,0x5D7CD709B34C90F0,0x11C125313CB8ADA2,0x5ED9595F4AC7D134,0x381D671BCFC294D9,0xB75A7F8E568F3BE6,0xDA2A1BB9D3A890AC,0x1D949F0AD44C7F05,0xC0086E5CBF13BBF7,0x5D640DD02AFD9F75,0xA2A6AE50772C4FDB,0x6D75623C644D6F83,0x458AA1A01F53901E,0xEE0BCDB1B5E36BCB,0x76AD45C3946F87DD,0xF09E30AF1B8FB379,0x68298CA6191CDFDB,0xB3B56385ECA230B4,0x999C62072AF920FD,0xCC7210A943D5E698,0x5355DCB5D35ADF0F,0x8FEAF7F0538CEF55,0xE78E66BE6EB7D534,0x44C48AC14D3C09ED,0x8473361800D1B85B,0x52528272B59EBA11,0xB2BD5837A8D3CEDA,0x4FFCA145489D86B7,0x62C438C53BB57AFD,0xC7D381E526A969D3,0x5C96CEA06531AB03,0xD25E9BDC14A0B649,0x935364B4448CD584,0x87EDE48547CC8942,0x4CD0763EB5DCD503,0x788F35D395511DFE,0x5E22EA3310AF52EA,0xB4E9A7A3A518ECC1,0x1F7539C841C2A71F,0x7AF89DBF250A2C27,0xD0F1DB0E50B367AD,0x3A4536D7E89CD377,0xF425E0B05426E088,0x3A95CBA6857C4C37,0xCF39804E8C88080E,0x4285E11B28063EE0,0x119BDA4392B5BAB2,0xDE9AC11F2927457D,0x1AB7223AC0702871,0x7B6B10D7260C93CF,0xBF861D73D95BF415,0xF88FC425EC7D675D,0x5748CF36AE9EC4E1,0xC1DAC4DA85BB166D,0x3D2DD3A02C8AA9A8,0xC14A2FED36D0EBB9,0x5145F9B426021578,0xD28214FC77C81F2E,0xF1E557B19688B30D,0x5177DCE3DD6F271,0x615DFA55885D5B3,0x20FF02ED0F707CBC,0x1F6D8B404B68A2BC,0x7C601010148C8DDB,0xD80C3522AC21FDB8,0xE226F16D30AF5945,0x77AE88CF56FF88EA,0xC94AE68759E1B3BD,0x9D23D954FF4403CD,0x66D6CECFEEC87130,0x15E1BBD4DB33542,0xD7AC50B9FB801C60,0x6A3C9A5604F9F4C,0xE59BDA10CE05FD35,0x5A91FB116578FE09,0x33D2D42AC3E42D0B,0xAC895C06C6322C1E,0x8ED7A7A44B79007B,0x1D49B6C92B9A5B1C,0x5834A431DBD4B5E5,0xD7F3495D8307C112,0x132FBDC52691A1A7,0x9C69236A3D0F1B96,0x6662B1F8A5BFA0F2,0x37419414971A4C4B,0xAD93DB374DA8B3C7,0x21B8871CE9CD1479,0x70BAF7723F26069A,0x26FA2603829F9CF9,0xA0952DE8943B17C,0x7A4EC4F532D19DFA,0x6E32AA16336291E4,0x18B384412B836744,0x378DEB95883BFE01,0xD633AC6AD3D4D297,0x6E8A7BB566D1F7AF,0xEAFAA716662898B8,0x8113594C36A951EF,0xE33015D5CE800786,0x75043178E34E4D3C,0x6DB23D1A50246D3A,0x82D6E3FDBD0A80B6,0xC8FF7E3E267EBEF5,0xE80EBC1CABE1C8A7,0x15D20F88F06530A5,0x7A491C9A90975007,0xD9B1BDDEA510CD90,0x7B6C0A0D604E68FA,0xD36906FE7BBBDB62,0x55FF07D3A2FE8317,0xA5690D702773BED4,0x2DBB2D25D50A5392,0x289EDE99827978AD,0x9A485A642AEADEF,0x94B8A32AA940A6B5,0x6B7AEB5F3D578298,0x5A3F0A3B7ECCBD32,0xCD6EB4A3CCA20602,0x249B53AB91BF9D0,0x5C6B8DD2E15C6B3C,0x9FB2D71D9CEC8B5A,0xCBBA20766F48DC67,0xCF4D7500E7DA5D8E,0x24F0ED4836CD2E4D,0x304A39EB177D246B,0xCA362C769B0F4F0E,0x6C309E623368F96B,0xF2DDA7CE028AB9CB,0x808A8ABE207631DF,0x565B95D20273E8CD,0x1D814CA2350EAA9E,0xCD4F2395AE80D510,0xABE43EB6EBE5F2F5,0x62B04373BFAD9B85,0xBDEBCB00EBC6F89E,0x92EAC7DBD5D1D750,0x6A1E7E50A4AF1FBD,0x9A7818E159C72516,0xAFA659708600A8CD,0xDF94727C5BBB298F,0xA40B513DA7201333,0x660FA55F8D417CAB,0xA334014DFD4952C,0x737024F2814ABDDD,0x38A1582CAC3F4E95,0x4BFA043D318BF9AE,0xC638DA98694CE80F,0x1F6B09FE73B99828,0x5A8C2218A9C71C65,0x5D75D30DF32ECA8E,0xC86536B840EE3AB3,0xCA60A45D232EEDDB,0x604C09F6A880730D,0xC9B695B7C0126DCC,0x5B702A5D1F2635BE,0xE8D2BD34CCB74431,0xBF956145ADC1339E,0xD7ABE01242C5B8E3,0xDDF99E38A910C346,0xD2FD15A3D9DEE4CC,0x8F03CD462437C002,0x4F2F5C4D814331B7,0x8AC0662A292C36F4,0x9C5BA0994231CF92,0x8764A5B95AE1F967,0x4E890D800CBC4BD9,0x9D27D35452DED6B5,0xCBE5AFAE59C1BB3A,0x9C091F2E9354854A,0x9E36887F0AA9DF6D,0x7B26600F66208BC6,0x94DBB0363601E643,0xF16E78BBC716DB17,0x5A0030BCCECA3297,0x8B47D286AAC499D6,0xBBB7593C7244A846,0xC9A38C22BE8013F2,0xCCE5AAE0F04B23CC,0x7FB3FBAF75E52D57,0xCAB0D2338E17B2AB,0x66ECCFB3761A11CA,0x89150F21586978DF,0x3547E68D04DBECAD,0xB8D7546CD4CFAF85,0x4E411746D4FFB0B1,0x9B1F963686B6F6A3,0x34BE4D7B1AB22F48,0x86AAD2BE6D9F7463,0x7AF299087F97C750,0x530D6F0F54C3DDB7,0x222C94B2B39C467,0x48B40FC81A85F44B,0xB6C7ECEA9936790D,0xE379C4B49924485C,0x21DA82F574DDCFD2,0xF7689113DC97142,0xF4575C44910A9DF9,0xBA0D235D624BE8BD,0x9FE1211A2B698F5D,0xF8E79D92A7C6EFE0,0x39CD1674039F82E0,0x464C2B9EE565B093,0x4FA503A6757253A7,0x209F5DE8084C2803,0xA0BFBD756D313CF2,0x991C49208F09B7C0,0xAE1965746C93F8D5,0x62830FDE95255DE5,0x60B12E049FB8FF1C,0xA536EFAB049B26A3,0xE2935008625A1BE0,0x7522B8298919A016,0xAD7E30D4E0D1254,0x748651DF4DA0A890,0xE2E1B9096BCD8C5C,0x2037C6627E628A1B,0xAE634DE5D86EE96A,0xFF1E5DCD728C42E2,0xEC4B7DC773123827,0xB891D572748D432C,0x7E763410A91A972B,0x9DC025C4B814AA09,0x426E16FFFB6D7AF1,0xDCC9FF4954D6DCB1,0xF7A330D622F9A04F,0xE0B16D14D440A7C9,0xA7DD2E2BCBD9C8D5,0xEDC9B904B870CE80,0xF7408C8F340BA88B,0xEA8732A7013AB8DC,0xA46D09CA7F9EE44B,0x6F331FADCE88574B,0xE90B81955102A66,0xA3ADA3BEDDCBD88B,0xC2A5E7DCD1900AA1,0xF5AB6155B7363507,0xE1DC9972544E4160,0xD0D00ED689D6CA81,0x38D063D8CF6D1967,0x633E3833FB96BCCB,0x81645EE95A114FAE,0xA66AC5949E305457,0xA4F67CEB594AE064,0x9A122D542F2BB60E,0x90B531766063C5CD,0x9C066F8D86A1A438,0x2BF75F235283775A,0x897B441FF18ECBBB,0xFFA2B456A81EA1EB,0xC54B91005A54695F,0xF13626F74924F72A,0xF9AAC4780D507BBC,0x2EB73EDE5BD6492D,0xE71F327DD7F42EE2,0x371531C96D032099,0xB56F2B356187E2E0,0xCE3DA51E28972A56,0x7DB4C41144D9961A,0x202024EB1E643238,0x3A525484C63925D6,0xA3B3261566EE06A5,0xAED06A53B3F23CC1,0xBB1B3BE5A5E8B50C,0x2362B981748EB883,0xA24E6A436BF61457,0xC850B483ACC98D91,0x8892E917CE7A0CB0,0x1BDD93397AF09D53,0x68BA02ADFAA2B2F,0x60E2ADCDDFECC019,0xE76A989290862FBF,0x97EC9C4BC1C0F2E,0x5949C3C031610A30,0x21564F65F997D833,0x4AE9635532D92447,0xDEE1875A0F6FC5F,0x485ADB2D2728D748,0xC003EE4BA64FE66C,0x82987E4477EBF250,0x7E732AC97C7488C2,0x9A207D2459EC3958,0xDC7D2B438B687A13,0xBEE1FB2B37222CF5,0xCB373F25B2EAB622,0x23F669E51BF7ABC7,0xA394F5DE4A5BE6D5,0xF0E0A26499BF51AD,0x2F8A75C70AF54208,0x32D86930C15E1159,0xAAE0CF56E250FA77,0x8AFA674B4DE9BCAE,0x6CC07FAD61035099,0x66AA5AE1BFE28CA0,0x771FE86D2A331DD7,0x5249247B8F69A39E,0xABCF34ADFD86B645,0x5008F9D1AD061D8C,0x9C0020A372AF7F16,0x8018AA59F97FA9E3,0x4FD2A45FD634CE58,0x5F3592B356EE3A4C,0xB7F6A8F981EF6068,0xACA69FD04F5F38B9,0x85183ED7096BA9E5,0x67A272C42918EF9F,0xC6FE351F50854849,0x8DCD9871820858E5,0x7EEDA53E80999F2C,0x976136EB2D134543,0x69F7527E6819E2B5,0x400EE8EE61051687,0x3BB0AB71DA07AD52,0x714097CFC7878BD0,0xA4D68014F63795B7,0xD1EDF428E9679161,0xA38ACCBA88BEF30D,0x76C8F25CE400DBC9,0x33DE7FF46025FB11,0x70F19143E4E40117,0x29E1B2A8ED6262B,0x2327CC3214428B97,0xA4F783C5B84288F2,0x5222710997DF7E10,0x89ACA8B99257E016,0x4FC2C77501EDCC1A,0x9EFA902715EB835D,0xF0A089C4753B822D,0x1100D0FDA8244965,0x79C9D43F3FE4480B,0xFB8F1D6097145CC6,0xF3DB862660144254,0x91A1DC814CBBB7AF,0x6171C9E04571F992,0x4081B44AA3E3FAD3,0xAB60C5CC1A3FCEB6,0xD4C0EC928BB68223,0xAE8417FD434CE2AD,0x76AF286385CB7A3A,0x29D3BA4C46972A1C,0x8735D1F8A7023128,0x20F3F547E98C23D8,0xB2F5BE72B0EC2DEE,0x223BF824658215CB,0xA315036610507841,0x1D01A8724381340E,0x8FC9D74BE81B474E,0x32A8433C67882382,0xEE38FB77BB7A9700,0xD736F4EC169C0407,0xC5F88620264793E1,0x37ED09D2BF486A04,0x23A6A0C736CAD705,0x69AFCC77DCADB9BE,0xB13A0D3DD3B674C6,0xA48EAC4D241222D3,0xE3349610A15FA0D0,0xC9C9496CFAAB8396,0xB63687B4F0E3E236,0xD2D97A8EA35312E0,0x6C91BB4DA2CAE9B1,0xF2CF182F5FDA78DF,0xDD98B34A4A3AFA89,0x26A0105F181C2828,0x63FC71162B675A0,0x414B57BC2AF5A7B1,0xC31DA93280D5F36A,0x4F35B6F682DEE8FA,0x6256A54A328A35E6,0xB18CDB475D274A8E,0xEB4A8AC9A591F10E,0xE56FEB6B12B5A32C,0x190E4141A4C4A1CA,0x5B5B2AE530F511CC,0x4E547C301F81B801,0xDD19F75405614D3C,0x51CD258B1EC7AB66,0x73F69F74011DDBCA,0x857B645DF072448C,0x7C087208DD019397,0xCB9A6C2693F6BC7D,0x1B4B0BAF27CD18DB,0x66AEB7CADFF26E0B,0x56E8A6AA712B10C2,0x2CC6B29B569945CC,0x62750FD2BDD8BD49,0x3B8EE54DFE24F06C,0xB5BD5079F58A395F,0x9BE6297091AF1898,0x182120534CCF9023,0x5301FEC6BB8F21DF,0x8177A2A9DC5BD5B0,0xA69DCC67B2B61AD1,0x4E96B177783A9BA6,0x9CFFB7009B578840,0xE1CDA05FEF060763,0xABAD28B5A427340D,0x6154AB43546C6437,0x1C53039135495CAE,0x8ABEEFFE3E33A4FA,0xC3E3C19E6844ABAB,0x4100BF0346A8D2C3,0x2F30818D75D66C5B,0xEE3CD2D847C128FA,0x8AC9895670AC9049,0x85771CA6A17CC68F,0xEF93301BC8E9BF71,0xA9EDD0FB09620618,0x8D16FC917312C618,0x3E9F81F9260D4C72,0xC826EB0F21193234,0xB8F49F9656A5277B,0x36C12D7B5744CAF,0xB16EFD3957DD7FAD,0x2B05C87E14049BBF,0xB260FC482D6B50B9,0xD07BB7EF3C9F43D8,0x8E22BC7CC1BBF7E4,0x19270EAC91F9CFA8,0x81A40A40A77958E,0xB0B142E5C2067BC4,0x989F8AD94D00CA21,0xD03F4780B97A39AE,0xFCD81108C00214FE,0x9C1E2E25111A648E,0xDF269BE2909E181A,0xC4551CF3C3F087F3,0x4E6B849A6CDF70A3,0xA2EEF7A44465A04D,0x8FD28E44F7FF2A54,0x726D5358D13D53BD,0x5926A824AF54BCC3,0x73715B38A9962E7E,0x6434E0F1FB054F78,0xFEC8EAE457274AD3,0x153AEF89004E87C,0x37E59D590865D5A,0x55A40CDFD8F6BD17,0xE01851169F9A48A4,0x83993C32C04DE125,0x28F49AC9C6000789,0x93E1EA1609ABF230,0x1A22029316A4B46C,0xC437B7DF8EEE7C1D,0xAB03CF772B43A288,0x6D268E74310FA45D,0xAF28608F1D388164,0x5713DE6DB59E98EB,0x1CB4702EAE3C89AB,0x1B3B68D4F1783EBF,0xC1FEB5766814FAB4,0x6A808266C74B0678,0x932EFF1079425E72,0x5429B2C176877208,0xCF9D3F0358793BA8,0xBCE48C8677F9824,0x30046CB0BDCE65EF,0xBC31667BB0F6F0E5,0xEB49514A4F04D59F,0x81A1F979AAA91E2B,0xB9574E68CF98080B,0xA5EC3D4652F6CB02,0x3BE1F84A537B34E0,0x8A427A89051C6578,0x4DA9E018E2F3A01C,0x9E75427EC4E37CA5,0x1258AD6DBC2FBAE1,0xA342A3763B3AFB6C,0xD7DE01DAA350496A,0x45059C350D918C38,0x6E9EF3A33C8899F8,0x8CBAC8B951402F69,0x5C483F4653DC993C,0x886C31F5E888F079,0xDA3EE68EF78AA786,0x20C160A285F3529C,0x80F87A4A3B930613,0x8960847E5FD7B48F,0x765B41E82372AA97,0x382F60C368A6D416,0x74C42E6AE0F9355E,0x7232CF6DD26DC563,0xFE602AB8B7E9AF7D,0x58DF2EDF7CB54B60,0xAFB25B9F2232474E,0x20F21369990AB23F,0x96EB2A3044CE3688,0x23DAA15014BC100F,0x15BEA5263EB7BF2A,0xA81182F96782A8EE,0xF1759D35AF2F023B,0x36AC7953BF22FE97,0x8DE4F68A9728925E,0xEDB29E4B0AB3D876,0x5AF05959A6F22BB4,0xED28B9E18E376D5D,0xA0C7B98BCF1EEF9E,0xA19744810BB29B74,0xF44F8CDAE3ED0ACB,0xE47743FF8F06F8C0,0xD1417F25E6970920,0xD314260005F064BF,0x2EE4366DBD59BB7A,0x32323864D97FCFF0,0x6CDCD138191E7A06,0x6D16B99FEB0AFFF1,0xA91A4C18A2DB01BD,0xDBCD9A6B9D073786,0x3D1B3BF5963D08DE,0xCC3DB9CC9CA34EE8,0xB750FE3C9F094356,0xDBCE37B37A697642,0x4A536D06AFED1D5B,0x5EA38B125B8B37E5,0x192A6D8B6BBD4F41,0x88F483FBD433696A,0xF3F7B05FC4684A7C,0x23F66A35FFBE3FFA,0xE6B753D52F4CA222,0x6CA3F2B87712B6A4,0xA6F779AA284EB20E,0x5DEF122A58D4F685,0x59252C070F1B0428,0xB78DC0F63757FBD4,0x330108B080A2132F,0x74BF156C860580D4,0x557F1E2300EF1A3E,0x882AEFD55B8D51FB,0xCFAD3D478C87321A,0xF84BAB6A609E97D4,0xA9A70CB35AC098D9,0x3585BEBEDC67FCC7,0xCE3E870AC37B4253,0x9004B02246EEC817,0x2EF4D786C0BC9419,0x98930EDD857375BF,0x9E7C5A44096EB799,0xE38DA3B12A4DAB3B,0x26879F0D0AF82C3,0xECDF98280946398E,0x6609A7E82612E0DF,0xBAF43CF1A42D5B1A,0x666CD06EF4DA7E5F,0x1A926FCDE89B4E6E,0x7C7F282055FB517C,0x836D2C7CBC0248D9,0xEE831F15A8D0D94A,0xF03C7B57F88A5BD3,0xF03BF645614F3175,0x2200033BCF24787D,0x24D021DE46A198D2,0xAFD4869CC7EDDF08,0xE51354CCCD89945F,0x85B701372CB0390F,0xAFF91C9040AC6A43,0xCB55C62F869F934A,0xBB0128A9D53B1935,0xA33BDA0B7720976B,0xEB1896D38B4F1DB4,0x3DA00A8D58908B2C,0xDF3F4CBE546A000D,0x8FE53A17E3B48F44,0xDCAFFD08A08087EB,0x21172E4DF035B893,0xF854E7F9C196DEFE,0x47CB3D397940E783,0x7919995BD2B8745C,0x8A9BBDEAE0867331,0xB661D6EC3F065818,0x654AFEEF256E650F,0x65662724C6BC4810,0x8CBD7E751A3A6A85,0x73F9AE5F32ABCCA9,0x92E1F6B57257471D,0x5E174DAD9D215609,0xA6DB7FC56DBDFB82,0x30EBBB1D4EDC8FE4,0x26BBBC01C3E132A7,0x2135EF5011FECD68,0xEE00DCC111704F16,0xD3D5E152F6D9A5F6,0x43244A32AD6E17D,0xC5F6E5CC785FEC20,0xC9B2F8C2BD128C2,0x8875527DD4E42C07,0xC138265FD0CDEA4E,0xFE3A52C5B7AE3101,0x787E27CA7632AC90,0x6B4FEC23A5AD2DC0,0x5C6622EF2CEA902F,0xCCC82B30A1C53626,0xBB7AD75D26AF0143,0x8020F127745ED3F5,0xB11A8AFB3C6DEFEE,0x8DB6B5124B5217E1,0x9EABCC9DA69DEDC2,0x1E528DDB9C065FB7,0xE37CD12400926DE5,0xDE4E5CC177B7051F,0xF96D051DEBF38D64,0x4ECB46EDAD7EA53D,0x17E18CDB962AC915,0x7C64D5DE5CA79A81,0x9C5AF6A77EBFAFDC,0x2DDB2996437CC59C,0x4CF6314488B07405,0xCCDB0041859B85A6,0xAAAE599E05E67D2,0x5C7E2225D7451992,0xB8ACFA63585700CC,0x6015BF83F19DAE5C,0xE4DA8A1904D03AB9,0xD54BCD3F7048BFA,0x25ABFB435E16C7D9,0x320F2F5B5607E425,0x1962888D78D95402,0xD52B1CDE8B03CE86,0xB262204BCFF28FCC,0x4252EAF1B00ED825,0x7A7782BC954C994B,0xC98870E86912B9E0,0x54CF97A068ED5618,0x438D03085FECB959,0xC36615DCBE463B8A,0x4B4E142A1E3653A4,0xBB8346AD199D9F61,0xAB3EA738521899AA,0x17EA339F685C42D2,0xA3136AD174470CC,0x32A590914F10401C,0x96DEE7666C9409E5,0xEAEB6E7D3FAEBD5B,0x25DD447A6EB3A86F,0x282D5DA1EE14950F,0x43026780D77E3DC0,0x12F78DEB1F1AF9C,0x83FBFC2ED3CA1611,0xAC98CA65AD9A3215,0x5E01B6B1F460FE3F,0x39DCBE5519BD783A,0x7EBCD400E7DE179C,0xF3D182B81172EAB6,0xFB605529038475D2,0x2E787BE7A586A8E0,0x77AFF2EAF772F223,0x7C59282918D59E1B,0xD4C961FBE468D19D,0xF394C416AB393C2D,0xC5999CADF163C996,0x511D14ED2DA887E1,0x7DCF91CE9137DE0E,0xACF853FB3F6EA7D4,0xD4006E065B0782FA,0x273F00982486DCC6,0x60D332F23943B34F,0xBD34A69071611974,0xB5DF3215F3864B3F,0x6CA7A80BDD78C062,0x74E878E9E51685BE,0xB993F5B7A74B2A85,0x4E5A3D96808F7F84,0xA4FC5B871651C9F9,0x96793ADAC5A06FCB,0xE82BC2F91FAEEAE8,0xFACCDE46E24AD056,0x406CBCEA35499884,0x3FE29AE9C01FA3C2,0xAD01710361B8BCF5,0x4E8E15513E171E54,0xFFD79EDD25B8EC72,0xF2D73E763510A4,0xF2CB0224D3BE0B42,0x4AB15E3851FF326B,0xDCB78A15E5F495DC,0xA790E8E6FD7393AC,0x134994A89C4A6F71,0xCC2EFE4B1D0EE422,0xFBA523E6F8ACE541,0x6BA487C862DB8DDF,0x570D616FD7B4715D,0x7BA6D9664C39BE6D,0x9112CCF7824FE38,0x31A0D8A679F7D5A7,0x816A63C007D39838,0x5775F8AC61C2CAE1,0xC1FF684795F27005,0x5994A2F6D4FFFE4D,0x747786364137DC63,0xDB1A0120CD3E3005,0x915CC2D1BD15DFDF,0x37B894853929BF1A,0x41CA829CEAEC6F29,0x88F53A922D4F476E,0xC5D15A335232A15D,0xBE259DBA45F2996E,0x6DA5456258FF887A,0xEC214A1AB38E0C2B,0x1BC0EA2912708625,0x45DEDB275874D85,0xEF8AE79C28640CD2,0xBC64B805EE071A37,0xCABB9B176D4BC0C6,0x32F99DF3B301AFA,0x7F13032016798DAB,0x5E0F50AE21F74BC0,0xAAD5B1BB340D06A2,0x3EC26139639016E5,0xC8B1536BA5FC0F03,0xC4C6378884E06FBD,0x4D2F1CB87CBF249D,0xF16C412C8DE5D52,0xD09188DB6289E413,0x77C721059FFCEE39,0xA306E6FD2A6558E6,0xDBEFC24929CE2C54,0x7E94C30FC8631308,0x1800980A1FBB4257,0x2BC0725CAF2E0D6B,0x5B23CA453BC57FC2,0x46787A693F6EFA94,0x8E8EDF5205B15D28,0x8349F3048B5A74C7,0x3C77232660BA1403,0xA87B62BE7F8F4476,0x34337F322B990169,0x3D634C7F6A6D4CA4,0xBFE94E91C83D8794,0x5A18938160AE52D0,0xEAF65721ACB2FDFB,0x16EC7160BEBE7A6F,0x2873B596E322DCDA,0x9F4624F76E6953D1,0xE05EB1EAE7CCDC59,0xFB193A91887FFAB1,0xEA62FB8CA7210CF3,0x8413CD3BCEEAD8DC,0x2B50C29142312934,0xB91BC43E3A58E2C8,0xF18BC069A9C882EC,0xBE923A0FDD781C93,0x61055542D9D877AE,0xB803C9D209A7C3DC,0x106F99CDCDEED9A0,0xC13AFEAFC3F7AD96,0xF8211BE23F0D0552,0xF1C26EB47E689774,0x8732C0099FA1813,0x4D05B3FECBCB8D97,0x428C32CC68809A35,0x3273F980CC5E02CD,0x89817276E6872917,0x4C705AAF75363287,0xA5DAECD045AA8024,0x55DAC9CDA320120B,0x8CC13B3BF7A9890A,0x2A3612A4B836469E,0xC802478C8862BDAD,0xA3F6143A8F610118,0xD56419CB9E15983F,0xB981254932E1095E,0x7DFE6973AE84B6ED,0xC4BDFF590B6DE7A5,0x6AEAF32EC173BB39,0xA143F1936B350BD0,0xFBDAF3DB03D61421,0xCA048D064CB64920,0x339BF323C4261E69,0xAF737D3DF3BD2AD0,0x18E23E031A9B798F,0xA1521B7DF72BC9C8,0x34864AB7DA700AA6,0xEECAD62659A58BDE,0xCB3A062F0CD9B0CD,0xDABC73EF230B6665,0x3CF9D442F2C902BD,0x4C905FB262965D5D,0x8FACE824AEC046E8,0x6C7DF9AC1E90132A,0xF0E6476CF8FDB1A3,0x594D5D0D7071B0DE,0x4C8213F2F1BE87F7,0xF42EBD7CD0682A8B,0xF03FBAFA0284124E,0xDA2127CA9B43A877,0x857F7FF8AA07F67,0xC4EDD88E2185B8F,0xA1BA8AD71EF8F11A,0x350EDDA8A9A3C23D,0x8D777E1B885E428C,0xB562F84CE9B07D89,0x61183D6239A9D7B8,0x40B5D81DD20A370B,0xA247F53580E53DCE,0x2B91B956D741B8CE,0xFA7642FA8EE73EEE,0xE38FA95DFF747E7C,0x6308A5C1C94EABC0,0xA1DFF583C8070610,0x3C6F00DDEA51A2DA,0xEDFFFD65B4603707,0xBA5BA0D4E8539C9C,0x2C5E86CEA1BE784,0x4F9B9AA859613995,0xD441661EA68E9C70,0x4BA996FCD0F9D100,0x95A329CAEBBB3E76,0xD54D26545A07FB31,0x861AC9C2D48CEA7F,0xAB1FFF93A0BBFCDB,0x4B889DE2DAC956DB,0x360B279488A775FC,0x5D3946F818C6B331,0xF7323733F48D067F,0x1456FD5C0C438B19,0xF55F62DA99DB0C2F,0x84D9FE4DB5714CF,0xFE54B8568B2ABD12,0x6A52036D51C7E18E,0x26D449828A6673C7,0x5765DD63F0ECC572,0x2E229E178F36A415,0x89FE619BFBB2024B,0x80595F890177CB50,0xDE551C7F0C84F5D5,0x82FBF1124B27D02,0xC56573D93709254,0xAA090F5FC303F771,0x6058DF029F581C6,0x65195BC76F41B298,0xC4F090C2EC0D0FBF,0x3E0E9367127283D7,0xFAE0C242A432A1F2,0xA446583E4503CCD9,0x641FCCDF2824DCFD,0xC450B06E5AAA0985,0xA4C1E1845880C098,0x51A6E4D010C4EA83,0xB43DFE4F244E0F8E,0x2213DC34A224533,0xF8D9A55D2F2892CC,0xEE0DD5760A017C08,0xD5888E94B9AE2B51,0xC0FC6E3E1A8FBF31,0xFF89A4A6580A0AB1,0xA187381CF52D87A8,0x118A68C39B251785,0x25D984CFB64ED6DE,0xA3EA82ACD0C97C3F,0x3D0BD9B4E36B9BAD,0x30E65C89EF1E38C,0x413A91F497E3428F,0x69E8B9365B1026DD,0x6B91FA4E397DAB8D,0xF42A811582CF3AE1,0xB9485211BF50817B,0x60BB8BC8FFE8213,0xBB6D152B544953A3,0x83F9B9189E65251B,0x2474C1A1D3FE2888,0xD4C023FF0817F386,0x2102B34A7006F6C9,0xE1945100CB123CBF,0x5E996648244715D,0x35CCE12EAECB4A51,0x35380F6C70B9B01F,0x19619CF6A5F4EE0A,0x6A666C5DD5D6F94E,0xD46356460DA60CB1,0x82BC6786EE477292,0xC940FB68F75D37B9,0x97F5AFA09D818568,0x29F4FA4B0206645D,0xFC14A38C4235E772,0x62E5C1180798DAB7,0x43AE50D2A33F6E2A,0xDD2294269928A9E,0x6DB41C6D84391C64,0xB54862B1B49F2EA,0x6C86CAF67357C8B,0x674C05E89511D49B,0xAD9A5C40381FE51A,0x3BE4C55385E815B4,0x7009D885379C8CDF,0xFC57ADE8D9DD22DC,0x2B742757DC68DB01,0x92D8C10950A06B6D,0x5809BD29D4D1392D,0xF25C7C5177203507,0xAE146ED24909CAF4,0xB0D3DD0BB37136FD,0xFCFCA9D377ED6568,0xED8161DA7D783683,0xF3603E8FF037B294,0xB8A4D35AE2F0B024,0xF91F060344D298A3,0x3792000AF2959DA0,0xCCF5B38438599377,0x1F3227D731DA86BA,0x6850C7B3D44B92DA,0x3C42C704473E4986,0x71D40AB8CFA59157,0xAD5E8940E3832571,0xF20DD0DCEB2959F,0xC3C7C9791CD79114,0x5026A520BB4620A7,0xF138B49165C78B6E,0x4D66E2ACA1273DC7,0x2716F9D3A99349AB,0x7F8D9D14BCF34424,0x541F544DCB68FDF2,0x4BDB60141FD6E156,0xB51A8DA1DD0D2E4E,0x9A2CEA4E7EBB6D0C,0xB8D32DDBA1727607,0x6887B244C43D52,0x57C73569CFE559CC,0xB09D42557C45EBA1,0x84DE06FB962FF36D,0x6FF69BB93DBFAF25,0x9A761B33F5EF75C5,0x7FCEE9F97020FFFD,0x6515FC329EEDD53D,0x6E467B341F61426A,0x5C2232D1A391966B,0xCD1B743BDEC39145,0xF3E3EA936C653F22,0x43F4B7E163A31644,0x33311EBA9464741D,0x4A12B9AB7A7BA5C0,0x8128CB4AD398D07B,0x69EA52C44C3F78D9,0xEA2F24FFC9F29EDD,0xC2F71CC2AB70CFB1,0x7B035E8A1D320F1B,0xFF455647AC47F397,0xD10838CEA97E4725,0x6DF266B26D6C535,0xDBDF2670A7C650DF,0x4EB223432F8FA0A0,0xEE2019295C31BBA,0xE9AAB792753A7A5,0x8EBF255F4F3F68B5,0xDCFF86AAD108A201,0x36A472841BBC9D4A,0x93FAFC10F21C7ACA,0xF64D9910FB38427C,0xA495FBDECD4BE208,0x3D88441D252699DF,0x335E0BA469D39899,0xF69CA4DDEF6E2A55,0xA2121FCB70A45B,0xA0FE5620B9E43942,0xF2095B7705BD9724,0xC8E9EF71F45A1675,0x2E651988A21FA54,0x665A7E873A6664BC,0xBC529C919C370B10,0xED8AE340A9B5CF5,0x2E4ECC451E3A3AD9,0xA18D0B8D61E559A0,0x2B627A77B9FC284E,0x7EF5C276218594E5,0x7BD00A82CE7156C1,0xB38A588ED5C50BBD,0x4E71BD4E0B8022F5,0x9AADBEC7664AF43A,0x3BB39BA279D65666,0xFEF57A04955B7213,0x46B70532CC643751,0x4B82F311A9427C3F,0x9544C7327A08C661,0x54BD99D8318FB02A,0xABDAD35D3277104D,0xFF7D32FE4F34D7DD,0xB418E0AF8C61B56D,0x216940DBDC6A74,0x118B88D02A49C812,0x9E7C5ECC7DC530D0,0x2DD8C72847DFACDF,0xFE2A21CD2B0A3547,0x7B1776B3B53F8D74,0xDC38CC1E35B6A5D7,0x701919482C74B5AB,0x38B55259C2E078ED,0x15803FEC3B9A872B,0xDA185E42FEAAF76B,0xC5A80A9E096D529,0x3E13E4D6100E6A83,0x9716F9F525C4A03C,0xB11671B812399BA2,0x8606422BE9CB6EFC,0xACFD9F78275919B3,0xBC6E3BF0E1E57442,0xCD644A03314C3DF9,0x4F44B8341D970185,0xF45E267C70ACE01A,0x8999FC36EFA332BC,0xC0BAEDD9DE7567B,0xD3F7CB7571AD8BEB,0x91A048F886524873,0xBDBC487A0347C2C1,0x1E80216570AFBFC3,0x470CC97DB37CB63B,0x915FA95E87D33FF5,0x6C978B200DAA54DE,0xE58D20B611F7836C,0x2AF77E50375C922F,0x7946F7681E9E1D79,0x4D9174D8796EA622,0x4CEC1EF3DCEEDD1C,0x5AA183DA1344935,0xE7DCCB6BBE933741,0xD3F2DA22950AB7F6,0xB1A3B2B046340845,0xB749E51D216834D8,0x4CB2BC42A53598BA,0x437E61CD71AF1EBA,0x9BC444D671469DCD,0xB4CD52D6B8305BD4,0xBFF989187F281795,0xDD222CF39CF79FE4,0xE5E00092E71FB6A1,0xF937D4DCF9CC1CF7,0x4E537871D44AC56E,0x7BB49823B96323C4,0x3F85C0CA5FE1527D,0x8307BFA58BB45ED9,0x2FDCBFEEE3E1CA38,0x1CF551BF1611A6F6,0x26CE50366B7C2760,0x9A6119E875538DA1,0xB91865281BB9451B,0x2EE7F7571D5CF4C1,0xBFF5E63E718E2059,0x6462E92135CA5CC1,0xA5BC2689B1DF62B,0xD86E372FF627C3B2,0xB6249BA74349F6AB,0xE869B507D3624306,0x5412721BB04590F1,0x74484B0C0972EF8,0x97A3FD175F8D720C,0x77B8D5FD0CF3258F,0x2D43CD41AC3330E1,0xE1A5C172B921BBD6,0xA3DF89A2303DA964,0xE72DC686E764EE0F,0x86CB46F43269108A,0x1D16BFDD94C0AE8F,0xA6B472383DA6AE23,0xE98A31D3C1927ED6,0xCC1642C4C1CE902A,0xDD3EE6E5E154DB78,0xEBBFE40DB22B29D2,0x20D7E34C22DC60AC,0x694DFE6467A01AAB,0xDA24B54CF6C0E8B8,0x39E7796CCE4DC681,0x19F42FEE708FB281,0x11FFB143F448979C,0x283E9A39F4EE4D14,0xA9CB5BD48046EF42,0xF8EFC60132F8109F,0xBD166E025AF0A14,0x5C381D09C558ACD0,0x7F29E8664304CDA7,0xF111804437599169,0x622323CECEB8593D,0x2BF2F8E20C19583C,0xF42995E2FC0559E0,0xA23AABF378361F85,0x8B185FD7C0308117,0x2A253D5DC7CA1CEC,0xB070F32F5FE88A2A,0x9FFBD1A17AAE3E0D,0x12022943BDF6F088,0xA95E5FB2D27EECF2,0x294B0261C20A78E0,0x97246390EF16DFC3,0x1DC460B8E8F5A142,0x8BF557F9256B2A6E,0x38236280C567C045,0x7D2CDF366EDD8ADD,0xB70C73407E942734,0x97A631B5F81A6197,0x1F6CFCD52206CDB0,0xB849529ACBFB3D85,0x4B7DCB210992A9F7,0xF8A8852F99E201DD,0x1ACA339FBE1A59EA,0x10D289FA72A25777,0xAB74A6FE5E16479E,0xC69E0125145BB58A,0xF8F35890F43ED2AE,0xD29996371F9BD0FD,0xDE69E5D63A1F57E0,0x6E562EEC4008A0C5,0xA88C91AADCB02A8A,0xDC750660004ECB83,0x2EFEB897BDD17B5B,0xA491B07310DC58BE,0xCC3ADBA41991FF4E,0x92EA98681B1610F2,0xE171121A3A25363,0x57303BAC3E5DA035,0x74C1590CC91B3930,0xBBB6D0F765409642,0xD0B0D1BD29678350,0x75E4D52830820775,0x556019E7EE8EC9A,0x98915B4A834CE874,0x87B6357C65356CB1,0x7830326EF9D54DBB,0x91398220755C14BF,0xBC9CDE5AE8D32EF2,0x907994FF361E5295,0x62BCE536D41AC07D,0x9491D4E34E4389CD,0xA047107933868D4,0xEEC112F70F9E6543,0xCBC55350FF75F537,0x8B8D24263DAB0736,0xD3EBDA853981B983,0xE849FB3A0C73A0D9,0xA5C49FC956688050,0x79D5985D0CE1880C,0x1C8E9BB989C1EEE,0x9AC70C40670AC02D,0x5F6AD54378A3995E,0x2BDB03D2AA09D565,0x3A05653FFCBAFB55,0x28458D567A56CEFC,0xF7F5C49BCD99E28D,0xED06F75C0AB45AAA,0xC7CE1F723246133A,0xD0EC006D02DA188E,0x6C123E50989D9F3C,0x8EE7901EEE84F67E,0xA7D416B098808337,0xD0DC425AC19B966E,0x7B661ACC29FA795E,0x7F2A9FAB60E93DB0,0xE90EEDCA654B46A9,0x8191C51F9DD9189D,0x994B0E18137346ED,0x148785E497902C88,0x8608526719A575EE,0xD676FB5DAC59FB72,0x6F4C4DF60C52867E,0x546238515F929872,0x3B9F35917EDE3ACB,0xE6AC149D1121535D,0x925970A93719CADE,0x3D2EB53CF281A77E,0x7EA65A7D5C6CBDB5,0x9FA91AA1AC724CD0,0x3DF0567938549C05,0x1C18D23E19C76212,0xE68815680F90E0E,0x7199DFD024AA24F3,0x1C49F79FA808A72C,0x6304FE01A952A1ED,0x1ECA72F56ADCE605,0x1BB362CAE190AD06,0x3A4500FC2B94720A,0x41DBD10907A5CF18,0x801039B3B8E28F8D,0x21EA3DC8C16770EF,0x2918C30E34ED2C88,0x1F1A910C8AD5C453,0xC557C842E425A746,0xED2E53B1A3927830,0x60B554F782F2E6A6,0x4DC8DC4C28B3BADA,0x79C890C56ADBF83B,0xFD5A87843250F1B3,0xE38A58649E049502,0xF286E683D1E1F101,0xE0F4EA3A654155A3,0x9E392E2DB654EE0A,0xA21EFB60FCA3D0F6,0x4EAA4126FEE56C40,0x239D73A1DE006629,0x2D213D9B5D0FE42B,0x88791F880F624022,0x43BE2F49C708E7B4,0x58A3B74F26D2B532,0x2D6868095BD2DF64,0xB39B9674B1E9D097,0x5D2587098D2C9CEF,0xA3F61E8395582E30,0xE8B5A1B75D8BF700,0x2CA1243CF0209F78,0x1FAABAECFD9A7C83,0x716752DE8ABA2F76,0x3C7E67D89C37CDBA,0x18DEB87CBCBB1C35,0xAC4F34F6299E2289,0x92425F5F9A2DC557,0x2E7312742ADECB25,0xC425B6AC7F4443A0,0x65D8EA648927792B,0xF9CA39E1CCB8EA1D,0xDD9996B22AD9179C,0xA9D04B4275939F5,0xF12BE04302B5836E,0x3AC92E39007E1D09,0x12BE8EA03391694B,0x312CA455A59783FA,0xB68ECCFF52582B84,0xD4BCC7D6BFB4EF0F,0x6D47423391C7C131,0xC540300DE977409D,0xEE3C332799057645,0xE6FCB8178DFE489F,0xB7C3B23648284A54,0xC05F48B1C4FD8BC9,0xB5B278F6D1EBCD53,0x1DD05E817C89C737,0xB852B0BF94A8DC1,0xEC235469207D1121,0x8034325BF6D6E41F,0xD2AA6F822D3A55D2,0xC5935DFB3F39785A,0x4AFA59A11CC00538,0xB1EAADCB692D69CE,0x1C23EBEE3AABD4C7,0x81AB70B3FE98F1DF,0x1670C66FA901C0D8,0x42CDD13001C98400,0xD1AA84345B760931,0x21CDF75488EFB98B,0x4964D7A2BFD2F9A3,0xED977E2AE2CB16EE,0x20A3B1C2EC4167BB,0x97BC40FFA2FFCCD2,0xA2DD309FA5FD1435,0xC14F2F615169363F,0x148F60DDDBC323FD,0x298E7BBD04F29848,0xB0C9A0F9AAEB7F0,0x8744D2E3FC95740E,0x70E57E9927B6BA58,0x4D16ECAA05186DFE,0xEBC91D4C68FF5260,0x7405FEB2AD8926AC,0x5A3D7606D599F99A,0xD7813C7A74CA9AF9,0x2094BC4B6731BA68,0x4FEBA5060BFD5111,0x60040CDD28AA1BC3,0x6F3435F85C932A08,0xBAAB54D57B40765E,0x55F7AC4B2B875901,0x8B0110C1F1D9D177,0xEC73DFE5CE55E19C,0xE0443EB1DC8A2F79,0x20D668730B14B5F4,0xDEBBFB8E738665F4,0x810E39899814611D,0x9969A63702BCDEFE,0xDCD722759F93678D,0x45E146165ACF587E,0xD13237BC328B938E,0x51CC1333A10C4E09,0x69A4491104E14366,0x281BDB37010064F5,0xDFA763BBB6D72603,0xD9256F7FF1791115,0xB8F3F7DA0F3F93F,0x51F06E07524AD20D,0xD43B9D1692F5C06E,0x72B1E2693AC30407,0x31E8D1058586E006,0x332262819D51DF61,0x40AC02FA167D4D0A,0xC83C5315C571C2FE,0x869634E57B4F3343,0xC372A80C7719DF28,0x4C6A124A4C49BC22,0xD1CA4C3A111D9BBF,0xE3BCCCA3244EDF82,0xB0B88048B5914A7A,0x46150A5112561134,0x9F4AE9BED29CAFA0,0xF7F21AEA9B22B838,0x2133FE32510D05F7,0x9012CD429E55212A,0xCA08FA2F9FE43B29,0x90168A0DE18A7F1A,0x81D4D874CB1DFBE4,0x16C990F0AEBBC7A3,0x536257A79D7C865A,0x8BDAC9E7F4C1D9E5,0x4BB54FF089A08B44,0x46A69DE38863D8FD,0x9F57DA3897B26EAE,0x80152C0ECDC471B,0x7DE5CD18CC7CF0A6,0x8B27A086F4268F56,0xA934E5D7EEE03C7E,0x2D8982A81816E618,0x5733B7E88AFB2E3B,0xC93BAF616F1C680F,0x50FB8785AFA2D59C,0x3C273019E2F3471D,0xCC1EDB9BCC914639,0x8D57FA5F8F95730F,0x58B5B800DED763EE,0x94A7730DEC6E86C8,0x204E68849C425DF0,0x1156728DBCB1F3B2,0x4721B5E26C8861C8,0x38640D2193CB547F,0x1B79E937E91F40C3,0xDCE96FB47C1D0314,0x510D0699BE9C6D06,0x1D5CD3EAAA7422B0,0xD83D7629BFD65725,0xE94C7FA27FEB00DD,0x7A082DC02E5E00C1,0x9F8FB43463B75A3D,0x8EC0BB480F11446F,0x8C538F7B2B233B2C,0x17D830B00DB4A9DC,0xED2558D599937EFD,0xF67924A428A734EC,0xF20EF02FBF173C32,0x398315D0C90DE6F6,0x5BF86E66F9BF0BE9,0xA646A9FF47E2E515,0xB7C4B23CEF2B3B58,0x3B880DE16766E9C3,0xFD5A25A8B9488D42,0x1226C55CA7D2269A,0xBA1A956D36B210F,0x761778199FE1211C,0x32BC1B96D39D2E38,0x1EF90593EF09F7FA,0x74C1828126652223,0xFF449C9B68734F2B,0x6823557BDD18031C,0xC5D69BE0998EF509,0x716271729B9FB8E6,0xFF692AB7350A74D7,0xD6F9DEE4765092A9,0xA2ADD4A27CA857C2,0xA11116C8E2E46ED4,0x8B5B2BE72A7C0CF6,0xC0DBC28967D7BE19,0x8CD9B5E60B98207A,0xCE366B3838FC5CC5,0xDE4E7D1D52BD4533,0x28365F67ED751FCB,0xF27998ADBDAB9049,0x7F0D18D1F5BF6D0F,0xF6D8C7059C3C2495,0xB2E86D4871B30979,0x2FED6B8DCEAE8D75,0x356BDA6BB9847878,0xE751ECBA8573687A,0x98E393364463951A,0xAECC5FA98C879D67,0x9F83BF77C7204C05,0x1DBC8A6F227520FD,0x4590C086096F07D8,0x8822ABB8DFD960E5,0x2268617D0B5A5B35,0xF6ECB54A7941386F,0x114ABA9988FF784B,0x1BBEB35757ED1961,0xC5C8FC4D42BFD749,0x446CF90BF0024020,0xA2CDB686AB549D8A,0xB6F769D890A34B99,0x7E1CF25229CF544D,0xA40FAFA53DFF4362,0x385F74AF4024D51A,0x93C679A3AE20C964,0x3C17D57F8A1F4336,0x929D7CE0F2CAD21C,0x62FF4ED33C1328C,0x70972D3D43C1B5EB,0x29926EE43ABCE454,0x2CEFD365B46A1DBE,0xC05BEBBC3D252F8C,0x2714FB94E6EAC372,0x648D295A649ED2C3,0x54DF17092B1F59BA,0x6C29B075C8530441,0xDD7F149F8BAF1260,0xCC1C92F7E1A3CE9D,0xB3BB215FCE55E6A9,0x874C935832B2AE06,0x70DA4F87B396F9F9,0xDD121F61016F3CE0,0x3D09B44C2ACEA592,0x5BA108AB15E668B7,0x399A3B6D30C64629,0xBF2292E4C98122D5,0x604F09F8F9DA5404,0x6991BFCE3D87261B,0x87EDD05291B7412C,0x78640FB2D4298B2D,0x3989D4F6D95B3DBD,0xA0FA113A187BAF0D,0xCA7C80E031F9BFD2,0x9049EEEF48D81A2F,0x311543257CA6E66E,0xB5B917AAA3DF1A78,0x66D844353F51465F,0xC9F6150424259965,0xD4DBCC67CA333F7D,0x812812F60647A0F8,0x9A6987280C48639C,0xD3FF6AD07BECA69C,0xB111CFC87C576C1C,0xDB96C28A65D345EE,0xD7186A4A316964F2,0x6625908717AE7808,0x5FBC5D27DD8DFF61,0x986164755D8E9A93,0x28CC6EA9A96AA5D4,0xBE01072D0E1EE6DD,0xB33FCD685BC4E12D,0x2AF25F1F08FCBEF6,0xFE4FED766438E0E,0x3C6FB3D7478BC495,0x5844B0328AB76BBF,0x74057F606033EB70,0x81B15F40AAE95932,0x44182C1D103A97D2,0x305739C2F5BFA5D9,0xCFF30C6181F9B8BC,0x66DA7155B68E7638,0x43FB09E8020180EA,0x541EC9E98C2783B3,0x8CB5613E14D44228,0x324833E4F1D15D2D,0x93F26D866EFF997,0x6687A6579389884,0x35A960C1E2064D55,0x6966C09904B48D54,0x7F2AA4BA999DE234,0x353BF8D85390AA39,0xEA00B3128DDC34A5,0xBD53F503C46AD430,0xF27FC86E347471F1,0xB691EC20AD2A1AC2,0x76CA59C648318506,0xD4930C902E5CD6B6,0xDA91D9D96ED0EB8F,0xE971F2F7312DC1FB,0x33F8639DDBB019B4,0x52E29231F896396E,0x53A5BC0515A038AB,0x666ACF938032B583,0x11E6F86BB2700BFB,0x35E6F04FC81C5EA2,0x2070D32BEB6A3825,0xB0DAD631C6A2A5EB,0xF3098F5B044D6CE,0x3BFC5030EF1E6147,0x588D1FA610887CFD,0x7007C113A8466ADE,0xF86F13F66FC06EDF,0x1AB062C44F06F033,0xD7F2FC1281F868FD,0x129E6CC3506106AC,0x5318F44DB7A13F50,0x4DDCC681612459A6,0xA818A2A38A2A3D6D,0x7B42AC66804829CF,0xA53470336C143CAE,0x71673481F07D6434,0xAB154BFC15F33733,0xC4A706CAFECA1953,0xF0F077286626CEBB,0xEAA437DE2A801E8A,0xBA4583AF4C678A9B,0x8BAF8AD59F47AAFC,0x531FF8BCC6FFD9E3,0x5F2E2CEDE90F627E,0xBA290C9390813C9F,0xA0382000AA987093,0x3CA646A848A5F334,0x6B7EA0158D00C600,0x78C4EBB0251847E2,0xFC75D88023832ED9,0xE2EDC80BDB9A514F,0x453DA8CFCDA69D26,0xBF3F90E670404C44,0xF3D5C578ED6C7528,0xFF7028E54EB0EA84,0x9764C9C63439A2D9,0x20B0BCFBA94C4732,0xD974CD3A050559FE,0xCF33DB366A4071FB,0x289AEE012C9C5F5D,0x263FA094C828FD3E,0x6DE386DA26D363D5,0x48BDE4C1BEB65AD4,0xDEC275C3811D6AD8,0xFA6A3ED1D3AA4BD4,0xA637EDD71DA667DB,0x90D1A8814E85B166,0x68E9DB185164504F,0x2147F6D06CE70F1B,0x17137CFD42927BA,0xFEC8CAEC2F9A60B5,0x8DAD1FB87B248966,0x463EA8B3DD0A6567,0x648740220EDDB123,0x411B5B7270967776,0x9CBD6E7B088910A1,0x565823C8D4F7B64D,0x98F030F49971616,0xB0490531FD3DC629,0xA737C76A9908948A,0xC585DDBDB453BF48,0xA27607CE04D875E6,0xDA91B00799F1223C,0x265D164F770DA9AB,0x273A6B01207A9FE5,0xFC6FC18CC3214743,0x6B3C9FC090DA905D,0x1D8AF8B06B2F7D3A,0xD96CCBEFF9394523,0xEAC14C370D2B9D5C,0xEEE7837FC8CEDEDF,0xAA3D72C5CCFC8EF3,0xDB31E3DCD4EC4157,0xEEF9D0725B6BE1E9,0x429D9B81D13F3456,0x1B850AB8481A78C9,0xCFDC32D2EF467A52,0x31F0EC70888E1490,0x736F26192289EEBB,0xFED8EC9FDD58021A,0x4D10D49AEE7C9AEA,0xC972841F26BA2800,0x817A1EC3448E9FF1,0x830CE9F43780AC92,0x190378368BE7EFF3,0xC547D1E965980C5,0xD374BF034B7E27F3,0xE36D9E1EDE0E76B4,0x237E99388DCA3CEF,0xFD5431F2DAC6AD75,0x30EE7ED666906E6A,0x2AF3C8E8D2120D10,0x4247915DE1F30269,0x22A4F417AF7EDBB3,0x1C3E529B167B0152,0xB7FF64F7F3C11C73,0xBA39DBB52E8B4335,0x183CC5B7D51F8C27,0x95508E1DCDC31638,0xB7CA0141AAE24858,0x543B2C1410A312F3,0x94F7718638A3525D,0xF8E5B0C984357B72,0x8692D3326B328B82,0xE1037BCF8C2FC81D,0xB1C4AF1EA46263A1,0xFB341836D41663F,0xE57ED256E47D44C1,0x46A6A8998E3D8C20,0xADDD87AAD0952829,0x9C94CA5701190287,0x69071D15F1FDD00C,0xAF5E4A6C74DC312,0xF299749D63CC7167,0x231BA68A82FF0316,0x46B2ECD9DD5C325A,0xE2A7BB72F7220C7E,0x1BF8BBFBF0066C79,0xEFA7F7BEF6727E05,0x6409DA98EAB29EF9,0x5B01531ADF19BFE7,0x872D579FE9A001C0,0xE712829A13AA007C,0x71D67D692ED4A77A,0x2E2FE70D24958511,0xEE1CE55E7DF07D50,0x2E361871F6DBB0BB,0xA0BB8B5F3BF0B873,0x3394F4E239C12E5B,0x5281982126ED6EB1,0xB191D6DA6D08B82,0x510FA24010D2C6E2,0x93D264A3F6B3EC83,0x28DAC40D73AD61C,0x47E7DCF167AAD291,0x3805A7764BBF4986,0xA8C662E16DC4030E,0x390F7605EEFF27DD,0x38B36DE4A0DD8551,0xB18702619A0C0E6E,0x2896F1C9B1221336,0xE7F56AD8A71AC4E6,0x770EB7A756AEBF26,0x3DFB797B5A3B9923,0x91F514ABD264DE39,0x8D54F66F66BE0AA4,0x5ED8FA0BD19D1554,0xC093604219A86052,0x3C433641FBE9B092,0x2A073933B945C84D,0xE3BE7893C3C3EC1D,0xD97AF335F8ACDB0F,0x75C19185BEAE4AA9,0xFCCEE4DF574659D5,0x34CF401503972D8,0x5457AC60E3138BFF,0x17723C8F38B28C26,0x473E72253CC49698,0xBB8D17D4C5954DAD,0xD8F9465B2186C59F,0xF0E83DAB719BAF47,0xE6BD97EF8B376DAC,0xEDD28D3FAFE98806,0x7E8D3E1CB76D4269,0x773A6B5BEC33A424,0x5ACC4ABDE69D38D4,0x1DC31E2CC59D9BB2,0xCD042AEDCC67E05D,0x4F12D7F9E2049590,0xEC25575B0C446336,0x4A920AB6D0B69785,0xEC8A7DFF32FD54B9,0x6C12EC99A95B5DAB,0xD4C7A8B7798F8D76,0xE56907D742FBB98E,0xF703ED783A4823FC,0x81817FDF3227FB55,0xD387AD5F69E5AED7,0x47CF1A8941FAF477,0xC190A01717631220,0x997FC0391BB433D7,0xAC68FC3E6CBCE6FC,0x4EF4490FC3B90AD2,0x4EFA5A2F877A4580,0x487238BD4D444146,0xB69E368585E687CB,0x7C551A8AD8F364D6,0x96861731FED0B20F,0x6B149894691C7CC8,0xD0D235D716CBBF3A,0x2AED47655EBD41F9,0xE9B35F4B3FA183CC,0x234A1A7A21B287F0,0x6690522491F2B7EF,0x835DCD1C2346F3E5,0x4748E1ADA6271630,0x26FCA81008B87FAF,0x74A9433D624A129B,0xE9BEC9AEEBD10172,0x7AB1CE55FB991D7E,0xA813D964741A08C1,0x2119E194E1B27356,0xD31BD6FE1E51499,0x239899C7038B89B2,0x9B8D5650AE5D3E37,0x5D9F9E16048EFF63,0x90A6F64158BFDC6,0x19B6E06EEAE42FD9,0xF031AD8A21A8C1A0,0x6AAECCF5BAF1E393,0x514D80B09AEE6358,0x7544F7A9D8A06A08,0xC19533F1B83A7895,0xD22ED94E238E6212,0x147D45A959CA40D8,0xDE737A0063E49970,0x47051CE8E3FBF361,0xFD08D543F04B5AD5,0x1B7FCA28E35CDBB0,0xC7791AFBC3D6AAD5,0xCFCD749D4E341FD7,0x76B1F7266AE121AC,0x80D494C63CA32BD2,0xA32B695D90B1EA0E,0x90C7361D0621A3B6,0xC1248D942D71375C,0xE01ABEB9E2CF42B9,0x8091E3CC1E619B39,0x1320A36B594CBEC2,0xE31A6007C811856C,0x177CA8EC3BEBA1EB,0x679A4C47D3A0A4B2,0x1CB79849195B4445,0x6720272CB53DBA48,0x5CD8E37BA3CBA971,0xCCC74177BFE27AC9,0xA93B2B393E4AAA20,0x771C72551EE0BD14,0xF7449BB82D5A6055,0x4CA2FD73CB528330,0x80B2A7374EC83539,0x635D6A4C16C8B427,0x4D7CE2298CFF7D42,0x75BD55E6AB869CAF,0x8F5EE908F5AE9BC3,0x86156182084D56A1,0xC72D28E5EF1107CF,0x6AE6C5324BD6DEBD,0x2F7D409DB8FCD57F,0xC7D8414269660FC0,0xF5BEEB8BA669C558,0xDAFEB0418AF8DAF,0x56EA8C6ED5821F2B,0x5F6D2B7BA40483E7,0x929557FEA326BBCC,0x6B07E1D996A69ACF,0xC57A6CADCEFE5089,0x9025AEE080F84A1B,0xC46CA38367F16578,0x360C31F0E45DAA5F,0x110068A07EDA9FBC,0x4FF0B515E4C83097,0x3F00B9CADEE8EB3D,0xD85A55A2B60E86C9,0xC28FC39C693BF50B,0xE4A2A5E5455654BF,0x416DEBEC2AF19312,0xDE5641418FF92887,0x22F6103D7DF1811B,0xD568567F2142F0D6,0xE073EC11C22D5CB5,0xCC4DAB4ED0FA0069,0xFF9E4D74FE360E69,0x6F19DA0555AFD918,0x23832C1A8C99748C,0x58F5E56CDD996880,0x217CC1BF55D59C44,0x65093A8F4C502F7F,0xE05D60BF50DB8652,0x4BB8B039E0467D33,0x814E3AEA72604174,0xAA8EDC61C1A66D69,0x397B2F6C8F2E3FB2,0x2E90F469A6AC992,0xA5C6A0D18EC0D946,0x9ACC96FE8469BF29,0x2B8A3862BDE6737C,0xD8D4BFD9BC71E9CC,0xA6CF99057D1A4B2F,0x78B315C577CF6D01,0x1F6D32912DBFCEA7,0xC919F00C1EB6628,0x7295CAE6372986E4,0x4BEE133765D6015F,0xE285C20435466381,0xDCA98A271D0CC516,0xB413CA811F506DCF,0x45D4863471811592,0x5836433A62D1A6C4,0x3D20F4EE16939AC2,0xF3C2DA93952477BC,0xC514E0BC5A9C1A6A,0x883A1BCBA56D5FBD,0xC6B8A83CB698802E,0x3FA880262FF79243,0x84A07CA553A4F9C3,0xE16238C3C62697D0,0x7A3449D1CF40578C,0xD378B386217DBB5E,0xC9F128BF7D93196,0x16FD73B3F4345670,0xAF64B7223D9E0FEB,0x9FF64089E5DAC313,0xC8EAF995510A953C,0xD10B64D006F40B14,0xABC3E4AF7CA40513,0x901A291369C59088,0x5EFF344D2CEF49DE,0xE521F8F950FE34C3,0x29F36537BAC3D711,0xA19C2545709CF8B5,0x566ADA7FE6D2FFC4,0x59DB49C02815273E,0x2F5233FB30DF57D5,0x682B3A2CFD8CC244,0x2ED93149B4CC68C1,0x92473EA3E0FD6C3C,0x3398D3F6736CF301,0x50EE547EE5B116FA,0xEBDEC0D7E92D20B0,0x61D4C8F1146AD04D,0x87065E48A6ACAF50,0x583714F99BC53894,0x4B9D927C4A4FB9DC,0x9E645A15DE54B5EE,0x7729F2302AF3353,0xFC7D9950A581B4F3,0xF4E49895EADECEB2,0x95F1CA5C2CE2942C,0xD00BC7FDBE039771,0xCF0625D5D2A8F298,0x4D488739F6C82163,0xFFE3EA612616D334,0xDA1798FB73681E87,0x1D83165BDA8DF7FC,0x8B7BEFF3C8EF4B47,0xB01E58326A51EBA2,0x8D6321E6F1CBC69C,0xFF1266444C9426B4,0x6EF8DB87205D57FF,0x3BE0A37C527AC2C8,0x6948702511126852,0xCC69EE39119A150C,0x2416BBA9A9F18EAB,0x14DF63D0BB614642,0xCFA8FE5301B9E6CE,0x2656226DE9A2C644,0xA4457A33AC118B4,0x39D90796902DFED4,0x9657D8B784593A5E,0xD755F13556CF7C9D,0xC026E17CC4E7BED5,0xEC9101A02CD98A8B,0x8D2A2025E94588A1,0x733EB09C30E2BC1E,0x5E3EE3B0D24ED146,0xF8BBC07B8BA14ECF,0xD16E87370ADCE88C,0xA1243621982D87,0xDD0F567A35809C42,0x4AA32C25ED6D69D,0x5B46189D0DA97DE4,0xE8C7135747EA3054,0x55F006B9D4A46C1D,0xDEA273D5F8A9661A,0xDCEF983C24191997,0xF8332B06F0EECC9C,0x8C7E8D6F96C9E948,0xED1B407BADA42CEC,0x95CE79A6939C537A,0xD687100F616163F4,0x2803B027479FB640,0xBF7B5BB7ED890380,0xE03B9F95556E48E9,0x227D0C27EB51D76C,0xBDC89742B13CD2,0x6A9B427B35077684,0xF9A874A9AA3CA007,0xF3ABFA84F93690E0,0x815E568EDFA0F84F,0xCC3DCF2C80164BB7,0xFA33924AB598C47C,0x2CCC9874DC774FD1,0x33B9AE76A0E4C46D,0x818CFAC7819E0460,0xB7D5A701FD23B2B4,0xDF1F519EA0B54B7D,0x5B9D8077EF640468,0xCAA7ED3DA3EAD53C,0x8C72AE091EB20602,0xAC3F47C6E026FB48,0x7BAF87C40BEA974C,0x7E903F2F588C9435,0xC18CB5D7A27A2E00,0xABE86AEC64720F91,0x206AC354EB77B7FD,0xD2ACF01ED6E6D7C6,0xD79BEF4E08ED2183,0xB879CA89F967F26F,0xAEC584629042017A,0xE9D0D38A52D47D12,0x851E914CBFC1A1DF,0x8D45EE985CFA01DD,0x3727730B65065BB9,0x837A06CA50CB0287,0x53011E611CBE5D47,0xA7237EFE46BDEC7B,0x38C09A49FBCCE839,0x134EF45B578F4CCF,0x8C09D01F9FCC2827,0x70ABB0748BDFB6BA,0x34F31012FED51A0F,0x31DC11BF434AF20B,0xEBCF66C686AEBDCA,0x8A77EAFEB55D476D,0x5156B6B1D1CD58FE,0xD8EB47E09DFC393C,0x79EEE2067838CC59,0x5E8BF7E974BEA7D7,0x8B61FD3426EC705D,0x11FD21BA1B765FE2,0x5F7C6361179DFFC4,0x54BC5E0B6A29AE8A,0x1FDE21A286357401,0xD1BAD83E70275AEB,0x93693D93BD53ACB1,0x203607236413B185,0x4F3198DEED415E95,0xCFE92984BF3486D5,0x2B3725FC402B94A8,0x606408352C7741AD,0x59E8FA762FB527C5,0x1F4C0FAC35E805F4,0x5DABD035363E4E52,0x5F9F81C08516558E,0x261E3728EE56B3AC,0xECBFC40AE72FA489,0x8C9CC81BD246DE31,0x444B1E9E9A9D726B,0x8827319E5D2F9C68,0xC026D674C8C48368,0x1595D1B690089487,0x9A98CA859043585F,0x5676319ACE5BEC37,0xFE087BC8EB584AA2,0xEBF44C5F6EF789C0,0x7242220B378B8CCF,0x53A6D90B4FBC585D,0xC8D0FF9225C03E0E,0xD25970CBEE074E07,0xB0DF27929B02C57E,0x97DD063A9C6137F8,0x9A9677D7F3615A86,0xE1E02509169C124E,0x27AEB178E6BB8021,0x8FF2665359043205,0x521B8DE052C56837,0xB856D5DB24672EA4,0x46396D1A40BBF581,0xCA8FCC9293149C67,0xADED703C1F8CC52B,0xB3592BAAAC94842D,0x6530C8E06980D65E,0xA5D42B526D34A833,0xDF9CDAB22CD2E6EF,0x1BF2060736C8594C,0x47C5F1CAA6A07D67,0x6C8E92D4F56B150E,0x130048FEFDA3B288,0x348A57FA9B720374,0xEF3203CB3CD405D3,0xF08B45C0CEBE11C2,0xB0926B14C2D3A838,0x2920E3AB45CC75B8,0xC92F64C449585057,0x350F7DB8B2765EC2,0x232D3561D0F9CC6E,0xC81430427CA20D7,0xB1839CEE630503F9,0x5FA9B89685B7F17E,0xD9082A1A08CF156E,0x563974EC0E4F379,0x2FFEC9DB9C5EB929,0x3B554BBD6F262ED5,0x255FDE258192D9FE,0xE2C5447EB91CC682,0x4F279069441DF335,0xCA440502CAC1617C,0x568C5A2B6834D226,0xDC8C0439F5CD3C85,0x6CCB49E4B35F59D6,0xE0128328CF1FD9F4,0xD0C8A7FF1FD5A461,0x8FFE1F924EF00340,0xE8B604AD9A55DE39,0xB1397F80306800D5,0x66E498254807DB77,0x68CB8278CA2DB28D,0x7C2F429F5A70EFE8,0x9A651BCFA544373C,0x4EDA84E31A9AD294,0x90383DF0E1713198,0x5A59537D7B87C071,0xC2FDE8BF0797A991,0xCDC936BF35EDCB73,0x93055E37701645DF,0x3A777FFCB6CEEC68,0x748527CDF8982E12,0x97FAFBDA1C653C51,0xAECA84689B07DB71,0x76B38120ECD9A6EE,0x19B1BD7BD2BA430B,0xD327503849EFC7D2,0x26AC5C43C19083BA,0x9758CB6BB2E4700F,0x7CA15BD368B8D693,0xD51099E517218F8C,0x672C2841CFBEC1A5,0xC3213134B5223EB,0x748C69C64ED4F080,0xDD718E172A233DC5,0x6612FC080482B408,0x7B74C2465094BAE7,0x9A791B1482F74599,0x40F220671F7EF07D,0xA35EFADA8B877384,0x23F4D421F65F56BD,0x124398C14F6A1133,0xC0AA79A8808D5BA2,0x8A4CF1E65E8A0EC,0x1718FDF9693BFC2B,0x65ED066142EEE36,0xB1354B4526064BB6,0x700F61510EE70767,0x6F5C1B03EC881534,0x60EDC5810CB82627,0x4AA344248B02BD35,0x8F676111F5795F1C,0xDAB06DF0C53853BB,0xC05DC36AE101C2BB,0xD03C646667D8D5F1,0x408B17CF0BA8B155,0xF303C195C2A60638,0x6E8BBCAC6E64214C,0x7AFB027C1EB91ABE,0x918B9A135FB8B81F,0x93F98BC782D307FF,0x10B4F03DA622008C,0xDB0CDDD9A5B1C7A9,0x984AEF3A625C58C4,0x827C8918F31EF9CD,0x566589BD8D826713,0x76CD105BCAC6EB9F,0x7B3F26F5D11BF3BE,0xBF52D447C795492B,0x292BD7F3766CEBC,0x2312C61FB9082621,0xAB8F1746453732A4,0x2CA491A425D49E0D,0x83E35AD37CFCE6F6,0x4C4BDAB6F7441447,0x6887ED8BDFBE2715,0x82B8FC206B9F77F8,0x6160ECE40167CDEA,0x7EE8EFCDD1DAF8E8,0xD9C7584E971C091E,0x7D8697356CC73FFD,0x2D78E296BAAE4A1,0x4C07C028D5A3A1A,0xBA4DB04D93B492EF,0x5150DDF9D3BDA9E5,0x810D839B3DC43B18,0x8BDB5F6FED3994AD,0x44FC944CCE2884A5,0x7815F93AD7950188,0x8B6869C5EC0F62C3,0xE637CC36B406C3BD,0xD813155D5FA37C96,0x148F075BF593134E,0xDFA2DE98496613A2,0xD8DD13235608C9D0,0xFC1123FE6C7D5909,0x1C9B0FC57F5144E,0x8AB21B54A01F6CC2,0x646BC1CC9552A232,0x6AF1528AD00C76A2,0x7FFE6853F63E56BA,0x250E5C2B310DC7C4,0x2D7D4A7EDC2C2543,0x3EC1F83231603B24,0x1ABB34FE0E4550C3,0x1F97DCD0259BD8BB,0x8C15D9F9A0692305,0x5B6118C4A1363B02,0x4E0E12D39BE69892,0x5B4AC3576C9F22EA,0x5AB2FA2EDFF61EB9,0x6DD03E2B054A8A3F,0xB502672BBF33603F,0x2B0E6E483C2214A4,0x7FF4763F9198B0EE,0xA1DA526BBDEF1146,0x1FB39C4C10D6F290,0x891F7D003513A461,0x58B069A2B3372724,0x35628CF57A78C4CD,0x26A3263324259353,0x9D1FE8B2049C8437,0x38D0A140AB80B25C,0xE82C4DFDE9FB1B8B,0x9B74CCFFA48B4E55,0x9F634E841D2FDFE7,0xD13EB0279D039C8B,0x3E331587D83F6765,0xD0A8F3B0E848A00C,0xC8827E144B173DFB,0xE344B3616A2C3592,0xFFB255D6878CB691,0x46AEFA18F83E2E9B,0xBEBFA329956ABA4C,0xF34D7A660FA4A707,0x3925DD69CFF095F4,0x378AFFC55A6E480C,0xAB1097B46FD0ECE9,0x4470407B9FB1A6E0,0x1729D05F2DC94AF9,0xFC98CB0BBC0A0A7B,0x15968F67A02D1437,0x7C7E0FB84F9E6CEE,0x4AAE1A24667185BB,0x55EB8BA1CE3E5D52,0xE22626CD864678B3,0x16CB1C9CEF606A50,0x5CB105D3EB58499C,0xF59281E510228E22,0xB8EB69DE72AD71E,0xD5C2153418DB9348,0xE9E0BE3414B91F8E,0x834C960822A4683F,0xF4DE15907AAE2E3A,0x690E83E7292EA12C,0xBB7F9D4FB57B4FFA,0x6651FAED711991F0,0xA8778038A42EA249,0x7F36EF28AE77E331,0xA21ED22C344748B0,0xA69636D9FC46B96C,0x97F5F6E518D1ADB5,0x8BFCB98CBB3ADB9,0x4886DE678C2CE4D2,0x9533853565DED3F7,0x32FF25F8A134DEC8,0xE533A869F4C34F41,0x6B43310DD2DEF12,0xA9FDF40CD06A05D,0xB73605870CAE4123,0x5CAC0C9085C92014,0x6E4D523086634F4B,0x9BC1C803BECC2537,0x24F6146DA6B0AD4D,0x81C066ED25825D02,0x78595F3231E58B25,0x646B265426E8F86D,0x75F142E8DF15F74F,0xAE84E9DFB523207B,0xE58BC7A6579889B,0xF3AA932723A7168A,0xEAC3CA6CF6C9EB8C,0xAF52AA4A49D4A9B4,0xF49565F8EDB1A5AF,0x36BA6B20E222965C,0xA845292976402C0F,0x53A0D6983FA95432,0x8EBBDA7981838F74,0x403A85E50E14F1BD,0xD57BC2EBAE7CB358,0xAD5E28295E97B3FB,0x9215F2CB541DA81C,0x6FE3848CD1092574,0x9DC05704C71AF6C5,0xFFE22E756055DC96,0x3D7696E3D331706,0x8510A5D786F703DC,0xC9C468532694A690,0x4E03BF5175B444A6,0x6CE421AEDCB62B7E,0x2D1FE8FD7BC2BF03,0x180F569AF7F16BB2,0xC37AA2604D0B69E8,0xFBC07BCFFCB8DD9B,0x5A6DA0A2EEDE8B78,0xDB1A8B701601A206,0xB10D024D4A098884,0x36D707C40C1DCEB3,0x3369879DB5987727,0x1CACC0A56175FE7D,0xC9B8B8CBF4083E0F,0x72073521D4ACB83A,0x127914A94E51F42,0x5D87EA74A2BF9133,0xF92FD7949E52DEA2,0xDB2434E51017FFCC,0x384E096E4BE6261,0xE8DB952A4BA8F328,0x95C7A22DBE7AEF4C,0x7F258099B06D4C7C,0xDFF16B5B12604EFF,0x6F4A865F87C7A3AD,0x7B13DC83218D9AF5,0x2867D5E1AD29963D,0x2F0F5E0292A89B1C,0x40442590673371C9,0x37F4AB46DE999660,0x4470BE79F5771783,0x857CA6FCE5E9C84F,0x1C1C92A1CBAE364B,0x6AC5EDDD33D79407,0x89BE185F885B6CD6,0xC259E614564DAB8F,0x7206AEB20960CCC8,0x762604C40829DB72,0xCCD470854FB0E643,0x93E08E0F531E2C35,0x48B835569F078653,0xF1A4B8228C5E44B7,0xA3E878F88F44843,0x99F8FC8A6D8E20C0,0x96B8D4513E0350EC,0x98A7AD360A44F01D,0x996932F6DFE01964,0xF25E5B7C1279A85B,0x4C7F9ACFABADEB9E,0xE39406DC2A852B0E,0x102543889D51BCB6,0x68F69A7905654A16,0x30DE412C1194FCDD,0xAE032CEDCF23C6D5,0xD109ACB1A444BD9D,0x7B8DC32252146679,0x89DAB370A022F4CC,0x3DC0E2D99138397E,0x7DCBF1C62A9C503,0x630DDB54213C37C8,0xF49F5AE96EF1A683,0xB933C101279FCB7,0xDBCD5F83F8E84B5C,0x28A2896E5EB2CBE,0xA0CE91E47531D3BB,0xF24C94A1C99DA4AB,0xC522FBE9CCC8C20E,0x72096E3388B1352A,0x65EEAD281B3DD2AD,0xA8A5C2C6069112B4,0xD187A24F607E4EC1,0x5DAE095398CD3303,0xEDC5724006650308,0x2D1D65495AECC04F,0xC8D49539708A80B4,0xE639563966553FA8,0xAFD7C87C41AEE7E7,0xE34E2B2CD0086B03,0x2FC2FDC413532977,0x93BF17E19A9F0E9B,0x460D2A8B2C7DC7D4,0xEADBDBE0422CF7E6,0x5766C800B3721367,0xF093E270C0B6B318,0xA6C7B9A74A74B015,0x1B1A446EFA398EB5,0xFB4A5FDA5B2A809,0x5C0E11904FA483A,0xBC04D336219C5196,0x913A6486719A87D2,0x9F7A52B1537567AC,0x16FE0AE33E462D17,0xE38610F405049F71,0xC35A3A4C05A4831B,0xAB3646235DE50E93,0xF5014688C9788D5F,0x677540FE33795D26,0xF1DAEAF3D760B0ED,0xD41EE13851E1A5D7,0x464E131FD68B953F,0x3351FEF40EC734DB,0xA7D865785DB9408A,0x1530EB7A9B636789,0x8F46B8E54248FD48,0x6B6DB41744C41D5E,0xA44A2B8A83947D02,0x6E4BB594E2A075CC,0x310461CE0659232F,0xD61DBE5217500D72,0xD43ED7463CB7671C,0xA8F635A578C0CE07,0xA34132DD5D4FE383,0xCA8AE01D86E1FDC,0xBE0146369C46314B,0xAD9DEC6201018EA3,0x4B41F70EA5AA79D4,0x4DE98A9A01197527,0x6BAFBE8178274578,0x686D5124777B9BE,0x71698F8AAB574CF7,0x85266061BAF25926,0x39C0534F522598C0,0x338ECE3637937BC2,0x93352D3163414D4A,0xFD8C855412F74D0F,0x5FDC59F83F2D1C9F,0x6FB5D26E5812C023,0xB8CDCB967533FCB3,0x484CF81C32C3D413,0x68809A66A3FB7B8F,0x116CDE00FC231A4B,0xEDD63461767A518C,0x8353648A58677B60,0xD731E73BAE356976,0x454174F8A9B8D8A1,0x5679681143C10F0A,0x8C2ACB534243279,0xB039D40188E991D1,0xA610A20639713DEA,0xE30EF2DB0A0576B4,0xDBDF80673BBA3D65,0x40DF02F371F40883,0xE549F846DE7D32D5,0x62E29CDA11F9C230,0xF3BBE5935A04D276,0x89C96510735202D2,0xB75567FBC57302E6,0x473AAB3F1DA97144,0xB85BAB4E28676C4D,0xC58A2B1D95D090,0xC5687BF1EB7AC190,0x6E171E077926FBF7,0xC9AFD0C222C7CA74,0xC9D8BDF3564325CA,0x6404C6D45C897433,0x73038C255039CB0A,0xD948F622B2C316C0,0x4BD40114338C93C0,0x48888A41791BFEF1,0x8EF8E27D73EB5271,0x585FB8B7945FC92A,0x9F633448E4C73207,0x5CE1DEFE2CD68587,0x212E8A037E68E81C,0x75AC04DC09B758E5,0x2879B51C18AEF948,0x51DC6104DE62EE22,0xF060DE6D44C11C50,0x9F1D63C7BDCDFBC5,0xDCEC24AE33904F8D,0xF3BBDC6EE4727F8B,0x37B71363FBA86179,0xF2B38A65CE1CD227,0x1D9E253CF963B125,0xA928AA924B7E3EE2,0x4314716E4B544721,0x270D952336FB6142,0xDF204CDF19B1E09E,0x26E61E347F8C2FB5,0x2918CC9062732BC6,0xF97151502670C015,0x2EBB17A226639CE0,0x3D203A4099538B41,0x13D997FE205FD704,0x725A501C189FDB29,0x651F95F7EDE35255,0xDB9D60DE4E690B9C,0x38C14A8B378CBD7B,0x7453501DC1481684,0xF2EE6216DEB74ACC,0x7EDC844C6CEBFEB8,0x8D163415FF0DAFC3,0xD80197DCA1803BB2,0x12761B3B63D726C3,0x1DF2F4D8E7C2CD47,0x25290320BF2D9807,0x6F146BCF099DE910,0x139268884A0795C9,0x43D614D95E50418D,0xA25C1B5218833F4E,0xA43CD45F18522E3F,0x597D3F733B15F96E,0xC41B72952BCE3731,0x6106E62525304863,0x12C74D626CB4559,0x5F974E79EAE32BE7,0x6145620349FC9F57,0x520FABA37BE687A7,0xBD9FF88287E84727,0xFF71621A8661D34F,0x69BED8420A766753,0x955C6F927712241,0x7260716F2E4D7661,0xE582BF3EDDBB1A68,0xC07B1AA6155EC337,0xF05A19B508A1ECF0,0x29B9959EF2236634,0xAB468D6C5C0FC4AF,0xDF6959109D35BAAB,0x5A748C59E0807FB6,0x1B9836D5F27EFE57,0xD0E82DF28BBDFA90,0xBC8E0392E851E2B8,0x6CC5D49F92B6055B,0xE4DC83CCE846C81,0xC044D4B0F1BFE812,0xA360DA3480F0FFB9,0xB22FD03174DE49A7,0xD0C87974FE71F8C4,0xED0FE8A62C2CBE6,0xE460920F3D75C34D,0xC8FEAF9D86CA72E6,0xAE4A8E8C58358A87,0x84B5F8F55152B935,0x96B33F4FC167DB47,0xFAE42E9AE7B80A4C,0xAC93CF5F25CF17A8,0x51BEADCE3428DB6F,0xCE1D2FC338EEA6AA,0x2C34F64CC58753D7,0x8FC511FC963C67E5,0x3C1752E361ED8FC9,0x4C48F052678AA7EF,0xF63E001A5DB10361,0xA7B045B3F131EA0F,0x40B679A9143C1CE0,0x32C336953C18A3CE,0xEC34E75BDB02A4C6,0x22CE5B137F505B14,0x82EDE1ECB3BF1ADF,0x6ABC02CAFE92B58C,0x2E0CDDCB2AD38385,0xD8347AAB0A3EF3A0,0xB0AB1F334666E337,0x57F9D4E3B420366E,0x61780C0351CEFAD1,0x2E99083F03611030,0xA6DFB7FC64F53E33,0x903DAFB544C5CA0D,0x8DDE9E4E8A102CD9,0x6E2FA5434737D22F,0x91AB029AFE429F2,0x6EF982A39E8D08FA,0xCF580EB76CEC15FD,0x6BF8FE9F26BBABDE,0xF4102A2D0D824EC3,0xE6E7B0D0E904CA62,0xA612CEAF809E9032,0x158E535F1DD78CFE,0x3A6DAAE139DC9E9,0x7B95E064D91BFE49,0xE29ED67EC061E70B,0xEB41AFC8A3FF370B,0x809E97B5B52A6418,0x267FC71D3F0D131A,0xB7F37A0A1E8A175E,0x17C7D9B3979F5759,0x552B3BADB43FF551,0x99C26F3C23B37F42,0x7E46D691B4F4B711,0x593FDB07AF52E85D,0x78D35ABAF71764AD,0xADCE9BCAFCB83364,0x2E9F58AD6FE93DFF,0xF95A1422CB355630,0xF7BCDD970AAA9B9,0x4D64DFA5BE3B2871,0xD1797191721E17CE,0xA0522491D076C1E6,0xF46F370442FAD8F9,0xD1C2A76DD73A4387,0x594FD1B13DCC309E,0x92D994BC2EF590F9,0x1B402403FBCD3843,0x2E63B6CC2AFB0B51,0x76C7AF1F094891FC,0xD544869339AEE474,0x90F32A57D0D76E38,0x9059372A0C629EB6,0x7280E2724C43179B,0x44EF980B0D19828F,0xCFE359CCCFE359CC,0x7E3F74F641EE6B27,0x728E77B2BF91D54,0x8FE5240A69F17DF8,0xAD5B43C219C4CB92,0xC9FA0059132D5731,0xDBA141080166EAA2,0xCFF17EF1F3F6FF43,0x775142054EC39277,0xF55707B152A1A749,0x9D75306730D4D730,0x39D1D336459711BE,0xB2D05034AF8E75CF,0xF11FEC6A04FD7226,0x522EF6D7B4059F2C,0xA83667A5D36A4FF,0x4D8F5CAFCB48E24,0xAD15761928FCF79C,0x42B4970D598C8A72,0x721B5D4CF3ACD02,0xD65DFBCD23E76428,0xCBF07B57F6F01E05,0x48E5EEFE68D01C56,0x353A36B4FAA1F9D2,0x67697883F8C7E424,0x8526C06631BA8A87,0x8810DE004A94F18B,0x3DDE6E86B8024EEE,0xF073EDDFCBA082E6,0x3EE3EB731E022D41,0xBF798C4E54C2B4E1,0x4F1FE21A5BE23982,0x1D6800242F1593FB,0x52C980E21BCCC469,0xC21CAB69B42AB890,0x73DB31FD24210A89,0x527803286A8B6C81,0x5F27287D37B4D40D,0xBC5D9A293974F095,0xB94AB707B44E754,0xB81F209A2A150B89,0xDEE175A01A05A2F7,0xA78D3770EC931263,0x9E6111F1B7E0986E,0x5B2134752B0D9E36,0xE7101255AD6F1952,0xF2E51EC84D76A2B6,0x643DC062EE904FCA,0xB505DDE34E5179B8,0x5B051FA78EA5C170,0x644DD5C4A28FAEF3,0x4249B4032FDD750E,0x243CFDECC076762E,0xC86D271C3C15DE36,0xAE83F6C70E4B78E3,0x308E9BE8B02DA53E,0xD47DD48CBAF4A6B5,0xD2788BE0DF3E0C9B,0x5147DD7078544AD1,0x5A80107016E75ABC,0xF859473E4AD09F30,0xE794EA31F030A1D1,0x6457A0C458E98FFB,0x69617275A0B1B72D,0xDFAE61B1AEF262C2,0xD91B1F4829299334,0xA1D021917F4E3FBD,0xF40724C1181481F4,0x63FC4C73448FCEA2,0xFFE66020A6507F47,0xAFD3BC0F6EBB5474,0x2B7C09622E980A72,0x99599AE2C0FDB2A1,0x75193D36C5FA4721,0x132F0517E3CE528A,0x3E1222B4C1E92A7A,0xE5870024C848E72D,0x48FE6369FE249FD2,0xC2A05549FF0EB55,0x8256312AC2E5471D,0x31B34E18DE46CC94,0xF8EEEE15D7483100,0x6CBA9D07DDF3A4F4,0xDB3FE51DA96E8CCA,0xB0D23E19A23DCAAF,0x99F525995A2FD5E,0x3B952A9A844B63C6,0xC192DFBBB8B81D26,0x1DD7AFEBE9FED010,0x188C088397FF5B1,0x14A73449675121D,0xC87C83C8950432B,0xB327CF1B8C2C0EA3,0xD94071E55F4C9CE,0x367E5E33E7F0DD1A,0x1E8E83ADEA1A71BE,0xBB4032866B475D96,0xC244AC9DF2DBD29F,0x3DB3B2BA3A150EF2,0xAFEA31CC8C88FC36,0x18CACC03B0B46CA9,0x3924757A6ED5FEDB,0xDF6F5F7DECDD6CA3,0xA484A1273D8798FF,0xA517819975B6DC39,0xBFCA4F7F15FD06CC,0xC9DC4A70BE727818,0x752721B56D5DBA3,0xA71D65C4998B3DF8,0xDEBA59FD42C0BAEF,0xEC550B2DD0955D8D,0xBA8E86ED610D8A3C,0x4B8C68B93333048F,0x926910F3168C206A,0x2D8C146ED8EFF79D,0xE9D0244ACBEE1BC4,0x64390744D38F9167,0x246563FFA6EA9A50,0xC392361DCE030EF4,0xB5BD605FB63CDBE6,0x6934C0E4AC296466,0x819DFDEDB0378F60,0xFA3B6F3FE5E66382,0xF35461D41398F92C,0x94796772E71D5123,0x5F1F0F7CE82B92D5,0x8060309EC15DED26,0xA2A73F751726916,0x98B8C1C5D9674E49,0x5B5089244DF8EA05,0x7241E3AD10840886,0x21A5D8255DE6E429,0xD3B5B2F30382DFA8,0xB926A96763FB9843,0x9184B1F53F02EB67,0x57C238FEAF0677E0,0xDD21D41AD9E54549,0x3682CE8F11C793D4,0xA25A07F63AC497BB,0x8553FB74D3BF41C8,0xD1A4BF0F54E08B34,0x2B8BAF9BA2A3D36B,0x56B77EAF3DD4C954,0xBF5A33B684B68C2B,0x687DE1873713BF49,0x4ABEBEE42452BF31,0xD553FC562BDEBE1E,0xE50095A9B205820E,0x2A878DDB1FE0F636,0xB83285E02B6331A7,0x2ECA4EE3F57B8468,0xEF05628918C6842D,0xB83FBB552E8DBF61,0x595BC3CB7A842B33,0xF61191B654874D0,0x7BAB29B9355651B7,0x8D99EE58B1FB08FF,0x722F601C8C71A90A,0x194647F86ACF56D4,0xC10C1DEAEBB5849E,0x8071F22E56E8A70F,0x144FBCDDF1717161,0x72CF8D8C29D8D5BD,0x150E13CB4B04648D,0xFA49944CF453C338,0x840A709B5493C918,0x368A167655B5B44A,0xE2BDF7F96F1777EA,0x7C1C1B7F72ACD298,0x82134CFF7DD01AA,0x3F784BD38F0D94BA,0x6D52735FB5FD59E8,0xA5D1672BB8378B6A,0x4516244647CDE56D,0xA598E27B609E1B5E,0x30385B4D972827A5,0x4103A58ABA168EFB,0xAE7CAF61C281EAB2,0x2D3878E122FB9CD,0xF9618670CE65580B,0xA46905C7B738C729,0x423AC9BED82065D0,0x3A9A4663D37D7390,0xE3101BD119D7E62,0xAD20B85AA9EC7F0B,0xF44BFA38C25D7F65,0x3076B63C4BC614DC,0xD1377E5E950FBDDA,0xB615B19E3B1CB800,0xCFB101E40FBA6A5A,0x1DC804A2468D29A2,0xE5CECFB837D1F1B8,0x1EE4CB0B5FD3927E,0x7BC6776F828F022C,0x7D7DC90EB1D8C8B4,0x4A5B5E00528FADB4,0x2461B1057D922D96,0xB678B17485F07C58,0xA97D041A0700AC71,0xD497BCA3B9495BB9,0x9FFE2545E71B490E,0x7768894B5FCDF25F,0x7BA63240A50FC6C7,0xB3C23ED232D01319,0x8715A76F8294FEE0,0xEA3E22389A733263,0x86D971EBB6E0F0AC,0xB010444AA0CE4D66,0xFFEDCFBF2A7D07DE,0xA049DE72EC734E79,0xA2CE098EA47DF97D,0xDECDB93AECF4571C,0xE72957406FBFB362,0xCF073B4FF8828B7E,0x909B2EE8AF324A1D,0x7EB4730FA964B592,0xAA565F77BB458AFD,0x821D66CE02BC23F8,0xDA829364F715C68,0x171DF6A0C07FB3DC,0x7FD2990AF016795E,0x52DCAA722383A060,0x66CB39FD84C5ED21,0x28F3FD2263FCE777,0x16C0B173B472AF71,0x1B4FD4A821EC277E,0x2D133345AB736461,0x67BEDA5A8CD7FF28,0xC33E7CBC06EC1A8D,0x29D58EEB6D24D5FB,0xE3E138A155ACC0B9,0x8FA5AF26CEA0CF0C,0x2DD9F4C2D128C690,0xBE4DBB4B94FDD19D,0x7911A5D34DD65F5B,0xBA339BF67EA1C876,0xB7CBD1698172CFDD,0x2D6CAE334C3034FD,0x2D8B5E2968C2B8C,0xA447FE863BC5F3D0,0x403513BADB247F14,0x5177CA1D97988B5C,0x2864B7211C443DA5,0xB79F7D662E0B7885,0x626E6E90E38C6EF7,0xFD898AF12570EEB6,0xA1EF53B581B6B4A9,0x5506E003A95C6373,0xAE566521443DBC23,0x23ECFBF953F64001,0x220ABB0D55961BE1,0x6D230D68A9AD1134,0x1905CE168C7AF873,0x30B65E94C2188C92,0x3A1BB16285A7B9C,0x988DAD0F0370C94E,0x26EA30089CAD115D,0x6DE51300ACD3E3F3,0x15C0F0A696091ACB,0x3CF1DEF284B9B6C0,0x17739C59E555C46D,0x6B47B305B6557EF9,0x62B038F95CEA3FE9,0xE67B481B4EC10A14,0xF4260C5C733DA1CB,0xC869C5AD1CA63C58,0x938C5858FA4618E2,0xAE6B753124318E29,0x428539069343758E,0x20DACABA7023B608,0x5BC93955B6EEBC0B,0x753B42F8D561B8E2,0xD9719341663C385F,0x8956A309BE90057C,0x9BA54B3CFB82ADDD,0x9E0B6B766CF810E5,0x12AEE383533D0E70,0xDC5F81D7F618A8A6,0x7EF7ABCDDEEEB7C0,0xEFF4479E2B0D2080,0xBF561BB44F8AFA5C,0xD8D822FF4C3DCD7D,0x8D2010DF3E481626,0x230CD2039E115591,0xC7C2484FD7A1279A,0x6026EB0A2A2F509E,0x1BA57F70810F53CD,0x6C15571532CF7F95,0xD29CB5E83871293B,0x20EDD3199D02CB60,0xA26711392EBF5371,0xC424F771EFDD2A58,0x7D17572D1EE9D0A9,0x2031266910F9D195,0x5CE41A29691C7614,0x4D867CF71882EEA6,0x65D66F9646758265,0x21D6FED3EFEC33E5,0xD23AF6BA9E38FE33,0x3A5F05A23D5B4F88,0xDC05070D5646C09C,0xDF399EF490797927,0x17E5F27FA417E82E,0x3E1F527308A7BBC1,0x4E55EAB577C13329,0x43AFC452F25F3A2F,0x51C8BEA2005931AB,0x8225BA395C3FC89D,0x711CB952E5BE087E,0x6ADCD027CA259B43,0x51DACC000DE4DECC,0x918FE23DCE5B8322,0xB39F03368DB0CAA2,0x6FDDD37A4022A641,0x8366ABB82B1ABC59,0x1C3788A51C49D6AD,0xF6774B3027B150AC,0xF701B83DA32F7F87,0xDD5D60B63FBBFC2,0xF10F2A2453AF1DFB,0x8679173785B8D495,0x1F3E4227575DF103,0x696D2AC31CB5932A,0x6421C7C9616E4305,0x8F07CC6637F60B7F,0xB80B2E08713B8BC6,0x19B3B7AC049E8354,0xEBB2809684978887,0x117BCCA03F7A311A,0xE2A2194077783E19,0xDD0EDCD573B965E2,0x57A602C0620BEFF2,0x3A15B21067339E98,0xE29951C625F69A92,0x8CA2126DEA4C3796,0x2ED5915E42CF4212,0xEBFE569715DB18F,0xB80A7611D19E162B,0x116053132936EA1F,0x497B2CD637A94E2A,0xEE7031BA6CBD6DBA,0x3E4EE4ACF12D2A90,0xC8E94211877921FE,0x5FE36AB1B2950A9,0x988923E9EBDA2C20,0xA9BDD6C662512CA7,0x3DF64ECB2401B9C1,0xB7AFC7F5C75DCD56,0x2ED8EB2145D177F8,0x659143E4AE5A351B,0x805A7BBF801B49D0,0xC2A1BF59954282E5,0xC175C00B24E2628F,0x1DC06048E0BEE337,0xBA7A8F956317AC96,0x3C0B3EA001613632,0xE10356B235A70E70,0x26715B0ED6702C87,0x1315213A9C4437FE,0x2493F314750274C9,0x79BDC52C38AAF639,0x4B46E3AF872076CE,0x80F249EA6DFE8476,0x3C38570F42680D56,0xCF9F92EF5A069BD4,0x8C4D4D7E3B6BC910,0x3E27C7B2037D7E8B,0x30A5E8BBE5D07DE7,0x33D763C13554690A,0xF31BAE02C52ADEFD,0x7D8D470E05A35981,0xC0794F64BB12AAF8,0x137D2653DD6FE9A2,0x7825AE6DE930430C,0xC8C12645F5A0E13B,0xBF86159B8525B1AE,0xEB4069FA281FFD9B,0x502101046E18AD3F,0xEAD3338566510A40,0x8D4CAF9A056EA9E4,0x6FCBED6282FF5DA5,0x82FFC7AC4E85D734,0xCFA4C40D5C68471B,0xD0DDC0D0D8D33E57,0x192C5E68A3552FDC,0x4CA2980073803EFF,0x29F49A5884D2FD3C,0x77573CD394E8C3B1,0xCD1BFD3115E1591A,0x31A69AB30F92CBD0,0x7AD61992EAE86A99,0x6F7F646DA603F6DF,0x48DD7FCBAD86D46F,0x2053D6988D24922A,0x165E2DDD2BD0F07D,0xB7E1B262DB074229,0x2E42BC795274B8C1,0x80C8AA1625977488,0x70351229319C8FCB,0xF429153602FD9CAF,0x1D56B24774D5E23C,0xDDFB0941A19702BE,0x24703703CFA1C70A,0xB0E14182FAD64944,0x313F30E8A7FB3625,0xA9D6BD2486442887,0xDC4C404BF0F7C610,0x51FB632E333967,0x6AA6E814FE2A18C2,0xE611C8912D834299,0x59955A005920818D,0xF3F15DACA12B4829,0xFE931774D31D4525,0x88D79D666165710F,0xBF998058B3DD9EEF,0x26909BE8B0CCD35B,0x15D82129216A84DC,0xED6967E98C0B750B,0x1EFD0C969D7EC8A5,0x57619EEF13EEBFBE,0x5730F7F898FC023D,0x965118645D618F6E,0xD44CA9207ABD071,0x234E9925E93F6A5A,0x2AD9C2DC3976B552,0x8BD66D017AB5A655,0x9CA38BB13C29695F,0x4C053DEF00842DC9,0xCDBF6DCBFC52E781,0x8EC1AE8FE5E74E2,0x7E1C4CAEFA5571B2,0x5612E9BDDC2940D7,0xB192A63C891A0E89,0x95ED454235D93943,0x3B4B7B1791F11CB8,0xD346DC73B664C2EC,0x49498E53B3E184F7,0xB1FED11AF36ECDD3,0x60415964D3B19DC8,0xCF4D057C2C049142,0xD0AE52F8786F9DDC,0x1849D5FA4A78390C,0xCE01C49286D13953,0x5A0A30874C8AA5B2,0x9D3736A21578FCE2,0x6B0D585D62AACB6F,0xC557ED333E7A31E1,0xDEFDEE8D4FA47138,0x44EFE8009F436110,0xD3CBD77236B58852,0x53AEF1FECF5138CF,0xCF84B0AC4DDC5E1C,0x5D56BEB3F5597195,0xB853745FD2637D7F,0x824F169326B2BC67,0xAC96042A1278D845,0x320BC441CADA2E79,0xC942CD0D37369DC4,0x7A2982A0B5AB7BEB,0x78CDDDB2C832ADEF,0x95D654C0E9FE1D7E,0x3BC4D68025ED9B51,0x806B9D97E4C16543,0x6F3AF5B029E1AD6C,0xD935AEB5CFA7FA1B,0xA06DCC0EBCEFF7EA,0x140444BB8ABDB066,0x9D0318A9D395CB5,0x5CCBA474776568B7,0x6D05C5731A838CB3,0x9924343EC2EAE1E4,0x875A214D5EBCA509,0x2645430E708CBFAC,0x6C29A57AC29D7033,0xB504E1B50AA21FC5,0x88C44A9692A5A3A0,0x4AAE7492E7D81A57,0x11E5CA6A9B6D7D2A,0x4465D55576678706,0xAA7C376C3569E05B,0xDEE3EFEA31A1F555,0x61C3701AD6D746B2,0xF069618D9974EB9D,0xC3B77DE416935168,0x93D020792180298F,0xAE231F549813BBDF,0xD67885288D4A40CB,0xA715917D148B834B,0xF4E95755715FE93D,0x7811C74D5B749F76,0xE934399D6F2C3AC5,0xF761D79754BC3043,0x5806B70875E083E0,0x9882AC0599785A65,0x97A041099E92C69F,0x238500FECB845FFF,0x9683D8208E71E46D,0xE0CC4855A08C0666,0xF27E6847E6EE009E,0x660D0B8C8AE85314,0xDD087A873D2E08F0,0xC613ED89DC21151D,0x8783C7E86E757352,0x17D4CDD893C6031C,0x7BC5EE3C02F4154B,0x22C925E7C63C5628,0x92F061476F865C31,0x4CC1CF98851922CE,0x66EFB3D6110055C4,0xB211E45F1FE1ED2D,0xD4510218399ED105,0xD6D50527C75F8C6C,0x5E8B7CFA7D52A6,0x60923CE1CFC6ABD4,0x4E6A84BCEF2DCCBF,0xE0EEB603997F273F,0xD1B0AF388B711EBC,0x5E08BBBF87BC4886,0x79CA429D8B4B057A,0xC0EEE6A2207F3CB8,0x3875519517101875,0x8E942EABE97448C2,0x813ADF2A2A03F440,0x8B777C12D64DF209,0x97C50CC028477E0D,0x6009FBA2EAAA60BE,0x990DA6AEDBBBA89A,0x7F8B389881024657,0x99FBD9356770254E,0x2EE1ADDFD32F7C35,0xAAB540AD076E01F8,0x8D4953B2FFED058B,0xD2507ABB3A05C571,0x748728E3BFD8E371,0x10564B8977071406,0x14B872A3D2879E35,0x6FAD8BFDFFCEDD65,0xFFEB5F24B372DFF6,0x693ACD1AA0BDB375,0x33B6B083EA6305A5,0x2AF2D6F164BD6F5A,0xF9372EC61E6191AF,0xBAC712AB83AFA8CC,0xE649818AF72843C4,0x771D4899F0EDF3E,0x809549AFC7AEC597,0x77BCD89051F77C43,0x766E7B4FEF97CFDE,0xAD69CF046AA50E85,0x7A0DF3CEAF912D48,0x4F30C4E212ACCAAA,0x715F5EED76FCDE9,0x4AF7AA151DA57A33,0x1A9014F37459E83F,0x5053D36357207FD6,0x2DFF53C2897C7990,0x1F32EC7CE9CC63A2,0x278706F2D0A8F29B,0xAAD42D6F976511F9,0x887AF6FA4371E08,0x8998A86E45C5155C,0x81F9331288182129,0x53F38E2C8579B2AA,0xA8C09F16998DFD28,0xD33AE43EA8DC1C58,0x75A7B7B3DF681621,0x758F97A0C79EEFBF,0x8CC50AC10D8037C7,0xD9ECC9BB146EA4A4,0x8E99C7AF6C6639AB,0xF935563454D3B338,0x54D01A0F98391D5B,0x2093CB9E0E9B985F,0xFAF53F2F65D5EE26,0x5DB7284C236A9DE,0x1287CC087A5CE000,0xB1DBFEB95C0EFB88,0x734A9F4537A31459,0xEA797D2F13BCD0AA,0x7486FF8F1B2245EA,0x4E719C7F4406EC93,0xCA1E369E8B71BF45,0xCECDBB848D53DEB2,0x595DAC15F5513F9,0x7F420695E3F776FB,0x59A8C2AB2084CAF7,0x4FAFF4BCB7633475,0xC00DCFE53DCBBABA,0xBFD01C2045360289,0x89568FA9A6BC0B4A,0xBE65C2DD27AEFD7B,0xF5327658CA9AF463,0xC722DDBD6C3E86D7,0x501EBB0523078750,0x8728A378EF2B46B2,0xFBF90D96AEB26BCF,0xF62B077162F79BAA,0x3644984C9D7B57EF,0xFFAC548682B3D56E,0xD9CCFCDF70474932,0x6051CE9D47B0B904,0x68C0C5563ECBBAB6,0x65F146FF416F109F,0xC652B7E19CE29859,0xF558A1138519E6F6,0xEDC191D9E24A6A2D,0x700C28A639389477,0xB958FAC3AA36D900,0x77870665080C9E81,0x2E20E7B6C4BBA61D,0x10A676E622A468AA,0x73CAFD2038E812B3,0x9A74653FD0288BAB,0x5E0FF86EB887D780,0x7F179394883885FA,0x3CD322135CF08E09,0x70BB2517035D5D12,0x60E0AE8EF70F606A,0x6EC1B5B2C6C31862,0x1537AF7B62B52EB1,0x75B4FDDCE5B4C969,0xB98B1A5B59BC5065,0x26A004F4BA50E71C,0x6EF03BE64E058E2F,0x61BB4B7411E1DF82,0xF9A2335AB37CF17E,0x397A00D015A11D4,0x94D0F337C46797FB,0x2A5514EA88DA4DC4,0x89C4F1335B4A6633,0x93586F94C370857F,0x337117D37E592B05,0x1BAABBB7277FCD90,0x92875FEB15AFF7C7,0x92D9D3367234ABE7,0x6A89FD77560DE959,0x886FA295C1257AAA,0x6E01C40ECE96D208,0x4AD0013B427A98CA,0xB715358D51663C7A,0xC73EFFC5E043A8BA,0x9288ABAC1FCB4745,0xE915224DCA36212A,0xEFD4518EFFDFB602,0xF4244288C3EF3306,0x27E68848F0E5D7D9,0x5B3431FA66D59A4C,0xFFEFA49356BD7CA2,0x74CD4FE549433E92,0x240E88FB0B8CC932,0xE70AAE8EBF7D65BD,0x483232F244CDBFC6,0xFE90F09EC43D7D44,0xC5F2281709805477,0x1F7A48429F9F64CE,0x34A9A872D3C510BF,0x9EA69973FD5ABBBD,0xA39E0AA2C6BBD52E,0xE5E6F6EFCE07789A,0x3CDDF07147FB8B6F,0x9C18DF7FC19D843C,0xB76C3F86B744BBA5,0xCBCBAEEB5BBCA58A,0x36978A351E9CB5D8,0xDD84F9C956E69AC8,0x767EC66D239AED1D,0x1B722A2B2026558,0x941975834A0817,0x3F58BFCF656F0DF1,0x6A17FC9B41F35458,0xF861636AF1D2D3D2,0x7D2CC3BDBE189210,0x476AD3ABB8EA8A58,0x84F50401806477CE,0x5A816292AD6929DF,0x333554781C7582D7,0x9857C978BD3CBEDA,0x2C807E70DCB4BB36,0x285B49B5EF71E8ED,0xC77607B4F69D0DFD,0x7CB06BFD42FB0E24,0x75B105C651D87D0E,0xCD80FA7E842E5CA9,0xE7895DBF72C7F282,0xB16071F8F0F2A561,0x57E7FD3BD6BB28C0,0x2621F11E556C9703,0xD23AAC1FA1C1571E,0x651A46CD4EAC23F3,0x68D0A76A580AC47D,0xF3DC3DD7A741C1D5,0xD0B00571D4BDDC97,0xDC91B9320E14F119,0xF00017BC718D851,0xC45887CFF81A1950,0xCAF62AAD9CA7C260,0xF4B325151D7AC09F,0x7D6A73BC9D136D34,0x75DACB7D11C3CEF4,0x25DBF9F9C6BDFFEA,0x35365D1E3ADB7109,0x3C7306C2CE967C57,0xC8DEC2468E748263,0xA5D7DCF7BE7B181D,0xD1DDDDB8B108DF01,0xAF30637CFE0F3A89,0xA6102F762BBA9BC9,0x70101B2986BB6AB2,0xF9358C41CC69C616,0xC2BF1F6F84E31EB2,0xAE734C5C560DD787,0xFF7B703047EDEC8F,0x3AB73582A77DBD3,0x2D8E4004BC147E7E,0x94CC4CA44256FDCB,0x5C4B3034CCDA5270,0xD11A63E12F198FDB,0xC3174723CF144560,0x316802E03D8923D8,0xFED960E0DE07E343,0x78174817EDF226B3,0x1B32E388988DD296,0x11330C43B3678209,0xB8CCCA6CFFCE7734,0xB29E06D8C7B733E6,0x49CB27F641DC1328,0xA6534E6C7AE314D6,0x11BF418D1AFD7970,0xC1089D3918F03D33,0x3DEAB4931240C1E3,0xCA038E64C65D1F9D,0xD6179D448A06A77F,0xC0BE0D29628A246A,0xFAD234E6A6D853B1,0x3F055D2CBA242A5D,0x97FBC735CAFB56C8,0xA32ABFEB2A03B306,0x3603B0046EE6ACD,0xF9F8E3060F7CAEDB,0x836392D80E4F106A,0x6D7C109F77738F39,0x1F4CEA172C882694,0x8B5EECBB010D0C63,0xF483865E4C02C371,0x17ABD7A8B101AF83,0x3CEA1FD137ACE2D9,0xD414C47AFF81382A,0x40D1AAC4EFD3C281,0x6CD913C241C765E,0x2B1BDC32466B40A9,0xB2AE1A67479A5AF3,0x1E37AEC038A241A3,0x4001C3C533FE6925,0x2A661A0285B74A27,0x48553DADAD2512F,0x290573EE8D28208D,0xC0343109FF76497E,0x89C101B2B73350C7,0xDC914F868C070C56,0x81ECDD5A759C026D,0x6B7357A27B4D68F1,0x675B6F5098262382,0x39256A89E9D7464A,0xC3AD0E1324FB3465,0x34DE92FC6933B92B,0xE6E9D3B5BEFF0EB3,0xDC469CE2BE7CE722,0x26B246D60FABB3E2,0x133460AD0F183CC9,0x5F858847305B52A9,0xDC80C872B18711B5,0x47F8464BB13E408D,0xAD9D10D7F8C6F478,0xCDA725BC2F170795,0x31945A289F1359A1,0x7EF69980DE8B28B0,0x39AB1812D20C2C99,0x81B96B8125212E06,0x4CE80A0172B32F75,0xBC14FFDBE1C32C51,0xDFE7358172FC006,0x91B8DEBF573007DE,0x12100CAEF6D8A8EF,0x36A20106D0B42723,0x3C8EDE4003ABACA0,0xABA0B084615631D7,0xACCC8916441860A,0xC082B2B13450E715,0xFD763E094E35D34A,0x3805B001642BC9B1,0xE57B0AA791ADBC93,0x68F395D64BC35E68,0x2F51D23580B7A15,0xC771CCC16BC7A60,0xCE2DE9BE961A9AF1,0x619062CCF4C1D4D5,0x6814C7F2C075A4F3,0x44FB298D6382876D,0x55A8A33A33B949EC,0x2CFBD7757B4D922F,0x9AC89B274C35B3FC,0x2B083B6FDD0231F9,0xD394176EC453FD41,0xD682DD0578BF5392,0xD5E2F27BCC913BE9,0x931C6A48678F5793,0x714C359ADAF7B58F,0x4BD214FCF7332FF6,0xB2EDAEE9E5BA8E24,0x17CB7D9FBEC4100F,0x9D6DF8F3584AAC2B,0x74408742BCE2802F,0x590E598CA58BADDE,0xCF10C35FF25A86A7,0x61BBBE1B9F8AC7D0,0x19621C4DDF8636D4,0xD8746B5875BA4019,0x85B81BB17715A70,0x379E96D5D36B27DC,0x4669032A1DFBB449,0x4A46A67DB6AC487D,0x696095B298957860,0x529EC998DD2C51F8,0xC806A20F4C5AC6AF,0xC935F6A2D1890729,0x1E4D3966543704DD,0x728A2C1D61F55E08,0x6D80A3E2F71A926F,0x8ED4FEE426B22F3D,0xBFCE94361188CEB2,0x9E02F7BF34671713,0x26E9393912EA6F6A,0xA23312A0DE89348E,0x3AE0EEB34FAAC92B,0x8B224316C228BF51,0xCC2D0738666FD62D,0x384E72D362B96929,0xA962F06E648B8941,0xBE8776D2466E9EA6,0x7A6103DCF5EE8CC3,0xC0120BBCC298EA2F,0x1A4EFE92822E3123,0xD6AED6BFCC58AF7F,0x8401C77F508D70FD,0x4D0F04723A52D0E9,0x1D77F90D87ACD2BA,0xDAF263B0E792EAEC,0x386E4537DAFC3779,0x82ADFEA98A0C26DC,0x6F4B2AB7CFB2F472,0xE91CD2B3CF8A106C,0xD1C578C204015E1F,0xC6E8E1D693021E9E,0xB6FA664D27C123AC,0x77EFA99E6A8FFC43,0x335B397DCC88FD74,0xA5987DCA39E8BE5,0x5CB7287FD7611BC7,0xB320F619D5CC2D27,0x348FF3E632DCB635,0x795C9AE513FFEF5F,0xE5B6C9B29510B84E,0x8E73BECF421D257E,0x6D19BF3A83702C49,0x94965BB62753D4D6,0x894EE2587C8D8D1E,0x37A0D41DCFB52CC8,0xA4209F7407B86F6,0xB062D1D08D9CC751,0x91AAB4C71ADE4CD,0xCBC4C0F54C8BFFD1,0xBED8C136A36DA2C4,0xC4DF7897A59B7B8F,0x86F83CBBA37677B2,0xBB9FAE42E3101CD8,0xBC34ECDC4790796,0x52611559311E2B64,0xE3FAB626C2DBDF88,0xA3089FB5A559E0D5,0xD839A970B98A1E9C,0xAAF9B08B469F707F,0x4CEC77F224BCD884,0xAF8337BF5A296283,0xA3C0950202881572,0xC3579BA21459B45,0x6C88944114345A04,0x69618F2236615539,0xBE291C733F237949,0xB76612E72B637A6B,0x30325AB568E2F2EF,0xEC129CEFDDA0A303,0x14491B5694114619,0xB736C2C734C35F54,0xB204F40D393426B6,0x7F08C4791E6D6969,0xE19C037272259115,0x9397806857F5DFB,0x445E7F949766A0C7,0x5A5573FECDE27C3C,0xDC23FA727759F9F,0xCDF42A1B8D2576E8,0x7E6931DA4A9ACB6,0xB0EFB4958498E2D0,0x1D5385246A3434D3,0xAAA71DD7E9059338,0xEABB1C18FA028606,0xC225BC409BD24794,0xA2759157C7F12D3C,0xFA4D35AD36BDA1FE,0x2E029D1D9614563,0x9C9B7988CF45CAF0,0x51150F0B2D9D1CF3,0xF823BACD940DEAF1,0x6D618646705A0465,0x8C863F5EB14919DB,0xC24FAA5E8D69F7F8,0xB1C2DC5C115FA50D,0x52B67D4C57E4BF4B,0xF9E1F44FD9B4934B,0x8BF5256C439DF778,0x86521C678E8AA3FF,0x661428616F87F180,0xBD1B952A9BBB567F,0x9FF00EA9A61211D2,0x942229677774817C,0x65815C3D3CB39062,0xD9FC29710C12DA3A,0x72B18C9612CF3DA0,0xBCB78CFBB026B0DF,0xDF2B856299BCDF13,0xBB4D4E549F8E6E8C,0x98EEF9ADA73BD5B2,0x6AA75009161058B,0xE0C92005A30D227B,0x1738EA03946B4D2A,0x805B057FA4E28531,0x93B95A59CB61088B,0x4B3F6436660DC25C,0x392230C626567F51,0x97FD4A8DDB09A043,0xB713CAFC12DED3BE,0x6ED737C2A74E181D,0xEB418CA245FFE897,0x8C4993D059F4DAEB,0x9E6CC93E007219AC,0x9590C8D34FFFCE10,0x4EBA48817E0C608D,0x69AE13B08EFD8497,0x83707FFC4BC486A1,0xFFD554A221AA80F0,0x7D31B8F40A98A75,0xD1D8E1BF0769890C,0xC9FB3D0735F8ECD9,0x5909C9E03CEF097D,0x8EA9C5E0178372E1,0x1926B687CF984FCC,0x81C558E9A03D2F2B,0xC6DFC06670D0589A,0x1ACEEA8FD72F77BC,0x67A5951D0BFF01FA,0x5EF96FB2D3902DC7,0x545222B91BFCB344,0xDFA7D3DCFE10E65,0xA60928A188EC78EF,0xD81F5EA29FD2682E,0xB44335AF5013DA2A,0x49A5A17556C31561,0x166CDAB8FE42C210,0x50CA4ACB66148FF0,0xA781062E77B54775,0x98E00E3ED7D61628,0x3268785AA66D674C,0x83FDC027F0BEA202,0x83DCA877143E0B26,0xAFFF2379B0BAC81C,0xA7B0B03284E7503C,0x830C51B62E7CD5B2,0xD7B6A43ACC36D868,0x2485C562F3C50736,0xCFE9A25C2271CFBF,0x282B0289FBD3C119,0x5110BDFA9CB51F2B,0x51468F9DE2FB70E4,0x2A3951555E558728,0xD4DE27DF3E2EBFF4,0xFFB6CB69ACC75D8D,0xAB51C8960A87DF53,0x895CE77855F9AFD2,0x36B2377A209962E5,0x77837D91524AF89C,0x92298AA9DE8C4A55,0xE54C4227DC826E1C,0xB3BE3390D375B97E,0xCE0A933AAD7CE47D,0x7ACB6964CC7261E4,0xA86012225D130D96,0x2C09C6B54CFCFAF1,0x490EA3A0CF334F58,0x47B4C8905694BBE1,0x5260CB9F2F8EA05A,0x39259B19C39CA05F,0xC1BC1B8A5AA67C6B,0xD9757FAB956617BA,0xC4BFA8F80937118D,0x59481BA67136FCF1,0x7B9040E912A4EA1,0x2270A1F43A18098E,0xEAF677B65FA8A40,0xCCA22A4A1FC7433F,0xD6AD3D0B48A10776,0x26C12212366CBF6E,0x9E437CA2E2CAD79D,0x2E0309EF5F2EBDB1,0x183A28D5B0D656FF,0x5B0311DB2CD63603,0x71AA6A2F0208FC46,0x8AADE09D284D2B86,0x428AFDCAA63B06E,0xFB8E752BCC547A9,0x49F8918E2DC5FFBC,0x25281901DECB32C,0x412B9F2CF0E60079,0x84D421ACEBF9E529,0x60C848F2DC20EC23,0xC7AF90C5FC07B06B,0xA1F44380A2D59F2B,0xE5D8756E0C3EFFB7,0x11FB2E1F7BAAB75A,0x338FB3F98A204FD0,0x26F0AA3C95EE2A6B,0xA8F01F16717271B9,0x81E9E7612B0E4BCE,0x165FAFDA0B5E4A40,0xE4E1DBF4388028C0,0x1073851035816B77,0xECF7FE1783A38672,0x2D581D395A36F669,0x8112F193D4649FEA,0xE354CDA241A4A73E,0x99D9C76822DA4A29,0x297DBAD88EF053F9,0x6DBAC05AFA907A23,0x8452AC966C087132,0xB34A70D5AC13FB8C,0xAA6E5BB6733B4BB0,0xBA172498AF5A8211,0x70FF391C9D345B04,0x32089D2C6AD6199B,0x2D3F2F7AD2E2AB65,0xD78BC33933604161,0xFC85193CBD98FD69,0xD4109F723B3DF74F,0xD724351CCF90F653,0x3FF406EF0BE27DA3,0x52E59AF01BE23E89,0x9EDCA2C3E5F3B330,0x3DE9177F07328831,0xD0764B65C2DFEDCA,0x3EFB664623EEAD3F,0x139711196A42A037,0x1090EAA386FB31A8,0x883842C6E1BC2105,0xBE8796DB2B90A437,0x570AAA413775DFFB,0xB73833BDAAE31047,0x729CB628AF931FC1,0xB915B7889D38C06A,0x145143011E40A843,0xC148F260F73A1A6B,0x5BDFCAB88CC62A9B,0xD9F6166CE6292D26,0x969DAA52492D900B,0x1CA08719184AFC6F,0xE591C62C2F46B4D7,0xB18666D28D4F44C5,0x639E8A4EA31DD813,0xD6218A048A54AAB5,0x98692EF468EC3185,0xC55B2DE435555EC3,0xB739D4CB4D58B663,0x67CBB32D0502A940,0x80DCC55011762DB5,0x2DBCF31839B069B4,0xD8ED11B32DF72E0B,0xA702E444F81F0A83,0x7A8C6BB4DA2434F1,0x7AA365BA6A18440B,0x2437F0D5BB0A2298,0xB861E76BA27B15F1,0x731EE2A006FD5120,0x9AD0C5A6374B4A86,0xDEA601233F857293,0x613F3705BEA060B4,0x7E54CB377175F94E,0xB4C8F59204E526EA,0xFB91087FE596EC02,0x72F7E39FB49FC0BA,0xA2EFF78CEBC29932,0xDD7B1A7458742205,0x5D023856BF4C9AB2,0xC91E7DFEE6F07739,0xD9101AFF302E59F6,0xA681A230BE3E4A24,0xB0FB407889558D1A,0x6D7810EB34D1A1E3,0xE87274DCAEC35329,0xE8CE8BAA294AD605,0xA56B5C6A4349684D,0x949A46B6409BF541,0x21754B7D780A311,0x2EC137C692A52458,0xEC6D10B2D602CDDF,0x5266F1D2AEF6F73A,0x8E654C1A28DAD371,0x7BB893EF8F683419,0xBD3B265153D3BA2D,0x16B754A9C2FD8E74,0x81A27DBBC2296EB2,0xBF3497E24DEAD835,0x7E2BC58952835E3B,0xA7C372501A8A3B23,0x5BD19E1149597B09,0x2DCB8CA1FE6895AB,0x83E8210E2B5723F2,0x7DF2AFED58568A,0x717804C8C8DA67BF,0x5437DF794F3A1FAA,0x4190C67D524CD0DC,0x7992D566A90CD49C,0xB27B08E34AC92345,0xFF02104E431CCA25,0x840F81C8B23F1122,0xD65B4E942A960E26,0xAA3F0A9E20917995,0x69CD279BFCFE278E,0x1072B16512C86D96,0x96A0632EBDD87FA3,0x5C61336874E84777,0x4FC75A7251431C6,0x5CF63381522A9972,0xA4C84E0CB47D2F16,0xD993C02BC3A99162,0x697995B2B26B6CD4,0xCF3FA9D6B87D2277,0x445B6F53EA9E6A6F,0x8C0EB38E4459EE,0x63F7CF92622A91BF,0x60EF2F9A22C75C6D,0x8F38E50ADC31E1C2,0xFE3891B19F28B05F,0x39B1D02A82A412D3,0x3A99D838C9A7E1A7,0xCE75744CB55A9B5,0x965EA50BC3B24F5B,0xC9666089A105E4BD,0xE07943643E972CC4,0xBC88293FA9783DEB,0x35705F8A1AB3E367,0x54CEFF81D65925A1,0x53367B4589EB191D,0x47B485915DC62445,0xD0905E590E711B1A,0xF9F66C74E3167674,0x854D2E21A9863405,0xEC6AB0F95905E8F0,0x2B3F2546A5C7ED4F,0xDBE717677A78CC44,0x56943E0C3826FD0D,0xD3FF790CDA1D2927,0xC2B66CA01C228D6C,0x93956DF263A4A0DC,0x6E544F5DBF10461B,0x711F9BE10FCB4E6B,0xBA5E2010650D3EE0,0x830B1CF1020074B8,0xDBD50CFC0081C308,0xB808915F3B0D8766,0x1A3EA72E4830538F,0xF1EA3BEE2C40F823,0x94FC2CFCFFCE172C,0x7CB81DD9FBD57E82,0xD4D1973154415E9B,0xB8263BF236C755A5,0x3B3AC5F69E21EAB7,0x7EF0501CDC9F69F6,0x6164A393993354D7,0xAA5FEAAE62F40979,0xE3AACA4B344A6492,0xE7D55A9EFD3E9475,0x689621FADCB043F,0x51EC3CEC568ABB81,0x6FC03AECD995B8CC,0x3E2705A53B1D4A09,0x96205EB96C14F85F,0x673A321A632EAD3B,0x4244303B05A2EF30,0x537D4AFC3C6E5A9B,0x32E7B8CFE85DB282,0x29D9CA677F5D2A36,0x3640C9BF5BF56ED8,0x73F3DA3B1BFA714B,0x6DE0DFF01BAFA2BC,0x7E27CBB7DF2BAE69,0xBE3274CCADBCC99,0x39073821D1E47645,0xB9DDE5F54A275DFF,0xCD3F86829B5968C9,0x7AACE64DEE426629,0x2CFF537DCB91BDF5,0x1A14B471E6F52A55,0x9C8254FD6ED020B7,0x780E1FA7EA99BE9A,0x3C3B85A84C954686,0x162DAE7141F06640,0xC54A9DA207D0D713,0xEBB9FF9FD0CF4CB2,0x67386FF623605BB2,0x67C2FA3B5006F779,0x7A7B42D5C86E7EDF,0xA07F53F5EED824F,0x6D4D0805396CE83B,0xB5186C080A343976,0xECFFA90DECC6D406,0xCA8F3804D06FF7BF,0x43C223EA02402E66,0x79B52EC5A9AB6229,0x8462CDB3E1DA954A,0x30E2D00B68214AB1,0xE2B3F860B1A40B7B,0xF7AACF0E52319649,0x4F1CAAB808618FF8,0xA713C2357FA1526D,0x950E5A2F4659D2BD,0x91DA52005030F41,0x5FB8641E415105C3,0xE9E7D9BE2DE2136A,0xB5CC1BD0A7024484,0x56E414973C2A8C0E,0xE8466DBC1A7E794F,0x52E0301351FCDEC5,0x43892D65E9AE6F1B,0x8137826EBA634D9F,0x7D1D107CFA0B3F0F,0x1864096A95E36EBA,0x1B0F8D3B4EE07EE0,0x18476AA515A4460B,0xBD6CA019F46AB947,0xF4141D223F2B1C76,0x8924DF54D314FD78,0xEFE2B06D5134CD46,0x30C1D2072FB75567,0xE20A252886E4FE1D,0xF165EAD0AA08F3B6,0x42C9A22D6724F283,0xA2E55F2C91545EAD,0x72C7CC058228E633,0x9780872414DA43F8,0xE383E18054CA323B,0x3EE1A6D743332852,0x3C482AC51A8E85DC,0xD5FF242D0AFC5855,0x692665178199313C,0x4686BC3BFDBB5348,0xE7B45027762DEFE7,0xDAE61414743C8D1D,0x7AD72DFA04253E47,0xDAA51A56DBEC0391,0x75EAB09F5E974116,0x3AFFD31224BF9207,0xAC50C24F47D00104,0x9C931A1395CC1AE9,0x8D76C231AB0E62A1,0xCD0F6D8C76DD22A7,0x73CB9EAA55D097EB,0x50402A290336E9AF,0x425BBE19F25A57AB,0x446468040E515438,0xF58D3BBA4A469D70,0xBF02D50FC8112D5B,0x64A38E41CEF44EEB,0x252B3E511E67DD84,0x97915D82C999021F,0x80A39DDADDA2585C,0xFE89392FAC7394F2,0x489BA9F867E58A85,0x75690DF4B79CDDCC,0x779023E7E53EB834,0x6B6014A58DEBCCF3,0x4BD41CDB13AC8486,0x873D736C20070A10,0x89BC3C904E08199E,0x2FE39C7786330945,0xF7C1BF3F9EB7C65E,0xFB1E434B5C3D0CEE,0x41754DC6001F6313,0x5266B2AB5BDC4B54,0x1C751EF63BF4D501,0xE5D813FA6F741B01,0x66EE98F15844BE4D,0xE7B6A36E4BDF7C4C,0x19AD76EC04A73800,0x9856853A6FCF4F85,0x3EBA706E071AA76A,0xD6436470CD2C1484,0x4F035D45FC2856F8,0xE0E682049E26249,0x336E2A96F643C9D5,0x92EBF838856DCF63,0x3689A4961280354,0xE43577CB2EC4FFD6,0x941BFBB789EE4863,0x932BEE6E64F0144E,0xD59511AF30BE1934,0xD69C6BA96938C9C1,0xE916D57851F785AB,0x3CC2AA893E5C4911,0x206A708429803A39,0xB96BD3A32937D44E,0x6652E84A43F51B8B,0x3C2C878E6683CE75,0xDC8D5832207C2EAD,0xB6B621402486C3E4,0xB23E0F9B63D009A8,0xF0C9E5565CB32F4B,0x750EA8475280B86D,0x98FA166AB01A46F7,0xAEAB3904F55BB907,0xA2AACDCE82B8394,0x566C977EEAE1C0D1,0x259BE71D8A81D4FA,0x4A8C381C258A124D,0x383461852896D73D,0x96CFB880BAC634CE,0xB1495D79F52B9EEE,0x3A9A35C27C7B6D3C,0xE1440F5C29913E5D,0x36E4BBBE16306470,0x220BB75D2FDC7141,0xC33666575B6C63DB,0x584E143398F9661C,0xE3872E56266EDEDC,0xB3E8CE9ABB5AD331,0x37088D2C63AC4C01,0x99DFE4CAC19D527F,0x54A2F9B7AD878EB5,0xC296E8407A7E3E69,0xEF37E704F02B50F3,0x2B52F77101390E6F,0xCF59B5FEF38A9930,0xD390851FAFF577C2,0x6C4F5AA91D39455C,0x66831E1107966731,0x380902AACBEF8EDD,0xAD38642974DA79B6,0xEFF44B1774BDC08F,0x1DBA5F84560D5943,0x204EF9C415A885DE,0xC600DDAA3EAEB670,0x5A50E8F361E4CFB1,0xAC7090FFDF63A3A0,0x1F8DDF94E5D56F59,0xD6AD454C9B73DD75,0xEFC75C3D53F60CB1,0x7BFF320D45B40B56,0x289497A4BA9049E0,0xA52E1AE3848A506B,0x5B5405C7B1021630,0xA4A53492861BFB22,0xC281E62EC347918C,0xC52E851E33ADFEE7,0x5F607C9E85F2ECC5,0x907872AE773E60D2,0x676D58067087BA0A,0xEF387B90B8B97EDA,0xF37B149B1A382D5B,0x3EC357F31CEA229D,0x776D5F57819A1E41,0x565DC75434CCE76E,0x5F5FDED45A3345C9,0x8181C267AB5DE670,0xF064FD8FB64821D1,0x6A84D4B060E73EF5,0x89609F1D3BE65A34,0x3ECCF6485789A1D6,0xE085C345EE8A8E00,0x31240ACBC2A082EA,0x674C330ABC93304B,0xEFA2B6B7AB16294E,0x7CCB2F844CA7C337,0x9AD14335D95C64BA,0x15263A2A8A135DF3,0xB055330FF3BFD8A6,0xE3D5A2DE522F29C1,0xD33BCB9F50C1E588,0x10140D9546976B7F,0xFD2D7766E325A3B2,0x568A5F4040D722C0,0xE0A0D0E41195BAC0,0x3BBF563E688265AF,0xF65CE7345EAFDBE2,0x4F239EFD194C236,0x771C914E893FD9EB,0x4A3BD6441F87BBF1,0x93559B7C58C7660C,0xCB7327FDCE6757E1,0x8644ACAF2A301B7E,0xEB205B72FDDFDFC6,0x705A7AB2D4BC0A9B,0x5F93A870D439E8B4,0x2DC05627BC628AF,0x4FF4A601A84AE24A,0xE968651CFDDDE20B,0x90F2F734B18CEBF,0xA9FF721056B7254E,0x148193D59AAB6D14,0x43DFCD4B65960E46,0x10F23FF10E9AA211,0xA8762533460B016B,0xECD5F8110C183253,0x1BB5389ACC6BFCFC,0x7754DB9F9579CEE4,0x14EBA27C5B556497,0x5DDADC6F9EA8B04,0xF1617CCA9785B3DA,0x9C63D805CB2ABDB5,0x6A3837CF4CF46A9D,0xA4C157F5AAD56833,0x9A6FA1C41236F7D3,0xC02C4AB8A5C744D7,0x755C848B9B13C696,0x2DF241BBC3BB2698,0x5B7F4CBFA7B6871,0x92BC68FD9EBF7832,0xDC198F70124270BE,0xA74429530D79E338,0x454108124161B7D7,0xF75E68D9DCB8C80B,0x92F9E3A242F41E98,0xC1204DBD7B8A643E,0x8EAC8FBDF8A3830E,0xDF1A809B241FEE24,0xE8B2E2E978035EF0,0x5D0510F58106E4FF,0x48D90B19F701DC3,0x423F801F012D944B,0x2B5801E768BECF3C,0x469AD8A2B1EBB937,0xE00868707690F6A7,0xDAFB2A5B123922B,0x8D51A58AA12E95D0,0xB56783BB72003C9A,0xD11FB55020B6F371,0xE6896553A815F074,0x1AF2787435531EA9,0x992BFEB6732434E5,0xFFD4786D6EA9F414,0xDC14EA9673A80516,0x94CC17D69C81292D,0x358E7369E46B466E,0xC4A38E060739AAF9,0x740F6E63EE1C1D43,0xBFB1BDBC26BB9501,0xCE1864BA99DCF3C2,0x953124DAB474F504,0x4B04D06A9A9A2186,0xE48394E21867C,0xC7DB642109D72AF8,0x6C8F0A6A6EFD073C,0xD8FE716A11BE669A,0xBDAA517C3D10DB80,0x706D6DF51D119A27,0xE3CF1CD0E11083B3,0x7B537987214FC5A3,0x86A327F828FE34D1,0x98D2FC8206AB54E0,0xF9DAC8C6B952C2B,0xA4337AACEADDAA8E,0xC29BDAAD2623309A,0xBB7E639305F91EF7,0x174A79E28AE4782E,0x62013EEF72D4454F,0x1DE8C13F47D5A73F,0x5D602AB9F6E93843,0xFA5313EFD99BB771,0xE0CE913C020B2907,0x1AE8EF20D4D96E11,0xB9784D6C7219851B,0x3B327805C3CAF8DC,0xD1CEC1802EBF7D03,0xA62957B100C8DE6D,0xECF30459397D5190,0xC0964AABD3C0CC7E,0x31C8B7F8E00B5A7,0x9D0B099EEAD74270,0x5CFA0003D667CD0F,0x318F6CC45BC7DB75,0x98188EDB7446A033,0x9A7045411AC5794F,0x6CD6A4BE55F8343E,0xE7585CE3CDD6F47E,0x85CC9F47ACE575F1,0xE46E59812BDC8B7,0x37E75188C827C483,0xF32B2D960EF3FA6E,0xD5FD8DD00FB16F99,0x952F7C7A0CC86DA0,0x41C6C46BCEFF9949,0xCE9266D07017085A,0xA21271C08AEE8291,0xFE45CC32BB79DB76,0xA6CBDB5046B458B,0x3E79E8FD627F8207,0xB1DF64EC54DC6021,0xA283F9C6621A9294,0x8615C476E6BA23D8,0x340CF8A9750C3D1A,0x97A5024CE91641F1,0xFD49725F3FE7EE13,0xA6E4F7A73ABC4A76,0x61AD5054653814F5,0x625263BFD08AE230,0xD21650BDA0F10841,0x65F606616F48186B,0x5ADE92AC7A2490B6,0xC3CF96F73FC43848,0xF40767E41852FB72,0xACF74B377C634277,0x29AB4A18A37441C7,0x29637E6F2B8E5690,0x8F76B2250AC806FA,0xBBC29EBE6E1A48FA,0x486FF5D06E9659F1,0x1AF90EB93E0012D6,0x931D15B1D60C81B0,0x703C4F7316B7195D,0x5E3ED023C0E7CC7C,0x4BC3E5D2FB0A1665,0xFCEF367B86651ED3,0x2C0E0814582947D3,0xCD17096A98584C2B,0x6FF322107B12B749,0x828F3FAE99DA791A,0x48AA9CAAAB71C7B8,0x8FCC41E6E43728AA,0xC68B0868CFA1B72F,0x52DC717C5008D9DA,0xA4991DF2B554184E,0x34D5EB1E6F706A50,0x3611A662967FC11C,0x9F05118582DBA146,0xF8F0D1290FE81BC5,0x616D6688F78D1729,0x71A6F836422FDD2B,0xFAF127E6FF05E72E,0xA759D3AD1579CBCB,0x3AABE0CD8115D72E,0x120E577522852984,0x14C30F326F5883DA,0x33B15CA8B699DF5B,0xA86260972774CF88,0x9132751EA3609EE,0x26C582EF5CD8A3A2,0x666853720ADE415D,0x7705F42EDD7BAD81,0xE7DD1EBCA8D2DE3,0xEE92B4A78668B1CE,0x85A06221E981406B,0x2CA28CCB7CECACE7,0x544DCD3126D76335,0xFA6FA5156AD5C8D,0x2FB38A412252BDF6,0x58103281724A16DE,0x584EEB682A158C47,0xC7B4A5CCCF31FA28,0x895C996CADF26E19,0x45A989529B3F2C25,0x693B9B4C2F3B9312,0x78587F1408317CE,0xD6C8EFC46788359,0x67B3687F7C69B969,0x9286D4F3BBB483D0,0x80CA040BF6D2FA31,0x6109CAB6F2F7BB46,0xEC552A25287441B8,0x69AA35F3F391CDBA,0x44DD5E8545C5376F,0xCF62A74234A425DB,0xAEFE34E8C6A5734B,0x14F6AFFEDAA326C3,0xED8D0AF79CFA040D,0x865FD8AC99AF6852,0xDAE47D07294589FC,0x6E9A5327B5FDB44C,0x1A84C6BBF1FCC329,0x8D862F78BA8A0C4C,0xB20280920F18CE68,0xB88224D7000C5E8B,0x1B6B8B2C731B0C3B,0x974E385E2B593AD0,0x65395D04908A6F78,0xA11E96BAF56824EE,0x7497E3ECE98A291B,0x9586B50628529A63,0xE2E0A9E99F465D83,0x3D1C2138A70E7348,0x11A87C58414E6C46,0x7A6F7DFA98599242,0xAE6BE5940D835FA,0x75CC8931A11128C9,0x4FB031EC3F28B77C,0x95CCC9C5DC3BBF2,0xF7A6291F5AE831D1,0xD635755A3659101C,0x649D7167E25976C9,0xA71470E61CE061AE,0x3892A85343809530,0x54B88AF600DB0C95,0xF504C9571E86CF76,0x2A1E3EE300513E84,0x271FD9228830C5F4,0x78BF797A07B0C7C,0x9B55331B5F9C67C8,0x23AB41CD7BD481B9,0xB84E5B0DD408418E,0xDBAD1B5E0100936B,0x8D59CDA8F573220D,0xC337674BFF27442B,0xD0333868D1D47D97,0x80AD0C08672402C2,0xC9892FE6CC695923,0xFF6EC8172B647C9E,0x69A1136FA3794E40,0xD777171FC10DBDA,0xD078F914C227CF7B,0xDA41896C7810BBB,0x72930FB68F9B4179,0x80C6F609D860930C,0x59632E3312C5FFDF,0xF5EB76164CE420A5,0x414AC8390B655576,0xB5F751D7204D8B1A,0x529DE110B096B460,0x16A1E7B3E8F85EB9,0xACB8B29F6BEB8B58,0x318195DFBDDB6FFA,0xDF0800F98C6064FB,0xAB564B6E85995DBB,0x88600576EDB50BD2,0xE5546772B54C0EEE,0x616C54D34FFE092C,0xF841B04B93D27BA9,0xF253153116210E81,0x2D1E9C333C5B2D4B,0x3AADA29651BD7786,0x2A3AA41B5A7E92FA,0x944042019AAAD145,0xA0BF4C723F7D0831,0xFF94E450D8F794CD,0xD808EAD42CF65DA5,0x7A207DD1AEF9D26E,0x219ED949271099BA,0x2F2F3B8D58302682,0xC88945F4DD99D7E0,0x5927F0EB6A8C0001,0x64F5ED1652910707,0x2CB53B9DB9AB03C1,0x31AE99BF71F99FDF,0xF05E12C1DE78B9F2,0xDD07F250CCC73F1A,0xD69CE161FE614531,0x1164A75E490C27B6,0x4F8678C02360C3D2,0xF1D0B0CE940F620D,0xFE0BEB152470B0B8,0x8FDC19B6566720CA,0x1A43F9BE4B6AAB67,0x2936060DABE3BC7C,0xCC11C02D491BBBBB,0xD13EF24D43A8E864,0x465DA23A52B88B07,0xDF7F16323520B858,0x2F0966A034F5ADC6,0xF249567F2E83E093,0x22F25CEE5BAA4944,0xCEA81DACD6DA3ADB,0xB738B2E1369125F6,0x1F1450A1F4852E10,0xD8DECC82BA81E8D9,0x586035D0F620ADEE,0x9E1D4641E6A5C2F0,0x3CAC0DB32E69B1B8,0x4B995F8441EAC13B,0xB8581B151258A47D,0x3BD9AF4ED006CA00,0xC4FBBBC915C04DF9,0xB9BE1957DDE28FC8,0x4F256B9F00ACB695,0xDF21396D0886D8F7,0xE44C8536D6F264FC,0x77A7B5685F038D01,0x7743BAF85DF35E38,0xCD2B99375CA577C6,0xC24FF3ECDBA75CAC,0xC80B42F8AEC90782,0x443206C9783C69F1,0x6B604293CA9BF4E0,0xA6D3C21763E25496,0x3CFFD51CE515454,0xA595AA1819B05EA0,0xF575D68F532124C,0xF62AFE29E168F6E0,0xE6A27CDA42887F93,0xC4493521BAA12CCE,0x7BF080B6E9DA59BA,0xF509A0F327DF0ADD,0xC9F6D856F39266AF,0xA8F0E4FAD3A68800,0x53F0C32557EF5D43,0x7B6C12F588333BA9,0x48963DA591ECAAF,0x1A6EB10909EB6840,0x375B1B37EF136A49,0x3AF124228E3EAF07,0x1C55C6E8F7E0027C,0x8316C9B9D1E7C6F9,0x189E96FAC892B16,0x6DA5DF2F00E56237,0xE72DE3350869DA0C,0x781030C356161426,0x840F7B4124045541,0xF1A3507F1CCB5AB2,0x3A6A8B40F4CEF984,0xC93D3E846508BAF3,0x4E84B27CF8AA616F,0x60C742268AC666E4,0x52BD224DF16926E9,0x60642EDE690B1018,0xC55C44E111865A0F,0x940BFADAD95A939F,0xA634868C7A532A58,0xDB98FB9902F6B17C,0x7701647A03967883,0x791C60FDE763B02C,0xA65F85EADA8FCE58,0x8B363F1214B75578,0x93270A4C77D1DCB1,0xA3DDD8C7699A4B48,0x11E6F76C331CFCE,0x1D287C5DA2285371,0x38D116A5A4F69C5B,0xF03BD9D28197A400,0xC08C0C34ECB97688,0xB56CE5A91FCC8552,0x2D37C46EADE98E63,0x32E12CCFF254D37A,0x2825919430010B91,0x173E12E4AAA563A1,0xD2041B451EDC1C66,0xC98FBB17B1EC9BA1,0x4C70DC8FBB218E4E,0xEBB6A19519CEBE34,0x41A58057D21172EA,0xE8BC7181CB760A3,0x842F188EE807AF8B,0xEC859204FA292EDF,0x5FBB9E5C4B211A4,0x608D1A3E3DEAEBAF,0xAA434D7D0A89A95C,0x6D2024112D9A9660,0x54F72D02D777FBCB,0x3C041FAC0ACE6A45,0xB3740C450B9A06AE,0x92E48B0F5D4E76F2,0x2F700943A3341959,0x5824DB463E853B3E,0x7BBF11C251338D41,0x918B101666F9CB83,0xFAFBA6521BA828B9,0xCB7FE0F272C209AB,0x15A7798AEEFAC562,0x9A9BC0C3D955A625,0x40ED52FB5B42D9FB,0xAB3A622E50A5CCE2,0x86A2F61D43CBFF3E,0xF685596DB2F81084,0x612EE6D9325A3B16,0xA8236CAFF38CEF7C,0x575A7688415EEE2A,0xFF7C26AC7D71757C,0x41B592D7008A639E,0x3573EC2255786C32,0x4D9375FB05743625,0x6353C1BD2A5E7EA9,0xB83DA0A55841C11A,0xEB551BF55D9D9721,0xC0967BD19C389A28,0x992FDA8495111E7E,0xEDF2663D6A2097BD,0x4B9EEFBC1906C36A,0x8DD7F37773EBD5B9,0xE9694EE166E27C86,0xE6887182A0B2C89,0xCA63545216190A04,0x8E4CE3E418A4A18A,0xDA9DD27943055A8D,0x3B2E94EC82DA9C40,0xEFE7FA2B8F97F8BF,0x524ADF7DCA7AB2FD,0x6424B1392993B4E8,0x91F6DFBE57E45538,0x1A169A00A9C3A74E,0x6CDC48346A1C4FCF,0x4BE1DC2DE96B1199,0xB2C27348224E729C,0xFFC169CFE58B4AE2,0xFFD62C221C935ADB,0xA1C98227D7D82333,0x38BED19EB5C34B41,0x8F9CF4C6161EB431,0xB4BB3DD3A6D3F304,0xA7CF0480510EE046,0xE76F74E4C982A0D4,0xFE2E7ACE70D240E,0xF55F8AA504635B5C,0x439313DFB58CA8B9,0x8D48140414CDD574,0x7D12DEAC5A3B4E6,0x40F27244ED9B5A6,0x1E132C341165F83E,0x7D809DF9CCA503F0,0x672D6F3E8E916DB5,0xD007674D8A581D71,0x77DAA17F34FDE49D,0x6975D53533891910,0xC3051E9423297E5C,0xDA0C268B09050750,0x91F40F276617074F,0xFF41A17ED9059E7D,0x143EE419E5A537E6,0x24B36D1854339214,0xC5EF85C408571EAF,0xEAE605592B9C789F,0xA318B59A6358E821,0x3D70C45F9F077E0A,0x2B2ABCEBD9B1F36F,0xF03AFB81ECD7494E,0x282230B7F0E52D56,0xD5F980C0F4DE6597,0xED11291F7127888E,0x100D89BF365E1356,0xB91B042AE29D1DC0,0x80D4C93EC30B0786,0x9CEB2AC24E291FE5,0x70FD47FAC8200A49,0x6FA1E0B637DED988,0x9ADE63CF2AA5FA61,0x14C70C346E2865FB,0xC1538E7E522A1807,0xEA483A47960FF65E,0xF3621FB07D69B631,0xAC598BA78ED25971,0xE71905B28E3F819A,0xA2FA391998A5CA4F,0x3FCF9BCA6FB938F2,0x719970758F252DBF,0x508F3011A3378766,0x350AD43F9C3F2454,0x760C934FF448A9F0,0x90D02DA0EBE3D2A2,0x630EFF47222F5E1D,0xEB54AA925E801335,0x72940F2C0631BBEB,0xC769CAC3FD631439,0xAE494703C93629A7,0xE6523AD46828A3F6,0x221F00BDB6FE967E,0xD9ADAE64ED7472C8,0x548C5E01E1FF757E,0x67269D2788D6D1B2,0xF285480DF661C3D,0xEDE8FBBC2E485227,0x941DD7AC53C9EC22,0x1B045571F6FA298C,0x329713E68B100498,0x88D5C9BF47388E35,0x4C7D89621410F77E,0x50BF6070C8D9F49F,0x1CF82FBB85DD6ABB,0xA186CBB04F0BBCFE,0xCA4490F4B172921A,0x4A3EF58902440342,0x659F4E947AD2B02A,0x50F77CF468D67786,0x9FA5724BA444B78F,0x386D5FB82562D9A7,0x38FC0304403CC66,0xAAEAC50F94519B77,0x9C9F041189C7B5E6,0xFAB208D4EE01DCE,0x51223729D9AEA4FF,0x1A863223E987A73F,0x89CB07C992FD7482,0xCF78529B9B88C73E,0xDBDCE53A650E5E77,0x9F37D3068C21188B,0x3CC95BC25EF390A3,0xA96F57BEEBDCD7FD,0x7FCBCE6EE93B0340,0xF8C98B298DDC5D32,0xF0B9CB44987DE499,0x1325E9C90489B378,0x99328D758CDC23F7,0x371A8C274440C46A,0xB47B9148D14503E5,0x684BD5689373BE09,0x4836A505A59A567B,0xEFB96B0F8AFC55E7,0x2630B46C64BCAAE2,0xF215BF4F28EC3017,0xD3ABBB1A96756065,0xF68338683C568951,0x46A8E0CD89EA583B,0x3537BA3FCD2A039A,0xED43EEB7E19CF2E3,0xD2C8AF03369DD71B,0x5B04C6D6A21F6BDE,0x4625293E9A8A8039,0x4BD15CBD0A9222DD,0xCDD1396DEA43BDA8,0x7B03AA631D3DC516,0xD905BB02623EB466,0x9908830BDC036C61,0x6D9B2D5FF44B7412,0x7B2248C7C15BE57A,0x7F9682CABF083921,0x82BF0C9FB824099C,0x4D301F952E820ABF,0xF13CC26EA89AA7F8,0x675E746FC2A4FB77,0x7114D68882DD5DFB,0x2970B68950960A6C,0xB48B26002E1AA60A,0x40072633F87B9108,0xA95EC1B907F29ED9,0x41D32B3516729590,0x81A3B28FEE8BC3E2,0x339EF7B9AE008FA8,0xA40024641239312A,0xB0BAD388315F2608,0xBA1BC83D99F914EB,0xCAA6345ABFF6EA75,0xC155FF33EAAF8C90,0xEA2F05FA7C5B9D4,0xD7F11E9496A00370,0x7C1CE15F51FA4860,0xBD30FDBCFA1FA6FE,0xD3DAE430946FA2C0,0xF629F308639591F4,0x1F6CBC74AC659452,0xCC5FFCD1D8510D21,0x492808CC0E1DB266,0xA6B31A9A2BC308B5,0xC11595E99C048D43,0x2F3C05A368B66B3,0x10A691F5756416D0,0x68F94159C38F25F8,0x11FD0D892567AF52,0xCE650C981E786BEB,0x410BD6C72A6CE17A,0x9E495BCF3E7FA74,0x7EA06F970F999394,0x5649CA22AF74E019,0xBD642335A732F1A8,0x961D4157B9B428DB,0x151D6C04C9E2742F,0xE6D323A5E9EFFB76,0xBEB0D930B3CCE4D5,0x12C01FC00B0CBB6B,0x6C39BDF5EA5D38FC,0xD87B2B089732DAFC,0x9C71253F91C37F27,0xE3D86F90541BD5EF,0xEC9DAA34BBB4658C,0x99EE60555ADD76D0,0x6252BC0DD8A320DB,0x65694862DDC9E5D0,0x55098D9E9AD58806,0xE7D342E0F16AAA8F,0x441B9C85D0FFA9ED,0xBA4223DE7F0708BA,0xAD1840C2E6AF7D5E,0xEA2D52183C7EA9CF,0x91AA33D82EA60124,0xB1625FCB7B6A7982,0xCAB6FA8C9D44F90A,0xBBE75ED2B58BB1F7,0x80813AC549A1E8AE,0xE100DD4F82A51BDE,0x268BE77F77533D03,0xA336AFF285251641,0x60C643DC13B0C72B,0x13F0C01028B5EE7C,0x73DEEAB0747FB17C,0x8175BC6D49412468,0x9B64A44D0B8D7CF6,0xECFC57F5F11BCD83,0x5373E9377066509E,0x5AEB336317DC4151,0x461E44FC144D65C1,0x548BCB9EBC09A967,0x5A9ACBB54EEA813F,0xD82473EFEF7FC622,0x9E635675ADA39E95,0xD81FEE0302584F60,0x3A03D0433769C629,0x684D65D3F0BFF960,0x8003D3C0115A1035,0x6F13318788EDDAD8,0xAE427DA16687F323,0xEBEE7DC21AB44EC9,0x939D49C9FAA8139A,0x90D778E278B533C0,0x283C0970282AA5F3,0xAD9B1C8FED6B4D96,0xE3F88173F42C071B,0x2D8D239B3F1D13F9,0xD410E6FC0A0C97D2,0x4C052E5245B17920,0x9E3DFB4BEB42BEDF,0x8BAB92052AD69AC5,0x8F8802BEE0727FD5,0xE9D3D741E2195673,0x4F6F8824BE43F1F7,0xDA771B84868AEA60,0x6C730FCE8A68AF6F,0xE945B67B28139DA2,0x5561E31B168FA823,0x8240737C161141A9,0xAC48F8E2BF2BEBF7,0x4A3280817398D754,0x6981C3213B841071,0x787F8EE1F6FBDC6D,0x9E2D35FA908F57B4,0xB032847A7F7F0BFE,0x8DD44A3F0D8EBD63,0xF4DB2666A609235A,0x3555462DB47B7AB1,0x1403FEB4554982F8,0xE4B27F02458924A3,0x6D231A0D52134FC1,0x1F32174C38BEB883,0xEDACB682D42B6786,0x2291B8E26538A740,0x6A668C52322FABB2,0xC1DDC33C72C3B5A9,0x546ACDD38D665C85,0x50821CA6BB13D3E4,0xBB3CF86DAAC9BAEB,0x43FFAC3C360D589D,0xB286852BCC387913,0x42CE839FFCC10E9,0xE48295FCA7404802,0x6DECE5EA21E009F8,0xB4EDA6C252467FB1,0x846BCB82A586E3AA,0x3F331BE6EB7BAC07,0xED93D3690FF8AF5F,0xE386B6872B2E38EF,0x3E09769A87E0D881,0xD173C7695174C519,0xF8A2800C0B863DB1,0x9091BFD6A05E20ED,0xCA2E379E3CAB622F,0x30379A8083CE8F9,0xC31FD6E2FE1930B9,0x9D8913BC7BA1265D,0xF9B380FD07A8B67E,0xE2B94989E87636A6,0x32BBBA949DBE76E8,0x808A7B80951975C3,0xADF8AA2F22A19163,0xEBCB9138B2CABF20,0x89EAF23AE72CD8A8,0xE9DE8F39ED85311E,0x4B1F30FB3C9A4B7F,0xEB6D4B648B4DD588,0x216049890A2D1EC6,0x6BD0E2C3AF4FF666,0x78081733656ABA54,0x34ABC7A6F0629903,0x6C086599D0704F9E,0x9FF2DDC6AA093A2E,0xA0511280CE71369E,0xFF795413579DFDC5,0x30B10A00315BA0C,0x77B41E941C2D2D17,0x105F8712C3E145BF,0x5524CAF18378DF39,0xFD8B5F4BB15CD71,0xC3EBEA7530D64F53,0xAFC7A89C990C4339,0xB1A40D00F279307,0xAD548E64669C4255,0xFECF11FFA163942B,0xEBA229B2E0BB05E0,0x23EB5FC236231892,0x693BCB64E0E60254,0xF9185EBA84883764,0x2A82E9CBC48CF2F8,0xD62DC69EB22834CE,0x83834BBDF7CA6EC7,0xA81F12900F3749B3,0xC52B4FFE6114ED5E,0xCF6CC9EA0D2EFE23,0x6C33493626F3C0D1,0x7C8E9DE09D4AD3FF,0x329B82704ED2A3E3,0x63C8DCBEC1CF8225,0x3713EFBC9B9F5150,0x2280392018BC0DD3,0x76FB64D39D380B3,0x8B59380D9D15EBCD,0xCEF5F1212D833FEF,0xAB3658A740EED98E,0xFD251F92B546F389,0xD844F5E50DAB6FF7,0x3EE6720350A31CAB,0xDBFFE049CC0EA5E0,0xE092C8C5A5EA5F57,0x761F56E633460973,0xFDBB3471DA96A6F4,0x2D864CC37DDFA963,0x29EE4DD912B2F524,0xA15E9E221AF6CC4,0xA966E518B752B92A,0x505D1BE21E9DF7E0,0x176A19E4589CC2C6,0xDAB3EED1D80C2712,0x828D385CED572E95,0x1DEB47A41CF1C17E,0x753DE44F9049D173,0xF24ADF73381B85C1,0x5514EB508DD5A132,0x78081A114400EA30,0x32ABB6392C917150,0x604F9A1C471B5137,0x19B15B2D6C049166,0x30FAA55EAF29F9BE,0xE4250AD3565B478E,0x8B561CAF821BBFCE,0x10425721983AE158,0x9F5225AA1E102B7A,0x8D8528BA8E43641,0x70BCE9B2354D8E3D,0x24E88846ADF60E68,0xE1C7B23ECC5080B5,0xD395C44C3F7C3BB4,0x8EF3D1BEA34BCB15,0x5D15315EA989E69A,0x5EFA80915529F5C1,0xF6ED7D9DE21CF122,0xA284376577BBECE,0x5BBE12D14B71C12A,0x51495BC78F70B066,0x7B426C13A6E40397,0x3D98759970C5FCC9,0xE237FA90A8AFEE59,0xE67051907958B5EB,0x84B06A81C98DA4B8,0xB5396F1FB088FE38,0x93C0674FC00824D0,0x4BD42B0527065BB6,0x9C4B07B40A05D45D,0xD0557B139A542F12,0xC58DD79B4CA8487F,0x89EC60A4485FD199,0x12623527E5B8AB7C,0x9B5C1660CCDF7189,0x927395DFE42BE071,0x92B9247AF00F5CF,0x67F37AE193B6C0E0,0x948C59076639BD77,0x287D43AF8CDBA667,0x71929CB75E82CF02,0x646DE293036A3499,0xE95B96CFEFE7B61,0xC86A930D894F8CE2,0x6C4E9ADFB1521AAC,0x7A55A25242FBE562,0x974022927CB47E68,0xBEB96F1A510EE9AA,0xD5094C4B174E9016,0xF3812FC874B9C273,0x35CBF41D628A3871,0xCD76801E1106CABE,0xFCCE667AD0E974AD,0xB3DA477F44309390,0x13DE13EA38996410,0x30CCF17FEE4BDA53,0x6AA87C4ADF4A6BFF,0x1114FB0D0DF739D0,0xBCDC8EFDC767C85B,0xE4B10D5B4C7A3BEB,0x5D374B426098D36A,0x7F9BCC1F05831CC1,0xBAA88971DB28023A,0x6793968E12D821E5,0x6F09ACD24CD7E2D1,0xDF671228EB81F6F6,0xBCF5323C85E59066,0xE61DA9B9D8DB2035,0xF9B70B973193533C,0x790442D9A27FBFC1,0xDAC27BA46D21818F,0xDEA77F41BAFD4054,0x8737E7B1F3150A9F,0xD3EF88657552E38E,0xDD216642D7E1AD6B,0xD83588CA24829967,0xF38F1E299109383A,0x827783BAD5CBE95D,0x10BAD2FED582B598,0x54E6D48F5FEEC68E,0x26CC8B808F859C87,0x5652C0D8FC728983,0x974B2530CABDF56,0xE69B8FE2F4FD0178,0x4663BE37E4E93BC6,0x6CB88242CC3DA778,0xE84EF4129A44CCA3,0x345C12E1D643634F,0x52210330D36ACD48,0x82F4A39274853E9D,0x29643B8A675F8422,0x19626F992DC71FB9,0xDB27D5D6C78A71BD,0x3CB52882A241CEA1,0xA6897CC743103C98,0x864E9BBAA7BFA064,0xA1EF3D61667DA3F4,0x4A01AD13AAA82768,0xD5A6D66C06D8ADB4,0x16C7AB5DAFB71459,0x807D24321098A1C7,0xDC90C3410FA6A9F1,0xBE006B266746B58A,0x2115305B42B198D2,0xB4AC30A54094D002,0x8E8BD1A76D6D9230,0x4CF9046448DA511B,0x62A5310368A20EFA,0xC22FB64C71A7CD89,0xE31B7CB52E42E2B6,0x3D948B91131AF671,0xEC4B308C708928CD,0xF8936AB29F37B33B,0x994B4C04761C0AA0,0x49FC50A5D65452,0x3BD287EC78FB55F,0x849ABF0CBD8EE0D6,0x613C57A8216F81FC,0xAEFEF83576CF9532,0x2CFEEE8E3E154877,0x9B1FD51B92E0C07E,0xDEA4D02E8F52CE87,0x553B31859911EC59,0x24B82F8CB7F8A3E5,0x413BDD7A1192FC87,0xCA32E959324DBA6C,0xB1EEA6106C0A95F5,0x71CFAA5488AD3649,0x1323CB5E215AACEC,0x21B9EFA4B4AA3A5B,0x634E47EF112F3802,0xFC8E18D52935E5EB,0xCDA51E8BE6E5790A,0xB50A89E4C8C2A37C,0x449C7EE823FE407B,0x81E5E9AE1379B068,0x813D79A654EE13DA,0x9C8348AB222FEBA3,0x1FF4AE189014B73E,0x3BD18E9EF59645CF,0xA2FEC91FCC08673E,0x3F4074C23C3682E,0x7DA9B8DF3A97D040,0xDFBE573FB949C828,0xDD0315A8F8B31039,0x3966463F3674C7D5,0x6964489BB575FE9D,0x470041F66BF345BA,0xED8A3DF1DC96764E,0x55057693AB7FCFF9,0x79D8334A10A1DB2E,0x2A89ED7D4265A941,0x6D81908BD7709ABC,0xF6CC23160DD0AAED,0x1D006DA9CB2B79B2,0x1BFCFCC8F6D798A6,0x71A3A3C67C692798,0x550B03C7904C63CD,0xB3FC0E7676E79BF,0xB8943DE03F115DCF,0xCE6BB45648900227,0xFA0AB32CDCA06D33,0xD769493B5A72D117,0x595076DE836264C0,0x62DDD8B4533C8E19,0xF41DCE3B39E05E82,0x2225C9F62E93B943,0x4CC29C988AA182D9,0x253650DCBDD84B3,0x115CA3B4F950226D,0xAB57201DCBB14A07,0xF63C3F5B1BFD9CE4,0xADB09C3437C4CCD,0xE021F54CBB4F4FD1,0x777E107FA017C2BE,0xE61AF8D27706A774,0x3114F582B6F4FD2C,0xB8551FB832F73124,0xA68F93198FAC44EC,0x81C4993E5E1CEB9B,0x2868A36BD27FD939,0x2433FB137DF847D2,0x8A43FAF3B2368B62,0xD04A772C411165F2,0xA08EEC7306CF6198,0x8943BF9E0F15EDA0,0xD352CFACACA313A1,0x653B8254D6830E88,0x2A0C849D5991C7F4,0xC283DA397F6D065D,0x7FD62C74ABB26599,0xBD08B11F7404F5CD,0x9558BBC6B5B65853,0xD4AB5C0D7A1B6058,0x1549A6163A4CED2D,0x2157DED369B9B03F,0xD6C64BE35FD4ED11,0x27EC70BAD907B76B,0xFFD8D929BFEA2C66,0x3A4A0A988D382998,0xF2BE617CD4ED96CD,0x94302E8F619FAF3E,0x5316592ADD122C13,0xA9260F368C3AE393,0x379242666BA2ED8B,0x8CE357AE01230A0B,0x1B24CB0A1764E540,0xF73325FB8144737E,0xA332714024BC3F0C,0x6C9A2A441E73E5E6,0xD60BA488D361DF8C,0x118744F545022B3E,0x43E9B2BD3668B432,0x8DC9348C726B1575,0xD25BEA95F6673491,0x78BCB869DD6BFD3C,0x1A33666733F63EE2,0x5FC3A3680DA3531A,0x6956712D887FB12E,0x2A62B5809D44FA48,0x96F4A599D1C6F95A,0x218240D21FF14E21,0xBED82BCB158AC570,0xE8F1DEE1AE8DBF3E,0x9874D5FB1E8B02CB,0xF73EE77793731309,0xB2E8986FED6B1539,0x998B35A7F4D0F0C7,0x442A7753A4EB7411,0xA6C2BBE598A91988,0x9DC8697AB3A155E7,0x92DF696E2104166F,0xDB1DAB5E0E775E2D,0xE523F21FAB5438DA,0x515111A614F76DC4,0xBF87221921DE71CA,0x6E19562EC08A07C6,0x12C0D6CD0D2EBB6F,0xB6CFA448D6BF4690,0x4A27E73B31F943DC,0x32F6EEF031F943DC,0xF35435F8DC034A5C,0xF6F7567DC74C45CE,0xC1C69295C2020379,0x77FC7BDED929C9BD,0x6CDEFB59235A1FD9,0xA11073DD28E2CD9,0x24433628C02BED5F,0x6F21822F60DC0945,0x3D686813DBBECE04,0x3DA436E63AB0F541,0x883E603A316F6D3B,0x15F4AEC8F54F37B9,0x2F1AD04B7C8A76C3,0xE7D618671D65A1FF,0xBDCCE8FE97AA3A1C,0xBF348C17AF180F42,0x441E4524AA1CF9C,0x7FB6C108C1694163,0x5C47299F055D05B5,0x736821465DA66F80,0x5779387E956077A6,0x8C1F7D7A31B2A38E,0xECB40F3CD8E09468,0xF5706A3E4A060916,0x730536B32F041BA6,0x3E3B4978082BB93C,0x52C90C5E23EB961A,0xD501B0D4146A6A30,0x2E6A27037F1DC473,0x9173EE00A72DCA49,0x7E711C5CE9160738,0xD1F59EC6D37A7EE,0x36B6F306570BAA3F,0xA63572E348CC4CFB,0x5A65DF56B098A5F1,0xEFAF1ADDE0F583C3,0x5519F1C3752E3A90,0x6317659BFF055A5F,0x1DE99C193C7EC64B,0xD735FEDB86CA06C6,0x413E19AD37DE3A4C,0x306C263AAEC4A988,0xD27458C016741B0C,0x1CE980E99A2A6FB6,0xDE3B10768F6103AD,0x2EEC0612337D20CE,0xDC1AA2FE20EEB2E9,0x22007BC82AF0074B,0x333A2A6253C809D2,0xEE6C44D4C8883EC4,0xA0265306DFF63938,0x23D563236A543309,0x40C1C94D5A5157C5,0x3F4A190062FF9E09,0x5D50773C51925144,0xAB2F24F67F293F,0xECDFDC2E8AC2D613,0xB74F181ADFC39BF,0x1F4C790D1AC5AFF9,0xBC5009F300C00558,0x60C8432F4C0BDD68,0x75B56675BF83B3BC,0x7A673862D5A46F24,0xB1BCFB3741AF8B2,0xBF60B9A0E651D89B,0xA7AD7AB3035B02EA,0x827FC1D24FC3CD95,0x5AE614ECA5FDD423,0x92D96892FC06AF22,0xAE89444B15234CCE,0xE251D2995353C61E,0x9EBBAB4F81D0BDAC,0xD213EC7C7B81BCEE,0x9E4B8D8CF051F6DC,0xA648CE821FEF3C51,0x235C228FDD040462,0x6B407F2525E93644,0xB29D0B41AC20799,0xB5A36B0C5D6C2884,0xFE448E8C2209CA31,0xD133EF7430EDCD09,0x2F12C305B28C6C59,0xDA87162A83051958,0x84F5FD9CD27457EE,0xD9B9D4D1CCED7CA6,0x963D9A7202C06F65,0xA9D64A14804D119B,0x593A3115B8AE759B,0x4434FA56DED5500,0x588D8FDC61F7CFAD,0x2C0B2BB7913E8DBA,0x4DC7FAAC148F9B2F,0xD1DBD3830272ECAA,0x8F0EA4C49C452445,0x2041F0CA908ABAC2,0x367040C40E6A5A3A,0xCE1294F698971209,0xBADC5521D958DD40,0xA324C32992621FA4,0x6DBA6A508811E851,0x2D7690E0BF110B40,0x435687668B2C6D06,0x7B92F87655ED3C29,0x3E29597A27D861B2,0x138421810ACE4B5D,0x1E9361E60B23497B,0x3CA987D2B3498078,0xB79D107D2E0D7E43,0xBA1F8721D3730F2B,0x2B45F7B39143EEA,0xF1FCF5569978D854,0xBA929B36B8BB08EB,0x4539850624F18A9E,0xE101D58DA98B6070,0xE21E573B1795892D,0xD05AF216D970F274,0xB7BDF91BE073DCFB,0xFF4B16F297D9CB3E,0xC39AE5D390581AD5,0xFD5C5BBD1FE92BB7,0x6B854773972E76E4,0x9FFEA38DBCE391EC,0x548F6F43A7CB6F45,0x93C337B66C95C99B,0xFF4296DC08BAEC71,0xE5EE5C9DDF05D925,0xE02B4E5EE15725CC,0x52A6C42AB95EADB7,0x1A1E025C1EDC00AB,0xF5B09CD26D48D446,0xAB6C098FE20C23A,0x306E268B106D3D0D,0xD0DE7C657057F36,0x1DB196628F3A0BD8,0x43F2D662C7522C93,0x4218094D251842BD,0x6A5E9E4AC5B61452,0xBD3D97A93EBB67B3,0x7AA69E5CE0F1C51A,0xC43B78AD4315F7FA,0x1E11F329546909B8,0xB1A8644CC087A079,0x91CEBBEA3A7FB79A,0x9647565D7FAB305A,0x8E18C9CFBC30C9FF,0xE488FDAA43A181AE,0xC3680B85B2D7086A,0x439C904840715871,0xE6BE8A525BA6BD44,0x72241E9BCAEB0F8B,0xBFE60A5CC0C835D8,0xBC123B7E0667E87D,0xEB13A0B02F8676C8,0x8E470D78FC866126,0xD3694FA8930DED3C,0x260EEEEBF5F35F72,0x9303D5873A8A413A,0x62DFD44586348C12,0x3BFC7329EC766FED,0x4CF78EBCA2CD7E9E,0x362D577C98803D6D,0xBA3C1A9AA7FD9616,0xAAF00640D5573DA0,0xAA2BF5C4E3F250C0,0xD45558BDBDE86734,0x495F6DB2481DBAEE,0xF1298707777A950B,0xEC6A9F16D3F15978,0xA5498338B4203373,0x3B69BFF3173EC703,0xF89624E52FCBE454,0x9E132DB7E05C6EAB,0x8FB959083319E145,0x157D966854AABDA6,0xA6D8AF5A058A75F0,0x82A7EF211E6B06C9,0x632030977D1CE430,0xBAF583E9A667F5FB,0xF516E954BCB89C18,0x3FEAE59CDE6D3946,0xCA7159F2C5FF745A,0x20DE4C1439E0FC92,0x5D3F682DDA06C20,0x4F06416A18248EA0,0xAE03F542B985A69E,0x767956351E028F74,0x43C8A7F0D458B663,0xB24E78BD1D1F9F3F,0x1A6B031C358F6071,0x47931C69C0D75B43,0x492EE2B9C9BD33C6,0xCD56231706809D19,0xBB7BF0D30DB04384,0xDB7CCABFFA928C83,0x474491073FE815A8,0x67AC1AE8A2697D67,0x95610E68DFCFC225,0xD772E6694B8472A6,0x266D9DB5FCE4003B,0x7821F942CAEEBEE1,0x763EEC52E292B5A0,0x2A03585144C38A2A,0x32D675332B7BEAC5,0x83DB438E821B084,0x1F921E74406AE806,0xE2E30D829A6B8F9E,0x942B90900E176BD7,0x157F3D5A4AAB2C50,0x88556DA0593A0748,0x9CCFFF877AB82ACA,0x44A13535A15C20E0,0x1D2DAF2A41FFC4A0,0x36D3AD4491CD32BA,0x937DE6A451B47D92,0x50D073F91C5243C,0xD99C77F6466B9C48,0x8A5B9B95FED93,0x948DDF2EBE37571B,0x206AB1458FD9522F,0x3EF00C934572535B,0x8BCD7C11D27FB9A1,0x642B7FD807FF696,0xD9CBCF1C9EAC9D15,0x3245F0B28999D460,0x6E859E04BDE20D6E,0x55498986DC9E53BB,0x5D18C448B64290DB,0x1D937F8481AB64F0,0x177C21F54C9A6E9E,0xCCA6D8A84EE8C88A,0x66D94742BB3D032F,0xCE29C0EA93335BD3,0x1C4D3AE530899DF2,0xF0CA45A211FFDCD9,0xB5C59FDCC14C2F22,0xF2A5706EAF041CB1,0x903908AA21114D72,0xC4929897EF5CADC2,0xFCE057EE79E33FA,0xEA4F815FDC353FEF,0xA71279EFEE0ACEB2,0xC6FDED3EB75117,0xBA16CD57E37AC32A,0xD3CE8D1E6564B011,0xAE447CBB33B40CA3,0x78B050AFBA6D1517,0x3801E353091A2E42,0x9910CD0D8626AA28,0xD9BDDEAC04BC910C,0xC43345D94C3E22E,0xA9F7300B498DDED7,0xA83EE494110BC566,0x241E64B7BFB90488,0xCF9C21E54DB720B8,0x89E19F9D79DDCA80,0x6BFFBDE3C98A828E,0x680C862D9FC0F4BC,0xB2CA6639924FA111,0xEFEFBD4EA86918AE,0xF04E476AE02C4646,0x9452FE4900245259,0xB69AE16F62A14003,0x6B0915C0DDD2954F,0xC229299217554C78,0xBE144113897EE678,0x248EA593ACD1C87,0x3E13A302AA0F06BF,0xC1FE4FCB32785633,0x7BFB76C576628F3D,0x11AEF334072BBF99,0x6515021478088FBC,0x89E9F387C190061F,0xD2F21CFC29C914AE,0x9DB4F102351D5D9E,0x4EB5C166706C0781,0x49A1FC25BB73AC77,0x424A62A3138EF2F6,0x9E20DC08879FF3FC,0x6645B56AACA6C57C,0x20DD46D27530FAC7,0x507EE8EDD1D75E9,0x89D1FDCA3735A1E0,0xD6BA8C57BDF9DEB9,0xF04751F8E604D487,0x40891A689350468D,0xA29F097488D811A6,0xE296500BDAD8807A,0x9D756F14B232B644,0xA50C5A6FC93D3B49,0x38A100E16C95161B,0x405766A9221AFD99,0xAD830DCD82C63F31,0xBDE75E2FCBF91A6C,0x8545B773982EAE2B,0x2495CCF0BF303C19,0xCC36CA06DD06AD,0xD2A0543EC400E1A5,0x6C6E46A097D62A34,0x58428BC502F48C75,0xD9DD012396E375D8,0xF66F8D9F1877E201,0xBB361D7264AC4FD8,0x741D9B0685E67684,0xC0C8E6AAA00F1A58,0xE10BD9712D7B0CBF,0x77B012A683295B6E,0x4C5611B5008205EB,0x7C450B28DDDE0513,0xF698038C13845696,0x1D1124C855316790,0x76A218B79DCF8962,0x3DACC5F7E5335AC,0x515A606E0E38355D,0xA6175150F92EE83B,0x8DB4917AFAD347BC,0x64134834C866AE60,0x3F413690B5A371F4,0xCA609B4171C43CE1,0xA80E7D11DB73C8BA,0xC4BCE90F7242F354,0xDEABDA7736297FEB,0x5318DF85BEB6B95F,0xD772F6AA66750D2B,0x579FA5568DE0C2A0,0xFCFC8401A76A332D,0xAB2F41AC28DDBAAE,0x232B023FE4D977E2,0xD6B15DF382A594C7,0x54DA32C15F7A6ABA,0x7943BD10E2A03FAC,0x1F75BC85F714AC5A,0x2915C7D9A225A148,0x17556069075B5519,0xC182FBFDE4682BA3,0x2BDD547718FF1F1A,0xF38E42DE1E8071,0x4C7724D572378B05,0x2AEBE39F6BF7D6BC,0x31D57F4EF7BE9F0B,0x31B58D7972181BFA,0xDF9DC0584881B7AF,0xA24B9FF9863A909D,0x3CA4868519920C8D,0xD9F5E1FEFD1329E4,0x983B8E72C35B01F2,0x2165BE2A3E719A31,0x4058D9ECF3B8E2FC,0x869AEF17062BE178,0xAA8884A4BB5B0167,0x20DA3970E29472BE,0x5FE0938FDE9B0958,0x93E7527CFECC7CD8,0xF7AF4F159FF99F97,0x5A904F31991BA49,0xA1C03303EC67320B,0xA089B04A208DBD0B,0xBA3ECE95D3094B0F,0x5081B6C697A334D4,0xE423A13CB489E307,0xCB19A1CF94809167,0x1D37530E5C420F5,0xFC954C8C860FAB80,0x9C0E5FA1EBC1D84,0xD0BABF27A11D215A,0x151B89DBEF140C19,0x22E252733390A9A9,0x1F46B2A1DBF8BD25,0x4177E9034F7CFE38,0x5EE5180C78E4990,0xE0002557891C8D8C,0xF8190C7705154D4D,0xD1ED03B26BD64F6C,0xB57A96BF24464D21,0xA964B154E331B3E9,0xB7A736A17908838D,0x3B1F6012B676860B,0x8EC15ED9ECD1E9D0,0xC2A036647DD761E4,0x68F7F7C5DF6717F8,0x913602ADD2D86A7A,0x53152C1272227778,0x61F02E4E9A7A61EA,0x24910C3D66BA770D,0x1FCB07FE230B6639,0x1423725069EE1D14,0x56185A25D45A0DCD,0xF9DDA40BC293A61E,0x25F4808C787100D3,0xB3F63B683EB1995A,0x7991957B46F22F47,0x16CFE70936BA84C7,0xCE41CD0179F8640B,0xF20C964ED62BD3A7,0x48BD57D0DD17786A,0xA86C8A254D6B6F40,0xD4BC322888F79B7E,0x1750AA417BEDD270,0x4A64AADF9B40D2AF,0x314C37CF34534BCB,0xDD38B2935A3EAC56,0x741EDDC25DCDC64D,0x8C3B2540B29146AA,0xAD263B112A654D47,0x9636B030D6DE5C35,0x17AB03DCC210B35D,0x9A81B26B3D3B37C7,0x2808DFFEC5749CCF,0x33D71CD5D987771E,0xCEE6D67EEF78C2D7,0xF9FC9D29B8DD92DF,0x8D6ED2284F9E6186,0xDD76094F9005AA09,0x379AF4B11FE63CAF,0xF8EC8E90E8D24CA7,0xFCF78891ECB409E9,0x78004905636369DF,0xE456FB21FF21AE99,0x76FD0E61CB6D5162,0xB2FD24D644A68449,0x9F571FBA7F9412D5,0x6874AA782954505E,0xEA02634993F717CE,0x71052C5B6562E5BD,0xA4109B4CEC071346,0x20974C28142EB370,0x5FC7CC4DB8966A85,0xF651C20D31115698,0x8A86075A9E1BF05A,0xC48C7879875CFB60,0x66C1D6E6DBF7AC9B,0xCDAF96205BABA4DC,0x122F64C5BECB5454,0x7FAB20829167D06E,0xCF85F9C6CDF5D68E,0xB617B59F8F888D2A,0xB245818227933E3A,0x859EED8E8B695F08,0x1C6BE134527C543C,0xD92F8845433585F0,0x4978F96428784EA4,0x25C4079E4C1D71E8,0xF5997120A0F53CD2,0x2525977066141996,0x3EFC9FBA218CD076,0x47F48D6E64EE2C11,0x16C1ECD6E377277D,0x44589DAC2564FF02,0x1B3217FCFCCC3FCF,0xE2F63CAB8DDA4016,0x248319A8E9EA4DA3,0x94F61A08FC26ECDF,0xC536067E456DED6C,0x130DC0384195C42E,0x8B8BD77BD5CC1D17,0x848DE0A81098ECCB,0x7902AD09BBD23276,0x2955FC7A22330E7F,0x90E3EAFF8AAA1A42,0xB5AD06DDA85E2E8F,0xA9DFDFED12311CA7,0xB79F51ED32ADD424,0x6A375D21624F9187,0xE33678A9AE50A01B,0x2A2B5BAE280E2FFA,0xA5277ECCD081FCC1,0x941B1F179D6AE19A,0xB8090FC59766A88C,0x7AE5F5D5A7D0936,0x74CB4C4C883007E5,0x598200EB0DCC8A9D,0xA7A8B7E924089F0A,0xAF82FE1B3E949337,0x8450270DC5896D39,0x94C9CD3D66808551,0xEFDD8C5443F6C9E4,0x5B59C12A02157D00,0xC87E4FAD00AEDD4B,0xF5501FF9869DAC7C,0x1D5A665629D417A7,0x1340575A0EEE0622,0x4A81F937A270775,0x48C57B247498FD02,0x648F2586F927249D,0xC90C649EB3EB4B1B,0x714EDA9C467D9D0A,0x3AACF4E05C1E40E0,0xFB54FC989415871E,0x5DA0536AEAD1FF31,0x9D35AABAEE206518,0xFE620ED8E0A3C209,0xDA63CE76F9AAB439,0xAC574D1AAC70DD29,0x8D3F11438EEDD7D2,0xEEBEB450F9417D7F,0xC713B16D0F5FBF9D,0x9DBF1E37DC1A1F46,0x337EF33DA3DDB990,0xFD8CE53356B5D745,0xB4A09397270CB974,0x8046513BC06BFBC,0xADBCF06C9348EEF5,0xAC89BB42FE09CC80,0x8E9B5F00B41A9F8C,0x336AED9579B3D098,0x30415B9FFAC70D2C,0x61D3E6830FEE218E,0x6C3C28979C693FF6,0x2C2F55254DC331B0,0x7B94DA9EDB63B904,0xF1C985BBEC6B6321,0xAA588DD56719AE3A,0xDC05A8A020E60C86,0x53E0C0174C1459B3,0x501C6124BE36E301,0x76D20C5FEC8EC7F1,0x57C35460B8069979,0xEB808E35861B8782,0x182BD9AD1675B5DE,0x6E97FD533F10FC5C,0xD3B9FE5F9C40C8B5,0x9BC299A7D57D7CAA,0x5A78FA8C86A9587A,0xC9BBB26582F3058A,0x1D25F777D0165BF3,0x5314C41B6FA61336,0xE8EF17ECD68C900D,0x1B8AC60684718568,0xB344489A3C5FFBBB,0xC13B5C4CC421EA79,0x4FD9D8C197FF8A52,0xD5AA1C942B6D68DD,0xA7C024F5E73C2EE0,0x6A59D337CB7DD7E0,0xF9639F1B33AF0EF8,0x5CB3E2A3FC6B7543,0x1BE70491AADA5F80,0xD2A388162B1121E3,0xE5EF4685EE5EF675,0x2814BEDF5E0AF4C0,0x5D97A268AAF6B6AB,0xA42AC01E0317ED99,0x8FBF79AC214E3747,0x4F7C7E268667C7B3,0x666DF5A2D9B9C2DF,0x312DFD78768FEAA0,0xF5DE2508EEBD1684,0x8A278879AFDDD37B,0x69347FDCD85BCA24,0x905AE697A8F8A694,0xF2FCE3F2F4D0CB50,0xE61689C28FFE2DAF,0xF9DF73BCBDB93008,0xFB9F77A8FFB0897E,0x43AF47D2A857D51A,0x61F41693A4648B46,0x7C1AFBB397B1066E,0x6C0C380EEAAFA7E3,0x1E00EF437AE43BB8,0xFDA2576D37032738,0xD37CA6D6F8993BB9,0x540E1993D47EAF4B,0x287065449969E42F,0xCD01772CECE254A3,0x84448CC61691D994,0x9A2C1A81F938D584,0x9CF923758A7DEF91,0x4160C3716329E630,0x79FCDCFB75A2E31B,0xA60E0FC9E433408C,0x47B74B49AC74FAF4,0x129361AA74CBB732,0xA205F1BC1E1E70CF,0x9E3907AACB2EE9A3,0xC7654AAAA57E8D28,0xA22032FB8CF69F27,0x93EBA5A2C85D82E7,0xD0E90E9B5A87913E,0x22697BCF9D7EB9FF,0x17B5AACACF266B6A,0x907862D7EED879DE,0x88A79760AFFC278F,0xAA54E339BD273E82,0x55250754D66E3652,0x279E935A91EF72DA,0x8E7F0FC0E58A6331,0x24FDC1440EEAE053,0xAF22CCA1763E6B1F,0xEBF4A581695418A5,0x99B282132C4AB6DA,0x529A57C2E61B1345,0x9E33FC86B0212DAB,0x57F9AA96B2E7702A,0x220D7AA717CC835C,0x3665875382B5AB69,0xB0EBCEBA08F63848,0x267A7225DAF1CD41,0x27058ECA3C640709,0x43176180326D6988,0x8AFDFB10F32CB1A8,0x5506AFBD6056C05F,0xE074F21A4084FD1F,0xE3A0299C9DEE59C8,0xD0794C48F637F16C,0x97FB44DEA703EB10,0x9E62B9416FD53EBA,0xC0DB690A927487AE,0x740CB8455C25DD1C,0x753758951C769A4A,0x8C1172B230F4EB1A,0xDC3F37138B82ACCA,0x348B16EB27AA1C60,0xF5E7FBE3D9D9BC24,0x7300EAE2F99BE3B7,0xE5ECA5B21BBFA1E5,0x5F7FDF6769E8DD84,0xDDBBC2472DA87217,0xD2B08CD9D81655CE,0x824A2D0AB16C9E1A,0x863A048DC4DBB2FE,0x630992D07A32281B,0x4877F2B0D2101BDE,0x36746293A73925EB,0xA43283449133E803,0xE0ACB5BC9D603F02,0xAEC7FB421829031C,0xB6D03E3DBCAF727F,0x8D12590141B620B3,0xDB3813D934CC6718,0x40124D3C22E7C332,0xEAB8A43F6621850F,0x44612E772F9312E9,0x64FEACF0AD019F1F,0xE62930EC6FAABCA5,0xF1B79038130E3C08,0xCD06D7490DF9B6BA,0xBDCFCDA63931E498,0x1AA970FDD6C143E2,0x4C8F181F63537DD2,0x3B5692CB240DBC2F,0x3E7E7AD923FD91A7,0xB07407B3B153C760,0xF7553BA24C0AB0B2,0x3511D41891789DA6,0x860632F4716956DF,0x2B773DB19587707D,0x30825986EF0F9E48,0xA9EDF0DFAF70EAD4,0x97CDBE6B72277F6A,0xA7F7529CFB6F1EA7,0xF629ED9089543196,0xF548473734CBB33B,0x3DCEE0B40D1FEC94,0xCA2403168E81B9CB,0xB65B0A6A52A484B5,0x987D0FA30D602B0,0xB9E9F6A235CE5516,0x6B64B565F7C0BE14,0xA15CBF61198EE519,0x640BC0200CE90880,0xB8E85A4A8536807D,0x60D610F2649E805B,0x5F6C263433E7851E,0x38779AA6147A1831,0x271D0AA5ADF266EA,0x7442AD74A851EC7B,0x793D2505EE281DDD,0xAF324DD73DD8C045,0x77950FC099D3FB4D,0x784F0E1BBD6301B6,0x42B109962C4D43EC,0xA158DF97B623950,0x5E0F6A0ED51BB6A8,0xDFF07C5495BDA6ED,0x656463C707D8CCC9,0xF977D20CFFFD341F,0xABCBEEA1CC0701DC,0xB3E28598CA656061,0x3088D7B1F0BD8975,0xA03728CC57F6DD36,0x772683F12F46CE82,0x5B29AF88D03CEB7A,0xBFDFDBE09E616B61,0x7F90FF957E7FF50A,0xAB4E52390141B4E7,0xC61B49A4C6C60411,0x9D019545E8C959C6,0x5191631D395FDE9C,0xA133EF296C37D6E6,0x5951A2AB1DF37E03,0x73C3D75DAC71F876,0x1A1A32EC5122B4F0,0x5B82466A71C4A9CD,0xDCD94B3260CB762C,0x385CCC1DF7554BE9,0x9F0B86B670233A83,0x9CAB1193A04940AC,0xDCCC8272AEA5EA2C,0x528A16ECF4B7B5A6,0x1A144C0743BF5890,0xBC4F3DBA48761D9A,0x1980F68872CC2C3D,0x85F0DD9B2A310950,0xB51B6AC3785890FE,0x63CDE093822E42C4,0xB2EEF26FE11993BB,0x8AF1D691BC007513,0xD308D56EF4A935A,0x72BECCF4B829522E,0x66E3AAFACE2D1EB8,0x1312DDD8385AEE4E,0xEDBC8405B3895CC9,0x26E13D440E7F6064,0x2FA2494B47FDD009,0xFEB2DDED3509562E,0x544996C0081ABDEB,0x78CEEE41F49F421F,0xAF60E6A2936F982A,0x430A7631A84C9BE7,0x75627043C6AA90AD,0x8235F1BEAD557629,0x9640E30A7F395E4B,0xBBB9A7A8FFE931B,0x94A68DA412C4007D,0x8955FB58835651A2,0x87CB58CAE436D6A5,0xEC0CBF0E037FEEB0,0x61B116A4C9C5B984,0x57EE251558A8A187,0x685A7D56318EFE6D,0x3423BC61BC6BD401,0xE70F79BDFCB8B4BC,0x7F3C8FDDAE1D6311,0x16EB4EEDAA5416C4,0x2C97F1F248685957,0xCC986802D9AE877E,0x67896C7A4066E42E,0x89D51606F3FCA194,0xA347DA69520FE64A,0xC02468829E4AA65,0xEA4743874D515F13,0xD1E561A4621971E,0x6405F9D3DF61E127,0x3D82B1EAD5216876,0xF2B6BC6177886AEF,0xD7AF89E96BDD636E,0xC2AA11D47F8C5153,0xF2C91BA157882B97,0xBE2B7EEE635434FF,0xC9544020DFE34A9C,0xBE32015EBE87354,0xF26071F4CBA82B4D,0x57C7BFB65495FB1A,0xC4DBC6C793A97252,0xB3AB0B43CABD4F3E,0x8D6D4EB2FFE77CB3,0x465EEA70AF251045,0xAFD262ACCA64479A,0xDAF4C98C18AC6F06,0x16CFBC5E7EB32861,0x1A2BCC8C636F9226,0xBEC4B8653462450E,0x491E822B2C464FE4,0xC889AE921400E1ED,0xEB7247ECF9313934,0x4F80CD41C0C6F1E3,0x7619E49E996C8A15,0x583536248E014455,0x8EA0917E9BF68ABF,0x249249D74F813EB2,0x81A129E894BD7138,0x946CF11741899D4C,0x2F800AD09C30EAFF,0x8110C3A5371AD12D,0xA62C98856A88DC66,0x10F7F8057FDFEF58,0x7FFAD424E930B802,0x5442E3C4F8176CE7,0xDA9A20F41B1D3C1B,0xCE2ADF354D3F97AE,0x519F76A38952BBD0,0x4497678941C27E46,0xB5FFFF9010AEF80,0x6A9E89C17033E79E,0x27D27223E8EF22ED,0x6638C0F19DE692FE,0x3EE18B00CD86C54F,0xE728F090D538CB18,0xF85C2BE613AD7903,0x7CF3DDFB660E9328,0x1EF8801C2AC1FE34,0xDB947915FA4FB5D5,0x53875E6971DE2FBF,0xE75901370C558054,0x768916F2C61804A4,0x6880878FB8B44799,0x1F28B185E40612B5,0x13AC55E5C01A1052,0xBF7C28CF040C67BC,0x1FE002F8F0E4E900,0xAB078CF87FA0D018,0xB39F6B1C186F538E,0xA0A2925EDC6DDA6D,0xF06CB8927A8EE0DE,0x6CC7A2E68E8A565A,0x879FF7169943DE79,0xB7B32238BFF7DD76,0x3C0F448853B71C92,0x23B29877D0BE9547,0x484426882F80CACE,0xF3D409E30929BD33,0xE26BDA5FFA4CA294,0x51B462E1DEB9F762,0xAD33AEE7683375F4,0x11552FA9DCB8E126,0x2A9ED010C087BF2B,0x66B90BA528CFEBCE,0x45F34E0DDD65A401,0xBCEDAE6CA2B2046E,0x1149D67DB429787A,0x574074EDCCCBD5E,0x45FC566246B3511B,0xA83DA0A0DF32920C,0x53A38286A3AC16C1,0x9EFAE0A25C020F4B,0xB41DEC3AAC1AA107,0x4BD3F83B0D7E1417,0x1834D30866818A23,0x4F07124B9C56ED6F,0x4A46DAA87A4C235E,0x4D5D5614C2DF76F4,0x8CF553A05B97089A,0x690AB6F5DB2A3A54,0xD8AE5A845CE0131A,0x1AC621DBDFE4ECA0,0x7468550652312059,0x8AABCACF8F4828E,0x6D796FB2594CA190,0xF2C30F76A5BF797F,0x227CB6AD5598268,0x73992DAFD09D607B,0xACBE463290141D49,0xC38311CAC7220555,0x5D80B7A4B4BA4D49,0x8DF178F67D660DC7,0xFC4FF8B60E6C8641,0x5BD5570DF8DB6C39,0x5FD6A23EC3A0882D,0xA239630C4686BC6E,0x1820CC8352D1B6EE,0x4800F32F989BED65,0xD483C8E87621AF64,0x8DAD6B08438A17C,0xB0D77D90171EC35F,0xAF3A361C94FBBFC6,0x650290A3A38E907E,0xD6F4FF37FC8730A1,0x33D6B8520C268EC8,0x43F53DDC37E17FE9,0x6D5FA72F8C43D132,0x80E6FC2ACEAF8AA3,0x5EDED4B3E1A48E68,0x85718B993F8FC553,0x3CB575F4FC5A6DCB,0xEB5B16C858201429,0xA10F939489C3BE61,0x92A65766A892EFC6,0xCF56BDC3BD787B97,0x8A3572575D91006C,0x93A0B91D4456D7E9,0xFA13077979C3DCB9,0x7B5835DBE90FBDED,0x4693060C5049F4E3,0xC985A2C6C77023D,0xEA7D61B52729ED38,0x9C1B023459284932,0xC37D2709B04BD397,0x6C81F95CADD1E6D0,0xFA3F484500EC0E85,0x395F718BB649E570,0xB302C203285E8234,0x834F4286803834DE,0xB6209D82C643428C,0xE0826380A9741A77,0x7EC58BF54CD9DC57,0xB92D606AB30C334C,0x2B73BEAD61E67B73,0x78640AA034DC7BAF,0xF4CFBABEEF287C00,0xFE2B29CE6AE93F62,0xF4E66F9577F22476,0x4CC44EFF756524DC,0xDB5B122A29E007B,0x95BB431592C5642,0x8E453F6C5ABDD9DC,0x1091922715B68DF0,0xD78F39BF33D61469,0xBB74EE81E0CA2E98,0xD0E4082BC9A5DC1E,0x3C2402675D8FFADA,0x9E333ABC0077FDAB,0xDB47943DB2DB40C5,0x46DEC96BAC39908C,0x6119A351A3080C2,0x12974BA350E32306,0x2ED26DA87CD65433,0xBE2AF59B33F9F92A,0x51817FD0EC0A289C,0xC0C6031DB5E2A28,0x54A9A0E1D30B92A5,0x537B8CC8EB57DFB7,0xE3C69C184ADC05C0,0x3EAF5419C2410C27,0x71C760BC3D9BEDAC,0x8AED94D23435607C,0xC3A0D70539BCA8F9,0xB21FD0EEB76F0296,0x3348018F21E261AF,0x17FDAC0BF5A2C728,0xC6B8DAA3EC313D8F,0xDAEDE051F3F4FD45,0xD923766A456DE601,0x148523145C045769,0x17687E14C390C475,0x2E538CBB8683618E,0x1E2447C0261A7995};
@@ -0,0 +1,11 @@
+#include "native_batch.hpp"
+
+#include "pointers.hpp"
+
+namespace big
+{
+	void native_batch_context::fix_vectors()
+	{
+		g_pointers->m_gta.m_fix_vectors(this);
+	}
+}
@@ -0,0 +1,141 @@
+#pragma once
+#include "invoker.hpp"
+
+#include <array>
+#include <cstring>
+#include <span>
+
+namespace big
+{
+	struct native_batch_call
+	{
+		static constexpr std::size_t max_args = 16;
+		// large enough for a scrVector
+		static constexpr std::size_t max_return_size = 3 * sizeof(std::uint64_t);
+
+		rage::scrNativeHandler m_handler;
+		void* m_result;
+		std::uint8_t m_result_size;
+		std::uint8_t m_arg_count;
+		bool m_fix_vectors;
+		std::uint64_t m_return[3];
+		std::uint64_t m_args[max_args];
+	};
+
+	class native_batch_context : public rage::scrNativeCallContext
+	{
+	public:
+		// runs every call on this context, pointing it at the arguments of each call instead of copying them
+		void run(std::span<native_batch_call> calls)
+		{
+			for (auto& call : calls)
+			{
+				reset();
+				m_return_value = call.m_return;
+				m_args         = call.m_args;
+				m_arg_count    = call.m_arg_count;
+
+				call.m_handler(this);
+
+				if (call.m_fix_vectors)
+					fix_vectors();
+			}
+
+			// copied out in a separate pass so the loop above stays tight
+			for (const auto& call : calls)
+				if (call.m_result)
+					std::memcpy(call.m_result, call.m_return, call.m_result_size);
+		}
+
+	private:
+		// the only part that needs the game, kept out of the header so the batch can be benchmarked without it
+		void fix_vectors();
+	};
+
+	// Records a sequence of native calls and runs them back to back.
+	// Handlers are resolved and arguments are packed when a call is added, run() only invokes the handlers.
+	// Argument types must match the native's parameters exactly, the native wrappers aren't there to convert them.
+	// Results are copied to the pointers passed to add_with_result() once the batch has run.
+	// The calls are stored inline (about 180 bytes each), keep the capacity small for batches that live on a fiber stack.
+	template<std::size_t capacity>
+	class native_batch final
+	{
+	public:
+		// handlers can be replaced with a table of fake handlers to measure the batch without the game
+		explicit native_batch(rage::scrNativeHandler* handlers = nullptr) :
+		    m_handlers(handlers)
+		{
+		}
+
+		~native_batch()
+		{
+			run();
+		}
+
+		native_batch(const native_batch&)            = delete;
+		native_batch& operator=(const native_batch&) = delete;
+
+		// a separate name so that a pointer argument of a void native is never taken for the result
+		template<auto index, bool fix_vectors = false, typename Ret, typename... Args>
+		void add_with_result(Ret* result, Args... args)
+		{
+			static_assert(sizeof(Ret) <= native_batch_call::max_return_size);
+
+			auto& call         = push<static_cast<int>(index), fix_vectors>(args...);
+			call.m_result      = result;
+			call.m_result_size = sizeof(Ret);
+		}
+
+		template<auto index, bool fix_vectors = false, typename... Args>
+		void add(Args... args)
+		{
+			auto& call         = push<static_cast<int>(index), fix_vectors>(args...);
+			call.m_result      = nullptr;
+			call.m_result_size = 0;
+		}
+
+		void run()
+		{
+			if (m_size == 0)
+				return;
+
+			m_context.run({m_calls.data(), m_size});
+			m_size = 0;
+		}
+
+		[[nodiscard]] std::size_t size() const
+		{
+			return m_size;
+		}
+
+	private:
+		template<int index, bool fix_vectors, typename... Args>
+		native_batch_call& push(Args... args)
+		{
+			static_assert(sizeof...(Args) <= native_batch_call::max_args, "too many arguments for a batched native");
+			static_assert(((sizeof(Args) <= sizeof(std::uint64_t) && std::is_trivially_copyable_v<Args>) && ...));
+			static_assert((!std::is_same_v<Args, double> && ...), "natives take floats, pass 1.f instead of 1.0");
+
+			if (m_size == capacity)
+				run();
+
+			if (!m_handlers) [[unlikely]]
+				m_handlers = native_invoker::get_handlers();
+
+			auto& call         = m_calls[m_size++];
+			call.m_handler     = m_handlers[index];
+			call.m_arg_count   = sizeof...(Args);
+			call.m_fix_vectors = fix_vectors;
+
+			std::size_t i = 0;
+			((call.m_args[i] = 0, std::memcpy(&call.m_args[i++], &args, sizeof(Args))), ...);
+
+			return call;
+		}
+
+		rage::scrNativeHandler* m_handlers;
+		std::array<native_batch_call, capacity> m_calls;
+		std::size_t m_size = 0;
+		native_batch_context m_context{};
+	};
+}
@@ -6,12 +6,92 @@
 
 namespace big
 {
-	inline auto hash_stack_trace(std::vector<uint64_t> stack_trace)
+	// frames captured for the fingerprint, includes the few frames of the exception dispatcher above the faulting one
+	static constexpr DWORD fingerprint_frames = 24;
+	// full stack traces of new exceptions allowed per second
+	static constexpr uint32_t max_traces_per_second = 8;
+
+	// Identifies an exception by its code, faulting address and a short backtrace. Cheap enough to take for every exception,
+	// unlike walking and symbolizing the stack which a payload raising the same caught exception in a loop would otherwise trigger each time.
+	static uint64_t get_fingerprint(const EXCEPTION_POINTERS* exception_info)
+	{
+		void* frames[fingerprint_frames];
+		const auto count = RtlCaptureStackBackTrace(0, fingerprint_frames, frames, nullptr);
+
+		uint64_t hash     = 0xCBF29CE484222325;
+		const auto append = [&hash](uint64_t value) {
+			hash = (hash ^ value) * 0x100000001B3;
+		};
+
+		append(exception_info->ExceptionRecord->ExceptionCode);
+		append(exception_info->ContextRecord->Rip);
+		for (WORD i = 0; i < count; i++)
+			append(reinterpret_cast<uint64_t>(frames[i]));
+
+		return hash;
+	}
+
+	// Fixed size open addressing set of the fingerprints that were logged already, safe to use from any number of faulting threads.
+	class exception_fingerprints final
+	{
+	public:
+		static constexpr std::size_t capacity   = 1024;
+		static constexpr std::size_t max_probes = 16;
+
+		bool contains(uint64_t fingerprint) const
+		{
+			fingerprint |= 1;
+
+			for (std::size_t i = 0; i < max_probes; i++)
+			{
+				const auto value = m_slots[(fingerprint + i) & (capacity - 1)].load(std::memory_order_relaxed);
+				if (value == fingerprint)
+					return true;
+				if (value == 0)
+					return false;
+			}
+
+			// treat a full neighbourhood as seen, nothing could be logged for it anyway
+			return true;
+		}
+
+		// returns true if the fingerprint is new, false if it was seen before or there's no room left for it
+		bool insert(uint64_t fingerprint)
+		{
+			// 0 marks an empty slot
+			fingerprint |= 1;
+
+			for (std::size_t i = 0; i < max_probes; i++)
+			{
+				auto& slot    = m_slots[(fingerprint + i) & (capacity - 1)];
+				auto expected = slot.load(std::memory_order_relaxed);
+
+				if (expected == 0 && slot.compare_exchange_strong(expected, fingerprint, std::memory_order_relaxed))
+					return true;
+
+				// either already there or another thread just inserted it
+				if (expected == fingerprint)
+					return false;
+			}
+
+			return false;
+		}
+
+	private:
+		std::array<std::atomic<uint64_t>, capacity> m_slots{};
+	};
+
+	static bool can_log_trace()
 	{
-		auto data = reinterpret_cast<const char*>(stack_trace.data());
-		std::size_t size = stack_trace.size() * sizeof(uint64_t);
+		static std::atomic<uint64_t> window_start = 0;
+		static std::atomic<uint32_t> count        = 0;
 
-		return std::hash<std::string_view>()({ data, size });
+		const auto now = GetTickCount64();
+		auto start     = window_start.load(std::memory_order_relaxed);
+		if (now - start >= 1000 && window_start.compare_exchange_strong(start, now, std::memory_order_relaxed))
+			count.store(0, std::memory_order_relaxed);
+
+		return count.fetch_add(1, std::memory_order_relaxed) < max_traces_per_second;
 	}
 
 	exception_handler::exception_handler()
@@ -33,16 +113,26 @@ namespace big
 		if (exception_code == EXCEPTION_BREAKPOINT || exception_code == DBG_PRINTEXCEPTION_C || exception_code == DBG_PRINTEXCEPTION_WIDE_C)
 			return EXCEPTION_CONTINUE_SEARCH;
 
-		static std::set<std::size_t> logged_exceptions;
+		static exception_fingerprints logged_exceptions;
+		static std::atomic<uint32_t> suppressed_exceptions = 0;
 
-		trace.new_stack_trace(exception_info);
-		const auto trace_hash = hash_stack_trace(trace.frame_pointers());
-		if (const auto it = logged_exceptions.find(trace_hash); it == logged_exceptions.end())
+		// the stack has to be walked on the faulting thread while it is still intact, so only do it for exceptions we haven't seen
+		if (const auto fingerprint = get_fingerprint(exception_info); !logged_exceptions.contains(fingerprint))
 		{
-			LOG(FATAL) << trace;
-			Logger::FlushQueue();
+			// only marked as seen once it is logged, so one that was rate limited gets another chance the next time it happens
+			if (can_log_trace() && logged_exceptions.insert(fingerprint))
+			{
+				if (const auto suppressed = suppressed_exceptions.exchange(0, std::memory_order_relaxed))
+					LOG(WARNING) << "Suppressed the stack traces of " << suppressed << " exceptions";
 
-			logged_exceptions.insert(trace_hash);
+				trace.new_stack_trace(exception_info);
+				LOG(FATAL) << trace;
+				Logger::FlushQueue();
+			}
+			else
+			{
+				suppressed_exceptions.fetch_add(1, std::memory_order_relaxed);
+			}
 		}
 
 	
@@ -1,5 +1,5 @@
 #pragma once
-#include "lua/lua_module.hpp"
+#include "lua/lua_manager.hpp"
 
 namespace lua::event
 {
@@ -113,6 +113,7 @@ namespace lua::event
 		big::lua_module* module = sol::state_view(state)["!this"];
 
 		module->m_event_callbacks[menu_event].push_back(func);
+		big::g_lua_manager->mark_snapshot_dirty();
 	}
 
 	void bind(sol::state& state)
@@ -1,6 +1,8 @@
 #pragma once
 #include "memory.hpp"
+#include "pointers.hpp"
 #include "script_global.hpp"
+#include "script_layout.hpp"
 
 namespace lua::globals
 {
@@ -129,19 +131,82 @@ namespace lua::globals
 		return memory::pointer((uint64_t)big::script_global(global).as<void*>());
 	}
 
+	static std::uint64_t* get_layout_block(int global, const script_layout::layout& layout)
+	{
+		if (!layout.is_valid() || global < 0)
+			return nullptr;
+
+		// globals are only contiguous within one of the 64 global blocks
+		if ((global >> 0x12) >= 0x40 || (global & 0x3FFFF) + layout.size() > 0x40000 || !big::g_pointers->m_gta.m_script_globals[global >> 0x12])
+		{
+			LOG(WARNING) << "Layout of " << layout.size() << " words at global " << global << " is out of bounds";
+			return nullptr;
+		}
+
+		return big::script_global(global).as<std::uint64_t*>();
+	}
+
+	// Lua API: Function
+	// Table: globals
+	// Name: read_layout
+	// Param: global: integer: index of the first global of the block
+	// Param: layout: script_layout: description of the block
+	// Param: target: table: optional, table to fill instead of creating a new one every call
+	// Returns: table: the value of every field of the layout by name, nil if the block is out of bounds
+	// Reads a whole block of globals, for example a struct from a player's broadcast data, in a single call.
+	// **Example Usage:**
+	// ```lua
+	// local layout = script_layout:new({ { "cash", 0, "int" }, { "position", 5, "vec3" } })
+	// local data = {}
+	// script.register_looped("read_block", function()
+	//   globals.read_layout(1234567, layout, data)
+	//   log.info(data.cash)
+	// end)
+	// ```
+	static sol::object read_layout(int global, const script_layout::layout& layout, sol::optional<sol::table> target, sol::this_state state)
+	{
+		const auto block = get_layout_block(global, layout);
+		if (!block)
+			return sol::lua_nil;
+
+		auto table = target ? *target : sol::state_view(state).create_table();
+		layout.read(block, table);
+		return table;
+	}
+
+	// Lua API: Function
+	// Table: globals
+	// Name: write_layout
+	// Param: global: integer: index of the first global of the block
+	// Param: layout: script_layout: description of the block
+	// Param: values: table: new values by field name, fields without a value are left untouched
+	// Returns: boolean: false if the block is out of bounds
+	// Writes a whole block of globals in a single call.
+	static bool write_layout(int global, const script_layout::layout& layout, sol::table values)
+	{
+		const auto block = get_layout_block(global, layout);
+		if (!block)
+			return false;
+
+		layout.write(block, values);
+		return true;
+	}
+
 	void bind(sol::state& state)
 	{
-		auto ns           = state["globals"].get_or_create<sol::table>();
-		ns["get_int"]     = get_int;
-		ns["get_uint"]    = get_uint;
-		ns["get_float"]   = get_float;
-		ns["get_string"]  = get_string;
-		ns["get_vec3"]    = get_vec3;
-		ns["set_int"]     = set_int;
-		ns["set_uint"]    = set_uint;
-		ns["set_float"]   = set_float;
-		ns["set_string"]  = set_string;
-		ns["set_vec3"]    = set_vec3;
-		ns["get_pointer"] = get_pointer;
+		auto ns            = state["globals"].get_or_create<sol::table>();
+		ns["get_int"]      = get_int;
+		ns["get_uint"]     = get_uint;
+		ns["get_float"]    = get_float;
+		ns["get_string"]   = get_string;
+		ns["get_vec3"]     = get_vec3;
+		ns["set_int"]      = set_int;
+		ns["set_uint"]     = set_uint;
+		ns["set_float"]    = set_float;
+		ns["set_string"]   = set_string;
+		ns["set_vec3"]     = set_vec3;
+		ns["get_pointer"]  = get_pointer;
+		ns["read_layout"]  = read_layout;
+		ns["write_layout"] = write_layout;
 	}
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "gui.hpp"
 
 #include "../../gui.hpp"
+#include "lua/lua_manager.hpp"
 
 namespace lua::gui
 {
@@ -9,6 +10,7 @@ namespace lua::gui
 		big::lua_module* module = sol::state_view(state)["!this"];
 
 		module->m_independent_gui.push_back(std::move(element));
+		big::g_lua_manager->mark_snapshot_dirty();
 	}
 
 	static void add_element(lua_State* state, uint32_t hash, std::unique_ptr<lua::gui::gui_element> element)
@@ -16,6 +18,7 @@ namespace lua::gui
 		big::lua_module* module = sol::state_view(state)["!this"];
 
 		module->m_gui[hash].push_back(std::move(element));
+		big::g_lua_manager->mark_snapshot_dirty();
 	}
 
 	big::tabs tab::id() const
@@ -125,6 +128,7 @@ namespace lua::gui
 		big::lua_module* module = sol::state_view(state)["!this"];
 
 		module->m_gui[m_tab_hash].clear();
+		big::g_lua_manager->mark_snapshot_dirty();
 
 		for (auto sub_tab : module->m_tab_to_sub_tabs[id()])
 		{
@@ -1,6 +1,7 @@
 #pragma once
 #include "locals.hpp"
 #include "memory.hpp"
+#include "script_layout.hpp"
 
 namespace lua::locals
 {
@@ -106,17 +107,76 @@ namespace lua::locals
 		return memory::pointer((uint64_t)get<int*>(script, index));
 	}
 
+	static std::uint64_t* get_layout_block(const std::string& script, int index, const script_layout::layout& layout)
+	{
+		if (!layout.is_valid() || index < 0)
+			return nullptr;
+
+		auto thread = big::gta_util::find_script_thread(rage::joaat(script));
+		if (!thread)
+			return nullptr;
+
+		if (static_cast<std::int64_t>(index) + layout.size() > thread->m_context.m_stack_size)
+		{
+			LOG(WARNING) << "Layout of " << layout.size() << " words at local " << index << " is outside of the stack of " << script;
+			return nullptr;
+		}
+
+		return big::script_local(thread->m_stack, index).as<std::uint64_t*>();
+	}
+
+	// Lua API: Function
+	// Table: locals
+	// Name: read_layout
+	// Param: script: string: The name of the script
+	// Param: index: index: Index of the first script local of the block.
+	// Param: layout: script_layout: Description of the block.
+	// Param: target: table: Optional, table to fill instead of creating a new one every call.
+	// Returns: table: The value of every field of the layout by name, nil if the script isn't running or the block is out of bounds.
+	// Reads a whole block of locals in a single call.
+	static sol::object read_layout(const std::string& script, int index, const script_layout::layout& layout, sol::optional<sol::table> target, sol::this_state state)
+	{
+		const auto block = get_layout_block(script, index, layout);
+		if (!block)
+			return sol::lua_nil;
+
+		auto table = target ? *target : sol::state_view(state).create_table();
+		layout.read(block, table);
+		return table;
+	}
+
+	// Lua API: Function
+	// Table: locals
+	// Name: write_layout
+	// Param: script: string: The name of the script
+	// Param: index: index: Index of the first script local of the block.
+	// Param: layout: script_layout: Description of the block.
+	// Param: values: table: New values by field name, fields without a value are left untouched.
+	// Returns: boolean: false if the script isn't running or the block is out of bounds.
+	// Writes a whole block of locals in a single call.
+	static bool write_layout(const std::string& script, int index, const script_layout::layout& layout, sol::table values)
+	{
+		const auto block = get_layout_block(script, index, layout);
+		if (!block)
+			return false;
+
+		layout.write(block, values);
+		return true;
+	}
+
 	void bind(sol::state& state)
 	{
-		auto ns           = state["locals"].get_or_create<sol::table>();
-		ns["get_int"]     = get_int;
-		ns["get_uint"]    = get_uint;
-		ns["get_float"]   = get_float;
-		ns["get_vec3"]    = get_vec3;
-		ns["set_int"]     = set_int;
-		ns["set_uint"]    = set_uint;
-		ns["set_float"]   = set_float;
-		ns["set_vec3"]    = set_vec3;
-		ns["get_pointer"] = get_pointer;
+		auto ns            = state["locals"].get_or_create<sol::table>();
+		ns["get_int"]      = get_int;
+		ns["get_uint"]     = get_uint;
+		ns["get_float"]    = get_float;
+		ns["get_vec3"]     = get_vec3;
+		ns["set_int"]      = set_int;
+		ns["set_uint"]     = set_uint;
+		ns["set_float"]    = set_float;
+		ns["set_vec3"]     = set_vec3;
+		ns["get_pointer"]  = get_pointer;
+		ns["read_layout"]  = read_layout;
+		ns["write_layout"] = write_layout;
 	}
 }
\ No newline at end of file
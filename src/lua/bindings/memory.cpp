@@ -269,6 +269,7 @@ namespace lua::memory
 		{
 			module->m_dynamic_hook_post_callbacks[target_func_ptr].push_back(post_lua_callback);
 		}
+		big::g_lua_manager->mark_snapshot_dirty();
 	}
 
 	static std::unordered_map<uintptr_t, std::vector<uint8_t>> jitted_binded_funcs;
@@ -4,6 +4,7 @@
 #include "memory.hpp"
 #include "memory/pattern.hpp"
 #include "pointers.hpp"
+#include "services/script_function_cache/script_function_cache.hpp"
 #include "util/scripts.hpp"
 
 namespace lua::scr_function
@@ -22,7 +23,7 @@ namespace lua::scr_function
 	// Table: scr_function
 	// Name: call_script_function
 	// Param: script_name: string: Name of the script.
-	// Param: function_name: string: Name of the function. This parameter needs to be unique.
+	// Param: function_name: string: Name of the function, only used for logging.
 	// Param: pattern: string: Pattern to scan for within the script.
 	// Param: return_type_string: string: Return type of the function. Supported types are **"int"**, **"bool"**, **"const char\*/string"**, **"ptr/pointer/*"**, **"float"**, and **"vector3"**. Anything different will be rejected.
 	// Param: args_: table: Arguments to pass to the function. Supported types are the same as return types.
@@ -40,7 +41,6 @@ namespace lua::scr_function
 	{
 		std::vector<lua::memory::type_info_t> param_types;
 		std::vector<sol::object> actual_args;
-		static std::unordered_map<std::string, int32_t> pattern_results;
 		for (const auto& [k, v_] : args_)
 		{
 			if (v_.is<sol::table>())
@@ -62,30 +62,14 @@ namespace lua::scr_function
 			return sol::lua_nil;
 		}
 
-		int32_t instruction_pointer;
-
-		if (pattern_results.contains(function_name))
+		const auto location = big::g_script_function_cache.resolve(program, pattern);
+		if (!location)
 		{
-			instruction_pointer = pattern_results[function_name];
+			LOG(FATAL) << "Failed to find pattern " << function_name << " in script " << script_name;
+			return sol::lua_nil;
 		}
-		else
-		{
-			const ::memory::pattern pattern_scan(pattern);
-
-			auto location = big::scripts::get_code_location_by_pattern(program, pattern_scan);
 
-			if (!location)
-			{
-				LOG(FATAL) << "Failed to find pattern " << function_name << " in script " << script_name;
-				return sol::lua_nil;
-			}
-			else
-			{
-				LOG(VERBOSE) << "Found pattern for " << function_name << " at " << HEX_TO_UPPER(location.value()) << " in " << script_name;
-			}
-
-			pattern_results[function_name] = instruction_pointer = location.value();
-		}
+		const int32_t instruction_pointer = *location;
 
 		auto tls_ctx                       = rage::tlsContext::get();
 		auto stack                         = (uint64_t*)thread->m_stack;
@@ -0,0 +1,151 @@
+#include "script_layout.hpp"
+
+namespace lua::script_layout
+{
+	static std::optional<field_type> get_field_type(const std::string& name)
+	{
+		if (name == "int")
+			return field_type::INT;
+		if (name == "uint")
+			return field_type::UINT;
+		if (name == "float")
+			return field_type::FLOAT;
+		if (name == "bool")
+			return field_type::BOOL;
+		if (name == "vec3")
+			return field_type::VEC3;
+		if (name == "string")
+			return field_type::STRING;
+
+		return std::nullopt;
+	}
+
+	// 64 bit so that a max_length close to INT_MAX can't wrap around
+	static std::int64_t get_field_words(const field& field)
+	{
+		switch (field.m_type)
+		{
+		case field_type::VEC3: return 3;
+		case field_type::STRING: return std::max<std::int64_t>(1, (static_cast<std::int64_t>(field.m_max_length) + 7) / 8);
+		default: return 1;
+		}
+	}
+
+	layout::layout(sol::table fields)
+	{
+		for (const auto& [_, entry] : fields)
+		{
+			if (!entry.is<sol::table>())
+			{
+				LOG(WARNING) << "script_layout: every field must be a table of { name, offset, type }";
+				return;
+			}
+
+			const auto description = entry.as<sol::table>();
+			const auto name        = description[1].get<std::optional<std::string>>();
+			const auto offset      = description[2].get<std::optional<int>>();
+			const auto type_name   = description[3].get<std::optional<std::string>>();
+			const auto max_length  = description[4].get_or(0);
+
+			if (!name || !offset || !type_name || *offset < 0 || *offset >= layout::max_size || max_length < 0)
+			{
+				LOG(WARNING) << "script_layout: malformed field " << name.value_or("<unnamed>");
+				return;
+			}
+
+			const auto type = get_field_type(*type_name);
+			if (!type)
+			{
+				LOG(WARNING) << "script_layout: unsupported type " << *type_name << " for field " << *name;
+				return;
+			}
+
+			if (std::any_of(m_fields.begin(), m_fields.end(), [&name](const field& field) {
+				    return field.m_name == *name;
+			    }))
+			{
+				LOG(WARNING) << "script_layout: duplicate field " << *name;
+				return;
+			}
+
+			auto& field    = m_fields.emplace_back(*name, *offset, *type, max_length);
+			const auto end = field.m_offset + get_field_words(field);
+			if (end > layout::max_size)
+			{
+				LOG(WARNING) << "script_layout: field " << *name << " ends past the " << layout::max_size << " words of a global block";
+				return;
+			}
+
+			m_size = std::max(m_size, static_cast<int>(end));
+		}
+
+		// no point in touching the block in the order the script happened to declare it
+		std::sort(m_fields.begin(), m_fields.end(), [](const field& a, const field& b) {
+			return a.m_offset < b.m_offset;
+		});
+
+		m_valid = true;
+	}
+
+	void layout::read(const std::uint64_t* block, sol::table& target) const
+	{
+		for (const auto& field : m_fields)
+		{
+			const auto address = block + field.m_offset;
+
+			switch (field.m_type)
+			{
+			case field_type::INT: target[field.m_name] = *reinterpret_cast<const int*>(address); break;
+			case field_type::UINT: target[field.m_name] = *reinterpret_cast<const std::uint32_t*>(address); break;
+			case field_type::FLOAT: target[field.m_name] = *reinterpret_cast<const float*>(address); break;
+			case field_type::BOOL: target[field.m_name] = *reinterpret_cast<const int*>(address) != 0; break;
+			case field_type::VEC3: target[field.m_name] = *reinterpret_cast<const Vector3*>(address); break;
+			case field_type::STRING:
+			{
+				const auto string = reinterpret_cast<const char*>(address);
+				target[field.m_name] = field.m_max_length ? std::string(string, strnlen(string, field.m_max_length)) : std::string(string);
+				break;
+			}
+			}
+		}
+	}
+
+	void layout::write(std::uint64_t* block, const sol::table& source) const
+	{
+		for (const auto& field : m_fields)
+		{
+			const sol::object value = source[field.m_name];
+			if (!value.valid() || value.get_type() == sol::type::lua_nil)
+				continue;
+
+			const auto address = block + field.m_offset;
+
+			switch (field.m_type)
+			{
+			case field_type::INT: *reinterpret_cast<int*>(address) = value.as<int>(); break;
+			case field_type::UINT: *reinterpret_cast<std::uint32_t*>(address) = value.as<std::uint32_t>(); break;
+			case field_type::FLOAT: *reinterpret_cast<float*>(address) = value.as<float>(); break;
+			case field_type::BOOL: *reinterpret_cast<int*>(address) = value.as<bool>(); break;
+			case field_type::VEC3: *reinterpret_cast<Vector3*>(address) = value.as<Vector3>(); break;
+			case field_type::STRING:
+			{
+				if (!field.m_max_length)
+					break;
+
+				const auto string = value.as<std::string>();
+				strncpy(reinterpret_cast<char*>(address), string.c_str(), field.m_max_length - 1);
+				reinterpret_cast<char*>(address)[field.m_max_length - 1] = '\0';
+				break;
+			}
+			}
+		}
+	}
+
+	void bind(sol::state& state)
+	{
+		auto usertype = state.new_usertype<layout>("script_layout", sol::constructors<layout(sol::table)>());
+
+		usertype["is_valid"] = &layout::is_valid;
+		usertype["size"]     = &layout::size;
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+namespace lua::script_layout
+{
+	enum class field_type : uint8_t
+	{
+		INT,
+		UINT,
+		FLOAT,
+		BOOL,
+		VEC3,
+		STRING
+	};
+
+	struct field
+	{
+		std::string m_name;
+		// in script words, relative to the base of the block
+		int m_offset;
+		field_type m_type;
+		// strings only, in bytes, 0 for read only strings
+		int m_max_length;
+	};
+
+	// Lua API: Class
+	// Name: script_layout
+	// A block of script globals or locals described once, so that a whole struct can be read or written with a single call instead of one call per field. See globals.read_layout and locals.read_layout.
+
+	class layout
+	{
+	public:
+		// one of the 64 global blocks, no block of globals or locals can be larger
+		static constexpr int max_size = 0x40000;
+
+		// Lua API: Constructor
+		// Class: script_layout
+		// Param: fields: table: Array of { name, offset, type[, max_length] } entries. Offsets are relative to the base index passed when reading or writing. Supported types are **"int"**, **"uint"**, **"float"**, **"bool"**, **"vec3"**, and **"string"**, strings can only be written if they have a max_length in bytes.
+		// Compiles the description of a block, the fields are validated once here instead of on every access.
+		// **Example Usage:**
+		// ```lua
+		// local layout = script_layout:new({
+		//   { "cash", 0, "int" },
+		//   { "position", 5, "vec3" },
+		//   { "name", 10, "string", 64 }
+		// })
+		// ```
+		explicit layout(sol::table fields);
+
+		// Lua API: Function
+		// Class: script_layout
+		// Name: is_valid
+		// Returns: boolean: false if the field description was rejected, every read and write does nothing in that case.
+		bool is_valid() const
+		{
+			return m_valid;
+		}
+
+		// Lua API: Function
+		// Class: script_layout
+		// Name: size
+		// Returns: integer: The number of script words spanned by the block.
+		int size() const
+		{
+			return m_size;
+		}
+
+		// fills target with one entry per field, the block must span at least size() words
+		void read(const std::uint64_t* block, sol::table& target) const;
+		// writes every field that has a value in source, the others are left untouched
+		void write(std::uint64_t* block, const sol::table& source) const;
+
+	private:
+		std::vector<field> m_fields;
+		int m_size   = 0;
+		bool m_valid = false;
+	};
+
+	void bind(sol::state& state);
+}
@@ -26,7 +26,8 @@ namespace big
 	lua_manager::lua_manager(folder scripts_folder, folder scripts_config_folder) :
 	    m_scripts_folder(scripts_folder),
 	    m_scripts_config_folder(scripts_config_folder),
-	    m_disabled_scripts_folder(scripts_folder.get_folder("./disabled"))
+	    m_disabled_scripts_folder(scripts_folder.get_folder("./disabled")),
+	    m_snapshot(std::make_shared<const lua_module_snapshot>())
 	{
 		m_wake_time_changed_scripts_check = std::chrono::high_resolution_clock::now() + m_delay_between_changed_scripts_check;
 
@@ -39,6 +40,11 @@ namespace big
 	{
 		unload_all_modules();
 
+		{
+			std::lock_guard guard(m_module_lock);
+			m_graveyard.clear();
+		}
+
 		g_lua_manager = nullptr;
 	}
 
@@ -52,9 +58,10 @@ namespace big
 			{
 				script_paths.push_back(module->module_path());
 
-				module.reset();
+				retire(std::move(module));
 			}
 			m_modules.clear();
+			publish_snapshot();
 		}
 
 		for (const auto& script_path : script_paths)
@@ -107,8 +114,9 @@ namespace big
 			std::lock_guard guard(m_module_lock);
 
 			for (auto& module : m_modules)
-				module.reset();
+				retire(std::move(module));
 			m_modules.clear();
+			publish_snapshot();
 		}
 		{
 			std::lock_guard guard(m_disabled_module_lock);
@@ -119,13 +127,92 @@ namespace big
 		}
 	}
 
-	bool lua_manager::has_gui_to_draw(rage::joaat_t tab_hash)
+	void lua_manager::publish_snapshot()
 	{
-		std::lock_guard guard(m_module_lock);
+		auto snapshot = std::make_shared<lua_module_snapshot>();
+		snapshot->m_modules.reserve(m_modules.size());
+
+		// cleared before copying so that changes made while we copy aren't lost
+		m_snapshot_dirty = false;
 
 		for (const auto& module : m_modules)
 		{
-			if (const auto it = module->m_gui.find(tab_hash); it != module->m_gui.end())
+			std::lock_guard guard(module->m_state_lock);
+			snapshot->m_modules.push_back({module, module->m_independent_gui, module->m_gui});
+
+			for (const auto& [event, callbacks] : module->m_event_callbacks)
+				if (!callbacks.empty())
+					snapshot->m_event_subscribers.add(event, module.get());
+			for (const auto& [target, callbacks] : module->m_dynamic_hook_pre_callbacks)
+				if (!callbacks.empty())
+					snapshot->m_pre_hook_subscribers.add(target, module.get());
+			for (const auto& [target, callbacks] : module->m_dynamic_hook_post_callbacks)
+				if (!callbacks.empty())
+					snapshot->m_post_hook_subscribers.add(target, module.get());
+		}
+
+		m_snapshot.store(std::move(snapshot));
+	}
+
+	void lua_manager::retire(std::shared_ptr<lua_module> module)
+	{
+		module->remove_owned_tabs();
+
+		m_graveyard.push_back(std::move(module));
+		m_graveyard_pending = true;
+	}
+
+	void lua_manager::retire(rage::joaat_t module_id)
+	{
+		const auto it = std::find_if(m_modules.begin(), m_modules.end(), [module_id](const auto& module) {
+			return module_id == module->module_id();
+		});
+		if (it == m_modules.end())
+			return;
+
+		retire(std::move(*it));
+		m_modules.erase(it);
+	}
+
+	void lua_manager::update_snapshot()
+	{
+		if (!m_snapshot_dirty && !m_graveyard_pending)
+			return;
+
+		std::vector<std::shared_ptr<lua_module>> dead;
+
+		{
+			std::lock_guard guard(m_module_lock);
+			if (m_snapshot_dirty)
+				publish_snapshot();
+
+			// once the graveyard holds the last reference no snapshot can hand the module out anymore
+			for (auto it = m_graveyard.begin(); it != m_graveyard.end();)
+			{
+				if (it->use_count() == 1)
+				{
+					dead.push_back(std::move(*it));
+					it = m_graveyard.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+			m_graveyard_pending = !m_graveyard.empty();
+		}
+
+		// closes their Lua states here on the game thread, outside the lock
+		dead.clear();
+	}
+
+	bool lua_manager::has_gui_to_draw(rage::joaat_t tab_hash)
+	{
+		const auto snapshot = m_snapshot.load();
+
+		for (const auto& entry : snapshot->m_modules)
+		{
+			if (const auto it = entry.m_gui.find(tab_hash); it != entry.m_gui.end())
 			{
 				if (it->second.size())
 				{
@@ -139,11 +226,15 @@ namespace big
 
 	void lua_manager::draw_independent_gui()
 	{
-		std::lock_guard guard(m_module_lock);
+		const auto snapshot = m_snapshot.load();
 
-		for (const auto& module : m_modules)
+		for (const auto& entry : snapshot->m_modules)
 		{
-			for (const auto& element : module->m_independent_gui)
+			if (entry.m_independent_gui.empty())
+				continue;
+
+			std::lock_guard guard(entry.m_module->m_state_lock);
+			for (const auto& element : entry.m_independent_gui)
 			{
 				element->draw();
 			}
@@ -152,13 +243,13 @@ namespace big
 
 	void lua_manager::draw_gui(rage::joaat_t tab_hash)
 	{
-		std::lock_guard guard(m_module_lock);
+		const auto snapshot = m_snapshot.load();
 
 		bool add_separator = false;
 
-		for (const auto& module : m_modules)
+		for (const auto& entry : snapshot->m_modules)
 		{
-			if (const auto it = module->m_gui.find(tab_hash); it != module->m_gui.end())
+			if (const auto it = entry.m_gui.find(tab_hash); it != entry.m_gui.end())
 			{
 				if (add_separator)
 				{
@@ -166,6 +257,7 @@ namespace big
 					add_separator = false;
 				}
 
+				std::lock_guard guard(entry.m_module->m_state_lock);
 				for (const auto& element : it->second)
 				{
 					element->draw();
@@ -177,12 +269,14 @@ namespace big
 
 	bool lua_manager::dynamic_hook_pre_callbacks(const uintptr_t target_func_ptr, lua::memory::type_info_t return_type, lua::memory::runtime_func_t::return_value_t* return_value, std::vector<lua::memory::type_info_t> param_types, const lua::memory::runtime_func_t::parameters_t* params, const uint8_t param_count)
 	{
-		std::scoped_lock guard(m_module_lock);
+		const auto snapshot = m_snapshot.load();
 
 		bool call_orig_if_true = true;
 
-		for (const auto& module : m_modules)
+		for (const auto module : snapshot->m_pre_hook_subscribers.find(target_func_ptr))
 		{
+			std::lock_guard guard(module->m_state_lock);
+
 			const auto it = module->m_dynamic_hook_pre_callbacks.find(target_func_ptr);
 			if (it != module->m_dynamic_hook_pre_callbacks.end())
 			{
@@ -211,10 +305,12 @@ namespace big
 
 	void lua_manager::dynamic_hook_post_callbacks(const uintptr_t target_func_ptr, lua::memory::type_info_t return_type, lua::memory::runtime_func_t::return_value_t* return_value, std::vector<lua::memory::type_info_t> param_types, const lua::memory::runtime_func_t::parameters_t* params, const uint8_t param_count)
 	{
-		std::scoped_lock guard(m_module_lock);
+		const auto snapshot = m_snapshot.load();
 
-		for (const auto& module : m_modules)
+		for (const auto module : snapshot->m_post_hook_subscribers.find(target_func_ptr))
 		{
+			std::lock_guard guard(module->m_state_lock);
+
 			const auto it = module->m_dynamic_hook_post_callbacks.find(target_func_ptr);
 			if (it != module->m_dynamic_hook_post_callbacks.end())
 			{
@@ -266,10 +362,9 @@ namespace big
 
 			// unload module
 			{
-				std::lock_guard guard(m_disabled_module_lock);
-				std::erase_if(m_modules, [module_id](auto& module) {
-					return module_id == module->module_id();
-				});
+				std::lock_guard guard(m_module_lock);
+				retire(module_id);
+				publish_snapshot();
 			}
 
 			const auto new_module_path =
@@ -285,9 +380,8 @@ namespace big
 	void lua_manager::unload_module(rage::joaat_t module_id)
 	{
 		std::lock_guard guard(m_module_lock);
-		std::erase_if(m_modules, [module_id](auto& module) {
-			return module_id == module->module_id();
-		});
+		retire(module_id);
+		publish_snapshot();
 
 		std::lock_guard guard2(m_disabled_module_lock);
 		std::erase_if(m_disabled_modules, [module_id](auto& module) {
@@ -323,6 +417,7 @@ namespace big
 		{
 			module->load_and_call_script();
 			m_modules.push_back(module);
+			publish_snapshot();
 
 			return module;
 		}
@@ -1,15 +1,40 @@
 #pragma once
 #include "lua_module.hpp"
+#include "subscriber_table.hpp"
 
 namespace big
 {
+	// Immutable copy of the loaded modules, their GUI elements and which of them subscribed to what, replaced whenever any of it changes.
+	// The render thread draws from it and events are dispatched from it without taking m_module_lock.
+	struct lua_module_snapshot
+	{
+		struct module_gui
+		{
+			std::shared_ptr<lua_module> m_module;
+			std::vector<std::shared_ptr<lua::gui::gui_element>> m_independent_gui;
+			std::unordered_map<rage::joaat_t, std::vector<std::shared_ptr<lua::gui::gui_element>>> m_gui;
+		};
+
+		std::vector<module_gui> m_modules;
+
+		// only the modules with at least one callback, kept alive by m_modules
+		subscriber_table<menu_event, lua_module> m_event_subscribers;
+		subscriber_table<uintptr_t, lua_module> m_pre_hook_subscribers;
+		subscriber_table<uintptr_t, lua_module> m_post_hook_subscribers;
+	};
+
 	class lua_manager final
 	{
 	private:
 		std::mutex m_module_lock;
 		std::vector<std::shared_ptr<lua_module>> m_modules;
+		std::atomic<std::shared_ptr<const lua_module_snapshot>> m_snapshot;
+		std::atomic_bool m_snapshot_dirty = false;
 		std::mutex m_disabled_module_lock;
 		std::vector<std::shared_ptr<lua_module>> m_disabled_modules;
+		// unloaded modules that snapshots may still reference, destroyed by update_snapshot() on the game thread once they don't
+		std::vector<std::shared_ptr<lua_module>> m_graveyard;
+		std::atomic_bool m_graveyard_pending = false;
 
 		static constexpr std::chrono::seconds m_delay_between_changed_scripts_check = 3s;
 		std::chrono::high_resolution_clock::time_point m_wake_time_changed_scripts_check;
@@ -18,6 +43,12 @@ namespace big
 		folder m_scripts_folder;
 		folder m_scripts_config_folder;
 
+		// must be called with m_module_lock held
+		void publish_snapshot();
+		// takes a module out of the snapshots' reach, must be called with m_module_lock held
+		void retire(std::shared_ptr<lua_module> module);
+		void retire(rage::joaat_t module_id);
+
 	public:
 		lua_manager(folder scripts_folder, folder scripts_config_folder);
 		~lua_manager();
@@ -46,6 +77,15 @@ namespace big
 		std::weak_ptr<lua_module> get_module(rage::joaat_t module_id);
 		std::weak_ptr<lua_module> get_disabled_module(rage::joaat_t module_id);
 
+		// called by the bindings when a module changes its GUI or registers a callback, picked up by update_snapshot()
+		inline void mark_snapshot_dirty()
+		{
+			m_snapshot_dirty = true;
+		}
+
+		// republishes the snapshot if a module changed and destroys unloaded modules, called from the game thread every tick
+		void update_snapshot();
+
 		bool has_gui_to_draw(rage::joaat_t tab_hash);
 		void draw_independent_gui();
 		void draw_gui(rage::joaat_t tab_hash);
@@ -63,13 +103,21 @@ namespace big
 
 		void handle_error(const sol::error& error, const sol::state_view& state);
 
+		// lets callers skip building the arguments of an event nobody listens to
+		inline bool has_event_subscribers(menu_event menu_event_) const
+		{
+			return m_snapshot.load()->m_event_subscribers.contains(menu_event_);
+		}
+
 		template<menu_event menu_event_, typename Return = void, typename... Args>
 		inline std::conditional_t<std::is_void_v<Return>, void, std::optional<Return>> trigger_event(Args&&... args)
 		{
-			std::lock_guard guard(m_module_lock);
+			const auto snapshot = m_snapshot.load();
 
-			for (auto& module : m_modules)
+			for (const auto module : snapshot->m_event_subscribers.find(menu_event_))
 			{
+				std::lock_guard guard(module->m_state_lock);
+
 				if (auto vec = module->m_event_callbacks.find(menu_event_); vec != module->m_event_callbacks.end())
 				{
 					for (auto& cb : vec->second)
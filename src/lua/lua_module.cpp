@@ -14,6 +14,7 @@
 #include "bindings/network.hpp"
 #include "bindings/script.hpp"
 #include "bindings/scr_function.hpp"
+#include "bindings/script_layout.hpp"
 #include "bindings/self.hpp"
 #include "bindings/stats.hpp"
 #include "bindings/tunables.hpp"
@@ -127,13 +128,19 @@ namespace big
 			m_registered_scripts.clear();
 		}
 
+		remove_owned_tabs();
+
+		for (auto memory : m_allocated_memory)
+			delete[] memory;
+	}
+
+	void lua_module::remove_owned_tabs()
+	{
 		for (const auto owned_tab : m_owned_tabs)
 		{
 			big::g_gui_service->remove_from_nav(owned_tab);
 		}
-
-		for (auto memory : m_allocated_memory)
-			delete[] memory;
+		m_owned_tabs.clear();
 	}
 
 	rage::joaat_t lua_module::module_id() const
@@ -307,6 +314,7 @@ namespace big
 		lua::command::bind(m_state);
 		lua::tunables::bind(m_state);
 		lua::locals::bind(m_state);
+		lua::script_layout::bind(m_state);
 		lua::event::bind(m_state);
 		lua::vector::bind(m_state);
 		lua::global_table::bind(m_state);
@@ -320,6 +328,8 @@ namespace big
 
 	void lua_module::load_and_call_script()
 	{
+		std::lock_guard state_guard(m_state_lock);
+
 		auto result = m_state.safe_script_file(m_module_path.string(), &sol::script_pass_on_error, sol::load_mode::text);
 
 		if (!result.valid())
@@ -335,6 +345,7 @@ namespace big
 
 	void lua_module::tick_scripts()
 	{
+		std::lock_guard state_guard(m_state_lock);
 		std::lock_guard guard(m_registered_scripts_mutex);
 
 		const auto script_count = m_registered_scripts.size();
@@ -26,6 +26,9 @@ namespace big
 		std::mutex m_registered_scripts_mutex;
 
 	public:
+		// held by every thread while it runs code in m_state, recursive because Lua can end up triggering events itself
+		std::recursive_mutex m_state_lock;
+
 		std::vector<std::unique_ptr<script>> m_registered_scripts;
 		std::vector<std::unique_ptr<lua_patch>> m_registered_patches;
 
@@ -33,8 +36,9 @@ namespace big
 
 		std::unordered_map<big::tabs, std::vector<big::tabs>> m_tab_to_sub_tabs;
 
-		std::vector<std::unique_ptr<lua::gui::gui_element>> m_independent_gui;
-		std::unordered_map<rage::joaat_t, std::vector<std::unique_ptr<lua::gui::gui_element>>> m_gui;
+		// shared with the snapshots the render thread draws from, see lua_manager::publish_snapshot
+		std::vector<std::shared_ptr<lua::gui::gui_element>> m_independent_gui;
+		std::unordered_map<rage::joaat_t, std::vector<std::shared_ptr<lua::gui::gui_element>>> m_gui;
 		std::unordered_map<menu_event, std::vector<sol::protected_function>> m_event_callbacks;
 		std::vector<void*> m_allocated_memory;
 
@@ -44,6 +48,9 @@ namespace big
 		lua_module(const std::filesystem::path& module_path, folder& scripts_folder, bool disabled = false);
 		~lua_module();
 
+		// done when the module is unloaded rather than when it is destroyed, a reloaded copy may already be using the same tabs by then
+		void remove_owned_tabs();
+
 		const std::filesystem::path& module_path() const;
 
 		rage::joaat_t module_id() const;
@@ -0,0 +1,35 @@
+#pragma once
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace big
+{
+	// Which subscribers registered for which event or hook, filled while a lua_module_snapshot is built and never changed
+	// after it's published. Doesn't know about Lua so that the dispatch can be measured without it.
+	template<typename Key, typename Subscriber>
+	class subscriber_table
+	{
+	public:
+		void add(const Key& key, Subscriber* subscriber)
+		{
+			m_subscribers[key].push_back(subscriber);
+		}
+
+		[[nodiscard]] bool contains(const Key& key) const
+		{
+			return m_subscribers.contains(key);
+		}
+
+		// in the order they subscribed, empty if nobody did
+		[[nodiscard]] std::span<Subscriber* const> find(const Key& key) const
+		{
+			if (const auto it = m_subscribers.find(key); it != m_subscribers.end())
+				return it->second;
+			return {};
+		}
+
+	private:
+		std::unordered_map<Key, std::vector<Subscriber*>> m_subscribers;
+	};
+}
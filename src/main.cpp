@@ -12,6 +12,7 @@
 #include "rage/gameSkeleton.hpp"
 #include "renderer/renderer.hpp"
 #include "script_mgr.hpp"
+#include "service_orchestrator.hpp"
 #include "services/api/api_service.hpp"
 #include "services/context_menu/context_menu_service.hpp"
 #include "services/custom_text/custom_text_service.hpp"
@@ -21,7 +22,9 @@
 #include "services/matchmaking/matchmaking_service.hpp"
 #include "services/mobile/mobile_service.hpp"
 #include "services/model_preview/model_preview_service.hpp"
+#include "services/net_capture/net_capture.hpp"
 #include "services/notifications/notification_service.hpp"
+#include "services/packet_log/packet_log.hpp"
 #include "services/pickups/pickup_service.hpp"
 #include "services/player_database/player_database_service.hpp"
 #include "services/players/player_service.hpp"
@@ -195,34 +198,55 @@ BOOL APIENTRY DllMain(HMODULE hmod, DWORD reason, PVOID)
 			    auto fiber_pool_instance = std::make_unique<fiber_pool>(11);
 			    LOG(INFO) << "Fiber pool initialized.";
 
-			    g_http_client.init(g_file_manager.get_project_file("./proxy_settings.json"));
-			    LOG(INFO) << "HTTP Client initialized.";
-
-			    g_translation_service.init();
-			    LOG(INFO) << "Translation Service initialized.";
-
-			    auto hooking_instance = std::make_unique<hooking>();
-			    LOG(INFO) << "Hooking initialized.";
-
-			    g_gta_data_service.init();
-
-			    auto context_menu_service_instance      = std::make_unique<context_menu_service>();
-			    auto custom_text_service_instance       = std::make_unique<custom_text_service>();
-			    auto mobile_service_instance            = std::make_unique<mobile_service>();
-			    auto pickup_service_instance            = std::make_unique<pickup_service>();
-			    auto player_service_instance            = std::make_unique<player_service>();
-			    auto model_preview_service_instance     = std::make_unique<model_preview_service>();
-			    auto handling_service_instance          = std::make_unique<handling_service>();
-			    auto gui_service_instance               = std::make_unique<gui_service>();
-			    auto script_patcher_service_instance    = std::make_unique<script_patcher_service>();
-			    auto player_database_service_instance   = std::make_unique<player_database_service>();
-			    auto hotkey_service_instance            = std::make_unique<hotkey_service>();
-			    auto matchmaking_service_instance       = std::make_unique<matchmaking_service>();
-			    auto api_service_instance               = std::make_unique<api_service>();
-			    auto tunables_service_instance          = std::make_unique<tunables_service>();
-			    auto script_connection_service_instance = std::make_unique<script_connection_service>();
-			    auto xml_vehicles_service_instance      = std::make_unique<xml_vehicles_service>();
-			    auto xml_maps_service_instance          = std::make_unique<xml_map_service>();
+			    // services declare what they need to exist before them, everything else is brought up concurrently
+			    service_orchestrator services;
+			    services.add("HTTP Client", {}, [] {
+				    g_http_client.init(g_file_manager.get_project_file("./proxy_settings.json"));
+			    });
+			    services.add("Translation Service", {"HTTP Client"}, [] {
+				    g_translation_service.init();
+			    });
+			    // MinHook isn't thread safe
+			    services.add_instance<hooking>("Hooking", {}, true);
+			    services.add("GTA Data Service", {}, [] {
+				    g_gta_data_service.init();
+			    });
+			    services.add(
+			        "Packet Log",
+			        {},
+			        [] {
+				        g_packet_log.start();
+			        },
+			        [] {
+				        g_packet_log.stop();
+			        });
+			    // captures are started from the gui, this only makes sure the writer is joined before we unload
+			    services.add(
+			        "Net Capture",
+			        {},
+			        [] {},
+			        [] {
+				        g_net_capture.stop();
+			        });
+			    services.add_instance<context_menu_service>("Context Menu Service", {"Hooking"});
+			    services.add_instance<custom_text_service>("Custom Text Service", {"Hooking"});
+			    services.add_instance<mobile_service>("Mobile Service", {"Hooking"});
+			    services.add_instance<pickup_service>("Pickup Service", {"Hooking"});
+			    services.add_instance<player_service>("Player Service", {"Hooking"});
+			    services.add_instance<model_preview_service>("Model Preview Service", {"Hooking"});
+			    services.add_instance<handling_service>("Handling Service", {"Hooking"});
+			    services.add_instance<gui_service>("Gui Service", {"Hooking"});
+			    services.add_instance<script_patcher_service>("Script Patcher Service", {"Hooking"});
+			    services.add_instance<player_database_service>("Player Database Service", {"Hooking"});
+			    // registers a wndproc callback with the renderer
+			    services.add_instance<hotkey_service>("Hotkey Service", {"Hooking"}, true);
+			    services.add_instance<matchmaking_service>("Matchmaking Service", {"Hooking"});
+			    services.add_instance<api_service>("API Service", {"Hooking", "HTTP Client"});
+			    services.add_instance<tunables_service>("Tunables Service", {"Hooking"});
+			    services.add_instance<script_connection_service>("Script Connection Service", {"Hooking"});
+			    services.add_instance<xml_vehicles_service>("Xml Vehicles Service", {"Hooking"});
+			    services.add_instance<xml_map_service>("Xml Maps Service", {"Hooking"});
+			    services.start();
 			    LOG(INFO) << "Registered service instances...";
 
 			    g_notification_service.initialise();
@@ -284,43 +308,9 @@ BOOL APIENTRY DllMain(HMODULE hmod, DWORD reason, PVOID)
 			    thread_pool_instance->destroy();
 			    LOG(INFO) << "Destroyed thread pool.";
 
-			    script_connection_service_instance.reset();
-			    LOG(INFO) << "Script Connection Service reset.";
-			    tunables_service_instance.reset();
-			    LOG(INFO) << "Tunables Service reset.";
-			    hotkey_service_instance.reset();
-			    LOG(INFO) << "Hotkey Service reset.";
-			    matchmaking_service_instance.reset();
-			    LOG(INFO) << "Matchmaking Service reset.";
-			    player_database_service_instance.reset();
-			    LOG(INFO) << "Player Database Service reset.";
-			    api_service_instance.reset();
-			    LOG(INFO) << "API Service reset.";
-			    script_patcher_service_instance.reset();
-			    LOG(INFO) << "Script Patcher Service reset.";
-			    gui_service_instance.reset();
-			    LOG(INFO) << "Gui Service reset.";
-			    handling_service_instance.reset();
-			    LOG(INFO) << "Vehicle Service reset.";
-			    model_preview_service_instance.reset();
-			    LOG(INFO) << "Model Preview Service reset.";
-			    mobile_service_instance.reset();
-			    LOG(INFO) << "Mobile Service reset.";
-			    player_service_instance.reset();
-			    LOG(INFO) << "Player Service reset.";
-			    pickup_service_instance.reset();
-			    LOG(INFO) << "Pickup Service reset.";
-			    custom_text_service_instance.reset();
-			    LOG(INFO) << "Custom Text Service reset.";
-			    context_menu_service_instance.reset();
-			    LOG(INFO) << "Context Service reset.";
-			    xml_vehicles_service_instance.reset();
-			    LOG(INFO) << "Xml Vehicles Service reset.";
+			    services.stop();
 			    LOG(INFO) << "Services uninitialized.";
 
-			    hooking_instance.reset();
-			    LOG(INFO) << "Hooking uninitialized.";
-
 			    fiber_pool_instance.reset();
 			    LOG(INFO) << "Fiber pool uninitialized.";
 
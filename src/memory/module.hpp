@@ -35,5 +35,6 @@ namespace memory
 	private:
 		const std::string_view m_name;
 		bool m_loaded;
+		DWORD m_timestamp;
 	};
 }
@@ -1,8 +1,9 @@
 #include "range.hpp"
 
-#include "../common.hpp"
 #include "pattern.hpp"
 
+#include <cstdint>
+
 namespace memory
 {
 	range::range(handle base, std::size_t size) :
@@ -74,7 +75,7 @@ namespace memory
 					current_idx += shift_table[*begin.add(current_idx + max_idx).as<uint8_t*>()];
 					break;
 				}
-				else if (sig_idx == NULL)
+				else if (sig_idx == 0)
 				{
 					return begin.add(current_idx);
 				}
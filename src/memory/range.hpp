@@ -2,6 +2,8 @@
 #include "fwddec.hpp"
 #include "handle.hpp"
 
+#include <cstddef>
+#include <optional>
 #include <vector>
 
 namespace memory
@@ -23,6 +25,5 @@ namespace memory
 	protected:
 		handle m_base;
 		std::size_t m_size;
-		DWORD m_timestamp;
 	};
 }
@@ -18,9 +18,11 @@ namespace big
 		{
 			if (g_tunables_service->caching_tunables())
 			{
-				g_tunables_service->m_junk_values.emplace(g_tunables_service->m_current_junk_val, src->get_arg<Hash>(0));
-				src->set_return_value<int>(g_tunables_service->m_current_junk_val++);
-				return;
+				if (const auto junk = g_tunables_service->get_junk_value(src->get_arg<Hash>(0)))
+				{
+					src->set_return_value<int>(*junk);
+					return;
+				}
 			}
 			src->set_return_value<int>(NETWORK::_NETWORK_GET_TUNABLES_REGISTRATION_INT(src->get_arg<Hash>(0), src->get_arg<int>(1)));
 		};
@@ -29,9 +31,11 @@ namespace big
 		{
 			if (g_tunables_service->caching_tunables())
 			{
-				g_tunables_service->m_junk_values.emplace(g_tunables_service->m_current_junk_val, src->get_arg<Hash>(0));
-				src->set_return_value<int>(g_tunables_service->m_current_junk_val++);
-				return;
+				if (const auto junk = g_tunables_service->get_junk_value(src->get_arg<Hash>(0)))
+				{
+					src->set_return_value<int>(*junk);
+					return;
+				}
 			}
 			src->set_return_value<BOOL>(NETWORK::_NETWORK_GET_TUNABLES_REGISTRATION_BOOL(src->get_arg<Hash>(0), src->get_arg<BOOL>(1)));
 		};
@@ -40,9 +44,11 @@ namespace big
 		{
 			if (g_tunables_service->caching_tunables())
 			{
-				g_tunables_service->m_junk_values.emplace(g_tunables_service->m_current_junk_val, src->get_arg<Hash>(0));
-				src->set_return_value<int>(g_tunables_service->m_current_junk_val++);
-				return;
+				if (const auto junk = g_tunables_service->get_junk_value(src->get_arg<Hash>(0)))
+				{
+					src->set_return_value<int>(*junk);
+					return;
+				}
 			}
 			src->set_return_value<float>(NETWORK::_NETWORK_GET_TUNABLES_REGISTRATION_FLOAT(src->get_arg<Hash>(0), src->get_arg<float>(1)));
 		};
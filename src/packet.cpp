@@ -1,6 +1,8 @@
 #include "packet.hpp"
 
 #include "gta_util.hpp"
+#include "services/packet_log/packet_log.hpp"
+#include "util/net_message.hpp"
 
 #include <network/Network.hpp>
 #include <network/netConnection.hpp>
@@ -14,19 +16,62 @@ namespace big
 
 	void packet::send(uint32_t msg_id)
 	{
+		log(0, -1, msg_id, nullptr);
+
 		g_pointers->m_gta
 		    .m_queue_packet(gta_util::get_network()->m_game_session_ptr->m_net_connection_mgr, msg_id, m_data, (m_buffer.m_curBit + 7) >> 3, 1, nullptr);
 	}
 
 	void packet::send(player_ptr player, int connection_id)
 	{
-		send(player->get_session_player()->m_player_data.m_peer_id_2, connection_id);
+		send_to_peer(player->get_session_player()->m_player_data.m_peer_id_2, connection_id, player);
 	}
 
 	void packet::send(int peer_id, int connection_id)
 	{
+		send_to_peer(peer_id, connection_id, nullptr);
+	}
+
+	void packet::send_to_peer(int peer_id, int connection_id, player_ptr player)
+	{
+		log(connection_id, peer_id, -1, player);
+
 		auto mgr  = gta_util::get_network()->m_game_session_ptr->m_net_connection_mgr;
 		auto peer = g_pointers->m_gta.m_get_connection_peer(mgr, peer_id);
 		g_pointers->m_gta.m_send_packet(mgr, &peer->m_peer_address, connection_id, m_data, (m_buffer.m_curBit + 7) >> 3, 0x1000000);
 	}
+
+	void packet::log(std::uint32_t connection_id, int peer_id, int msg_id, player_ptr player)
+	{
+		// don't parse the header of every packet we send while logging is off
+		if (g.debug.logs.packet_logs == 0)
+			return;
+
+		const auto size = (m_buffer.m_curBit + 7) >> 3;
+
+		rage::datBitBuffer buffer(m_data, size);
+		rage::eNetMessage type;
+		if (!read_net_message_header(buffer, m_data, size, type))
+			type = rage::eNetMessage::MsgInvalid;
+
+		if (!g_packet_log.should_log(type, ePacketDirection::OUTGOING, player ? player->id() : -1))
+			return;
+
+		packet_log_entry entry{};
+		entry.m_time          = std::chrono::system_clock::now();
+		entry.m_type          = type;
+		entry.m_direction     = ePacketDirection::OUTGOING;
+		entry.m_size          = size;
+		entry.m_connection_id = connection_id;
+		entry.m_peer_id       = peer_id;
+		entry.m_msg_id        = msg_id;
+
+		if (player)
+		{
+			entry.m_rockstar_id = player->get_rockstar_id();
+			strncpy(entry.m_name, player->get_name(), sizeof(entry.m_name) - 1);
+		}
+
+		g_packet_log.push(entry);
+	}
 }
\ No newline at end of file
@@ -49,5 +49,9 @@ namespace big
 			buf.WriteQWord(peer_id, 64);
 			m_buffer.WriteArray(b, 8 * buf.GetDataLength());
 		}
+
+	private:
+		void send_to_peer(int peer_id, int connection_id, player_ptr player);
+		void log(std::uint32_t connection_id, int peer_id, int msg_id, player_ptr player);
 	};
 }
\ No newline at end of file
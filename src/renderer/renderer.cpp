@@ -64,6 +64,7 @@ namespace big
 
 			return false;
 		}
+		m_dx_callback_probes.try_emplace(priority, std::format("dx_callback {}", priority));
 		return true;
 	}
 
@@ -76,9 +77,14 @@ namespace big
 	{
 		if (m_font_mgr.can_use()) [[likely]]
 		{
+			telemetry_scope present_scope(m_present_probe);
+
 			new_frame();
-			for (const auto& cb : m_dx_callbacks | std::views::values)
+			for (const auto& [priority, cb] : m_dx_callbacks)
+			{
+				telemetry_scope callback_scope(m_dx_callback_probes.at(priority));
 				cb();
+			}
 			end_frame();
 
 			m_font_mgr.release_use();
@@ -1,6 +1,7 @@
 #pragma once
 #include "common.hpp"
 #include "font_mgr.hpp"
+#include "services/telemetry/telemetry_service.hpp"
 
 namespace big
 {
@@ -56,6 +57,8 @@ namespace big
 		ID3D11DeviceContext* m_d3d_device_context;
 
 		std::map<uint32_t, dx_callback> m_dx_callbacks;
+		std::map<uint32_t, telemetry_probe> m_dx_callback_probes;
+		telemetry_probe m_present_probe{"renderer::on_present"};
 		std::vector<wndproc_callback> m_wndproc_callbacks;
 
 		font_mgr m_font_mgr;
@@ -8,6 +8,7 @@ namespace big
 	{
 		m_name       = name;
 		m_toggleable = toggleable;
+		m_probe.set_name(std::format("script {}", name));
 	}
 
 	script::script(const func_t func, const std::optional<std::size_t> stack_size) :
@@ -16,7 +17,8 @@ namespace big
 	    m_script_fiber(nullptr),
 	    m_main_fiber(nullptr),
 	    m_func(func),
-	    m_done(false)
+	    m_done(false),
+	    m_probe("script (unnamed)")
 	{
 		m_script_fiber = CreateFiber(
 		    stack_size.has_value() ? stack_size.value() : 0,
@@ -69,6 +71,7 @@ namespace big
 		m_main_fiber = GetCurrentFiber();
 		if (!m_wake_time.has_value() || m_wake_time.value() <= std::chrono::high_resolution_clock::now())
 		{
+			telemetry_scope fiber_scope(m_probe);
 			SwitchToFiber(m_script_fiber);
 		}
 	}
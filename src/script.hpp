@@ -1,4 +1,5 @@
 #pragma once
+#include "services/telemetry/telemetry_service.hpp"
 
 namespace big
 {
@@ -38,5 +39,6 @@ namespace big
 		void* m_main_fiber;
 		func_t m_func;
 		std::optional<std::chrono::high_resolution_clock::time_point> m_wake_time;
+		telemetry_probe m_probe;
 	};
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "script_function.hpp"
 
+#include "services/script_function_cache/script_function_cache.hpp"
+
 namespace big
 {
 	script_function::script_function(const std::string& name, const rage::joaat_t script, const std::string& pattern) :
@@ -8,6 +10,35 @@ namespace big
 	    m_pattern(pattern),
 	    m_ip(0)
 	{
+		registry().push_back(this);
+	}
+
+	std::vector<script_function*>& script_function::registry()
+	{
+		static std::vector<script_function*> functions;
+		return functions;
+	}
+
+	void script_function::on_script_load(rage::scrProgram* program)
+	{
+		std::vector<script_function*> functions;
+		std::vector<std::string> patterns;
+		for (const auto function : registry())
+		{
+			if (function->m_script == program->m_name_hash)
+			{
+				functions.push_back(function);
+				patterns.push_back(function->m_pattern);
+			}
+		}
+
+		if (functions.empty())
+			return;
+
+		// a reloaded script can have different bytecode, so the locations are refreshed every time it loads
+		const auto locations = g_script_function_cache.resolve(program, patterns);
+		for (std::size_t i = 0; i < functions.size(); i++)
+			functions[i]->m_ip = locations[i].value_or(0);
 	}
 
 	uint32_t script_function::get_ip(rage::scrProgram* program)
@@ -15,7 +46,7 @@ namespace big
 		if (m_ip != 0)
 			return m_ip;
 
-		if (auto location = scripts::get_code_location_by_pattern(program, m_pattern))
+		if (auto location = g_script_function_cache.resolve(program, m_pattern))
 		{
 			m_ip = *location;
 			LOG(VERBOSE) << "Found pattern " << m_name << " at " << HEX_TO_UPPER(m_ip) << " in script " << program->m_name;
@@ -11,14 +11,20 @@ namespace big
 	class script_function
 	{
 		rage::joaat_t m_script;
-		const memory::pattern m_pattern;
+		const std::string m_pattern;
 		uint32_t m_ip;
 		std::string m_name;
 
+		// function local so that the inline instances can register themselves in any initialization order
+		static std::vector<script_function*>& registry();
+
 	public:
 		script_function(const std::string& name, const rage::joaat_t script, const std::string& pattern);
 		uint32_t get_ip(rage::scrProgram* program);
 
+		// resolves every script_function of the program's script in a single pass over its bytecode
+		static void on_script_load(rage::scrProgram* program);
+
 		template<typename Arg>
 		void push_arg(uint64_t* stack, uint32_t& stack_pointer, Arg&& value)
 		{
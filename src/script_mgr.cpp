@@ -5,6 +5,8 @@
 #include "gta_util.hpp"
 #include "pointers.hpp"
 #include "script/tlsContext.hpp"
+#include "services/pool_snapshot/pool_snapshot_service.hpp"
+#include "services/tunables/tunables_service.hpp"
 
 namespace big
 {
@@ -24,6 +26,8 @@ namespace big
 
 	void script_mgr::tick()
 	{
+		telemetry_scope tick_scope(m_tick_probe);
+
 		gta_util::execute_as_script("main_persistent"_J, std::mem_fn(&script_mgr::tick_internal), this);
 	}
 
@@ -42,6 +46,8 @@ namespace big
 			module->tick_scripts();
 			module->cleanup_done_scripts();
 		});
+
+		g_lua_manager->update_snapshot();
 	}
 
 	void script_mgr::tick_internal()
@@ -50,6 +56,11 @@ namespace big
 
 		std::lock_guard lock(m_mutex);
 
+		g_pool_snapshot_service.invalidate();
+
+		if (g_tunables_service)
+			g_tunables_service->refresh_handles();
+
 		lua_manager_tick();
 
 		for (const auto& script : m_scripts)
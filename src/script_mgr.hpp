@@ -1,6 +1,7 @@
 #pragma once
 #include "lua/lua_manager.hpp"
 #include "script.hpp"
+#include "services/telemetry/telemetry_service.hpp"
 
 namespace big
 {
@@ -47,6 +48,8 @@ namespace big
 		script_list m_scripts;
 
 		bool m_can_tick = false;
+
+		telemetry_probe m_tick_probe{"script_mgr::tick"};
 	};
 
 	inline script_mgr g_script_mgr;
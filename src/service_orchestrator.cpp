@@ -0,0 +1,181 @@
+#include "service_orchestrator.hpp"
+
+#include "thread_pool.hpp"
+
+namespace big
+{
+	void service_orchestrator::add(std::string name, std::vector<std::string> dependencies, std::function<void()> start, std::function<void()> stop, bool main_thread)
+	{
+		m_nodes.push_back({std::move(name), std::move(dependencies), std::move(start), std::move(stop), main_thread});
+	}
+
+	void service_orchestrator::resolve()
+	{
+		std::unordered_map<std::string_view, std::size_t> indices;
+		for (std::size_t i = 0; i < m_nodes.size(); i++)
+			indices.emplace(m_nodes[i].m_name, i);
+
+		for (std::size_t i = 0; i < m_nodes.size(); i++)
+		{
+			for (const auto& dependency : m_nodes[i].m_dependency_names)
+			{
+				const auto it = indices.find(dependency);
+				if (it == indices.end())
+					throw std::runtime_error(std::format("Service {} depends on unknown service {}", m_nodes[i].m_name, dependency));
+
+				m_nodes[it->second].m_dependents.push_back(i);
+				m_nodes[i].m_pending_dependencies++;
+			}
+		}
+
+		std::vector<std::size_t> pending(m_nodes.size());
+		std::set<std::size_t> ready;
+		for (std::size_t i = 0; i < m_nodes.size(); i++)
+			if (!(pending[i] = m_nodes[i].m_pending_dependencies))
+				ready.insert(i);
+
+		while (!ready.empty())
+		{
+			const auto index = *ready.begin();
+			ready.erase(ready.begin());
+			m_order.push_back(index);
+
+			for (const auto dependent : m_nodes[index].m_dependents)
+				if (--pending[dependent] == 0)
+					ready.insert(dependent);
+		}
+
+		if (m_order.size() != m_nodes.size())
+			throw std::runtime_error("Service dependencies contain a cycle");
+	}
+
+	void service_orchestrator::schedule(std::size_t index)
+	{
+		if (m_nodes[index].m_main_thread)
+		{
+			m_main_thread_queue.push_back(index);
+			return;
+		}
+
+		if (m_running_workers >= max_parallel_workers)
+		{
+			m_worker_queue.push_back(index);
+			return;
+		}
+
+		m_running_workers++;
+		g_thread_pool->push([this, index] {
+			run(index);
+		});
+	}
+
+	void service_orchestrator::run(std::size_t index)
+	{
+		auto& node       = m_nodes[index];
+		const auto begin = std::chrono::steady_clock::now();
+
+		std::exception_ptr exception;
+		try
+		{
+			node.m_start();
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+		}
+
+		const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin);
+
+		std::unique_lock lock(m_mutex);
+		if (exception)
+		{
+			LOG(FATAL) << node.m_name << " failed to initialize.";
+			if (!m_exception)
+				m_exception = exception;
+			// released under the lock, start() may already be rethrowing it
+			exception = nullptr;
+		}
+		else
+		{
+			LOG(INFO) << node.m_name << " initialized in " << elapsed.count() << "ms" << (node.m_main_thread ? " on the main thread." : ".");
+			node.m_started = true;
+
+			// dependents of a failed service are never started
+			if (!m_exception)
+				for (const auto dependent : node.m_dependents)
+					if (--m_nodes[dependent].m_pending_dependencies == 0)
+						schedule(dependent);
+		}
+
+		if (!node.m_main_thread)
+		{
+			m_running_workers--;
+			if (!m_worker_queue.empty() && !m_exception)
+			{
+				const auto next = m_worker_queue.front();
+				m_worker_queue.pop_front();
+				schedule(next);
+			}
+		}
+
+		m_finished++;
+		m_condition.notify_all();
+	}
+
+	void service_orchestrator::start()
+	{
+		const auto begin = std::chrono::steady_clock::now();
+
+		resolve();
+
+		std::unique_lock lock(m_mutex);
+		for (std::size_t i = 0; i < m_nodes.size(); i++)
+			if (m_nodes[i].m_pending_dependencies == 0)
+				schedule(i);
+
+		for (;;)
+		{
+			m_condition.wait(lock, [this] {
+				return !m_main_thread_queue.empty() || m_finished == m_nodes.size() || (m_exception && m_running_workers == 0);
+			});
+
+			if (m_finished == m_nodes.size() || (m_exception && m_running_workers == 0))
+				break;
+
+			const auto index = m_main_thread_queue.front();
+			m_main_thread_queue.pop_front();
+
+			lock.unlock();
+			run(index);
+			lock.lock();
+		}
+
+		if (m_exception)
+		{
+			// the services that did start would otherwise be destroyed with m_nodes, in registration order and without stop
+			lock.unlock();
+			stop();
+			std::rethrow_exception(m_exception);
+		}
+
+		LOG(INFO) << "Initialized " << m_nodes.size() << " services in "
+		          << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count() << "ms.";
+	}
+
+	void service_orchestrator::stop()
+	{
+		for (auto it = m_order.rbegin(); it != m_order.rend(); ++it)
+		{
+			auto& node = m_nodes[*it];
+			if (!node.m_started)
+				continue;
+
+			if (node.m_stop)
+			{
+				node.m_stop();
+				LOG(INFO) << node.m_name << " uninitialized.";
+			}
+			node.m_started = false;
+		}
+	}
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <deque>
+
+namespace big
+{
+	// Brings up services as a dependency graph. Services whose dependencies are done are started concurrently
+	// on the thread pool, or on the thread calling start() if they have to run on the main thread.
+	// stop() tears them down in the reverse of a deterministic topological order, independent of how startup was scheduled.
+	class service_orchestrator final
+	{
+	public:
+		// keep the thread pool from growing just for startup
+		static constexpr std::size_t max_parallel_workers = 3;
+
+		void add(std::string name, std::vector<std::string> dependencies, std::function<void()> start, std::function<void()> stop = nullptr, bool main_thread = false);
+
+		template<typename T>
+		void add_instance(std::string name, std::vector<std::string> dependencies, bool main_thread = false)
+		{
+			auto instance = std::make_shared<std::unique_ptr<T>>();
+			add(
+			    std::move(name),
+			    std::move(dependencies),
+			    [instance] {
+				    *instance = std::make_unique<T>();
+			    },
+			    [instance] {
+				    instance->reset();
+			    },
+			    main_thread);
+		}
+
+		// blocks until every service has started, rethrows the first exception a service threw
+		// after stopping the services that did start
+		void start();
+		void stop();
+
+	private:
+		struct node
+		{
+			std::string m_name;
+			std::vector<std::string> m_dependency_names;
+			std::function<void()> m_start;
+			std::function<void()> m_stop;
+			bool m_main_thread;
+
+			std::vector<std::size_t> m_dependents;
+			std::size_t m_pending_dependencies = 0;
+			bool m_started                     = false;
+		};
+
+		void resolve();
+		void schedule(std::size_t index);
+		void run(std::size_t index);
+
+		std::vector<node> m_nodes;
+		// topological order with ties broken by registration order
+		std::vector<std::size_t> m_order;
+
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::deque<std::size_t> m_main_thread_queue;
+		std::deque<std::size_t> m_worker_queue;
+		std::size_t m_running_workers = 0;
+		std::size_t m_finished        = 0;
+		std::exception_ptr m_exception;
+	};
+}
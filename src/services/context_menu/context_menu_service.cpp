@@ -23,116 +23,69 @@ namespace big
 
 	void context_menu_service::fill_model_bounding_box_screen_space()
 	{
+		// sanity check
+		if (!m_pointer || !m_pointer->m_navigation || !m_pointer->m_model_info)
+			return;
+
 		Vector3 forward, right, up, pos;
 		ENTITY::GET_ENTITY_MATRIX(m_handle, &forward, &right, &up, &pos);
 
-		const auto hash = ENTITY::GET_ENTITY_MODEL(m_handle);
-		Vector3 min, max;
-		MISC::GET_MODEL_DIMENSIONS(hash, &min, &max);
-		const auto dimensions = (max - min) * 0.5f;
+		const auto hash = m_pointer->m_model_info->m_hash;
+		auto half_extents_it = m_model_half_extents.find(hash);
+		if (half_extents_it == m_model_half_extents.end())
+		{
+			Vector3 min, max;
+			MISC::GET_MODEL_DIMENSIONS(hash, &min, &max);
+			half_extents_it = m_model_half_extents.emplace(hash, (max - min) * 0.5f).first;
+		}
+		const auto dimensions = half_extents_it->second;
 
-		// sanity check
-		if (!m_pointer || !m_pointer->m_navigation)
-			return;
 		// make copy just in case
 		const auto position = *m_pointer->m_navigation->get_position();
 
-		rage::fvector3 front_upper_right, back_lower_left;
-		front_upper_right.x = position.x + dimensions.y * forward.x + dimensions.x * right.x + dimensions.z * up.x;
-		front_upper_right.y = position.y + dimensions.y * forward.y + dimensions.x * right.y + dimensions.z * up.y;
-		front_upper_right.z = position.z + dimensions.y * forward.z + dimensions.x * right.z + dimensions.z * up.z;
-
-		back_lower_left.x = position.x - dimensions.y * forward.x - dimensions.x * right.x - dimensions.z * up.x;
-		back_lower_left.y = position.y - dimensions.y * forward.y - dimensions.x * right.y - dimensions.z * up.y;
-		back_lower_left.z = position.z - dimensions.y * forward.z - dimensions.x * right.z - dimensions.z * up.z;
-
-		rage::fvector3 edge1 = back_lower_left;
-		rage::fvector3 edge2, edge3, edge4;
-
-		rage::fvector3 edge5 = front_upper_right;
-		rage::fvector3 edge6, edge7, edge8;
-
-		edge2.x = edge1.x + 2 * dimensions.y * forward.x;
-		edge2.y = edge1.y + 2 * dimensions.y * forward.y;
-		edge2.z = edge1.z + 2 * dimensions.y * forward.z;
-
-		edge3.x = edge2.x + 2 * dimensions.z * up.x;
-		edge3.y = edge2.y + 2 * dimensions.z * up.y;
-		edge3.z = edge2.z + 2 * dimensions.z * up.z;
-
-		edge4.x = edge1.x + 2 * dimensions.z * up.x;
-		edge4.y = edge1.y + 2 * dimensions.z * up.y;
-		edge4.z = edge1.z + 2 * dimensions.z * up.z;
-
-		edge6.x = edge5.x - 2 * dimensions.y * forward.x;
-		edge6.y = edge5.y - 2 * dimensions.y * forward.y;
-		edge6.z = edge5.z - 2 * dimensions.y * forward.z;
+		const auto along_forward = forward * dimensions.y;
+		const auto along_right   = right * dimensions.x;
+		const auto along_up      = up * dimensions.z;
+
+		// corners in the order of the box edges, back lower left first and front upper right fifth
+		const Vector3 center = {position.x, position.y, position.z};
+		const Vector3 corners[8] = {
+		    center - along_forward - along_right - along_up,
+		    center + along_forward - along_right - along_up,
+		    center + along_forward - along_right + along_up,
+		    center - along_forward - along_right + along_up,
+		    center + along_forward + along_right + along_up,
+		    center - along_forward + along_right + along_up,
+		    center - along_forward + along_right - along_up,
+		    center + along_forward + along_right - along_up,
+		};
 
-		edge7.x = edge6.x - 2 * dimensions.z * up.x;
-		edge7.y = edge6.y - 2 * dimensions.z * up.y;
-		edge7.z = edge6.z - 2 * dimensions.z * up.z;
+		float x[8], y[8], z[8], screen_x[8], screen_y[8];
+		std::uint8_t in_front[8];
+		for (int i = 0; i < 8; i++)
+		{
+			x[i] = corners[i].x;
+			y[i] = corners[i].y;
+			z[i] = corners[i].z;
+		}
 
-		edge8.x = edge5.x - 2 * dimensions.z * up.x;
-		edge8.y = edge5.y - 2 * dimensions.z * up.y;
-		edge8.z = edge5.z - 2 * dimensions.z * up.z;
+		projection::project(m_picker.get_camera(), x, y, z, screen_x, screen_y, in_front, 8);
 
-		auto any_fail                     = false;
-		static auto imgui_world_to_screen = [&any_fail](rage::fvector3& world_input, ImVec2& screen_result) {
-			if (any_fail)
+		auto& box = m_model_bounding_box_screen_space;
+		ImVec2* edges[8] = {&box.edge1, &box.edge2, &box.edge3, &box.edge4, &box.edge5, &box.edge6, &box.edge7, &box.edge8};
+		for (int i = 0; i < 8; i++)
+		{
+			if (!in_front[i])
 			{
+				box = {};
 				return;
 			}
 
-			const auto success = GRAPHICS::GET_SCREEN_COORD_FROM_WORLD_COORD(world_input.x,
-			    world_input.y,
-			    world_input.z,
-			    &screen_result.x,
-			    &screen_result.y);
-			if (success)
-			{
-				screen_result.x = static_cast<float>(*g_pointers->m_gta.m_resolution_x) * screen_result.x;
-				screen_result.y = static_cast<float>(*g_pointers->m_gta.m_resolution_y) * screen_result.y;
-			}
-			else
-			{
-				any_fail = true;
-			}
-		};
-
-		auto& box = m_model_bounding_box_screen_space;
-		imgui_world_to_screen(edge1, box.edge1);
-		imgui_world_to_screen(edge2, box.edge2);
-		imgui_world_to_screen(edge3, box.edge3);
-		imgui_world_to_screen(edge4, box.edge4);
-
-		imgui_world_to_screen(edge5, box.edge5);
-		imgui_world_to_screen(edge6, box.edge6);
-		imgui_world_to_screen(edge7, box.edge7);
-		imgui_world_to_screen(edge8, box.edge8);
-
-		if (any_fail)
-		{
-			box = {};
+			*edges[i] = {static_cast<float>(*g_pointers->m_gta.m_resolution_x) * screen_x[i],
+			    static_cast<float>(*g_pointers->m_gta.m_resolution_y) * screen_y[i]};
 		}
 	}
 
-	double context_menu_service::distance_to_middle_of_screen(const rage::fvector2& screen_pos)
-	{
-		double cum_dist{};
-
-		if (screen_pos.x > 0.5)
-			cum_dist += screen_pos.x - 0.5;
-		else
-			cum_dist += 0.5 - screen_pos.x;
-
-		if (screen_pos.y > 0.5)
-			cum_dist += screen_pos.y - 0.5;
-		else
-			cum_dist += 0.5 - screen_pos.y;
-
-		return cum_dist;
-	}
-
 	s_context_menu* context_menu_service::get_context_menu()
 	{
 		if (m_pointer && m_pointer->m_model_info)
@@ -196,7 +149,10 @@ namespace big
 
 	void context_menu_service::get_entity_closest_to_screen_center()
 	{
-		m_handle = entity::get_entity_closest_to_middle_of_screen(&m_pointer);
+		m_picker.update();
+
+		m_pointer = m_picker.pick(1.f, g_local_player);
+		m_handle  = m_pointer ? g_pointers->m_gta.m_ptr_to_handle(m_pointer) : 0;
 		if (ENTITY::DOES_ENTITY_EXIST(m_handle) && m_pointer)
 			fill_model_bounding_box_screen_space();
 	}
@@ -1,6 +1,7 @@
 #pragma once
 #include "backend/command.hpp"
 #include "backend/player_command.hpp"
+#include "entity_picker.hpp"
 #include "natives.hpp"
 #include "services/gta_data/gta_data_service.hpp"
 #include "services/ped_animations/ped_animations_service.hpp"
@@ -36,7 +37,9 @@ namespace big
 	{
 	private:
 		void fill_model_bounding_box_screen_space();
-		static double distance_to_middle_of_screen(const rage::fvector2& screen_pos);
+
+		entity_picker m_picker;
+		std::unordered_map<Hash, Vector3> m_model_half_extents;
 
 	public:
 		context_menu_service();
@@ -0,0 +1,76 @@
+#include "entity_picker.hpp"
+
+#include "natives.hpp"
+#include "pointers.hpp"
+#include "services/pool_snapshot/pool_snapshot_service.hpp"
+
+#include <entities/CDynamicEntity.hpp>
+
+namespace big
+{
+	void entity_picker::add_snapshot(const pool_snapshot& snapshot)
+	{
+		for (const auto& entity : snapshot.entities())
+		{
+			m_pointers.push_back(entity.m_pointer);
+			m_x.push_back(entity.m_position.x);
+			m_y.push_back(entity.m_position.y);
+			m_z.push_back(entity.m_position.z);
+		}
+	}
+
+	void entity_picker::update()
+	{
+		const auto cam_pos = CAM::GET_FINAL_RENDERED_CAM_COORD();
+		const auto cam_rot = CAM::GET_FINAL_RENDERED_CAM_ROT(2);
+		const auto cam_fov = CAM::GET_FINAL_RENDERED_CAM_FOV();
+		const auto aspect  = GRAPHICS::GET_ASPECT_RATIO(false);
+
+		m_camera = projection::camera::from_rotation({cam_pos.x, cam_pos.y, cam_pos.z}, {cam_rot.x, cam_rot.y, cam_rot.z}, cam_fov, aspect);
+
+		m_pointers.clear();
+		m_x.clear();
+		m_y.clear();
+		m_z.clear();
+
+		add_snapshot(g_pool_snapshot_service.vehicles());
+		add_snapshot(g_pool_snapshot_service.peds());
+		add_snapshot(g_pool_snapshot_service.props());
+
+		const auto count = m_pointers.size();
+		m_screen_x.resize(count);
+		m_screen_y.resize(count);
+		m_in_front.resize(count);
+
+		projection::project(m_camera, m_x.data(), m_y.data(), m_z.data(), m_screen_x.data(), m_screen_y.data(), m_in_front.data(), count);
+	}
+
+	rage::fwEntity* entity_picker::pick(float max_distance, rage::fwEntity* ignore)
+	{
+		m_candidates.clear();
+
+		for (std::uint32_t i = 0; i < m_pointers.size(); i++)
+		{
+			if (!m_in_front[i] || m_pointers[i] == ignore)
+				continue;
+
+			const float distance = std::abs(m_screen_x[i] - 0.5f) + std::abs(m_screen_y[i] - 0.5f);
+			if (distance < max_distance)
+				m_candidates.push_back({distance, i});
+		}
+
+		const auto checks = std::min(max_los_checks, m_candidates.size());
+		std::partial_sort(m_candidates.begin(), m_candidates.begin() + checks, m_candidates.end(), [](const candidate& a, const candidate& b) {
+			return a.m_distance < b.m_distance;
+		});
+
+		for (std::size_t i = 0; i < checks; i++)
+		{
+			const auto pointer = m_pointers[m_candidates[i].m_index];
+			if (ENTITY::HAS_ENTITY_CLEAR_LOS_TO_ENTITY(self::ped, g_pointers->m_gta.m_ptr_to_handle(pointer), 17))
+				return pointer;
+		}
+
+		return nullptr;
+	}
+}
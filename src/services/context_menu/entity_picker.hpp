@@ -0,0 +1,50 @@
+#pragma once
+#include "util/projection.hpp"
+
+namespace rage
+{
+	class fwEntity;
+}
+
+namespace big
+{
+	class pool_snapshot;
+
+	// Picks the entity closest to the middle of the screen. The positions of this frame's pool snapshot
+	// are projected in one batched pass with the rendered camera, so no native is called per entity.
+	// Line of sight is only checked for the best few candidates.
+	class entity_picker
+	{
+	public:
+		// amount of candidates that get a line of sight check before giving up on this frame
+		static constexpr std::size_t max_los_checks = 8;
+
+		void update();
+
+		// max_distance is the sum of the horizontal and vertical distance from the middle of the screen
+		rage::fwEntity* pick(float max_distance, rage::fwEntity* ignore = nullptr);
+
+		const projection::camera& get_camera() const
+		{
+			return m_camera;
+		}
+
+	private:
+		void add_snapshot(const pool_snapshot& snapshot);
+
+		struct candidate
+		{
+			float m_distance;
+			std::uint32_t m_index;
+		};
+
+		projection::camera m_camera{};
+
+		// reused between frames, they only grow
+		std::vector<rage::fwEntity*> m_pointers;
+		std::vector<float> m_x, m_y, m_z;
+		std::vector<float> m_screen_x, m_screen_y;
+		std::vector<std::uint8_t> m_in_front;
+		std::vector<candidate> m_candidates;
+	};
+}
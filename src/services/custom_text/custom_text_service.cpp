@@ -1,11 +1,14 @@
 #include "custom_text_service.hpp"
 
 #include "custom_text_callbacks.hpp"
+#include "memory/module.hpp"
 
 namespace big
 {
 	custom_text_service::custom_text_service()
 	{
+		cache_read_only_ranges();
+
 		add_callback_for_labels({"RESPAWN_W"_J, "RESPAWN_W_MP"_J}, respawn_label_callback);
 		add_callback_for_labels({"FMMC_KEY_TIP15"_J, "FMMC_MCK_TIP15"_J}, do_ceo_name_resize);
 		add_label_overwrite("GC_OTR_TMR"_J, "HIDING FROM CLOWNS");
@@ -21,7 +24,9 @@ namespace big
 
 	bool custom_text_service::add_callback_for_label(rage::joaat_t hash, custom_label_callback&& cb)
 	{
-		return m_callbacks.insert({hash, cb}).second;
+		const auto inserted = m_callbacks.insert({hash, cb}).second;
+		m_filter.rebuild(m_callbacks, m_label_overwrites);
+		return inserted;
 	}
 
 	bool custom_text_service::add_callback_for_labels(std::initializer_list<rage::joaat_t> hashes, custom_label_callback&& cb)
@@ -29,6 +34,7 @@ namespace big
 		bool result = true;
 		for (const auto& hash : hashes)
 			result = m_callbacks.insert({hash, cb}).second;
+		m_filter.rebuild(m_callbacks, m_label_overwrites);
 		return result;
 	}
 
@@ -38,16 +44,48 @@ namespace big
 		auto buffer     = std::make_unique<char[]>(size);
 		memcpy(buffer.get(), overwrite.data(), size);
 
-		return m_label_overwrites.insert({hash, std::move(buffer)}).second;
+		const auto inserted = m_label_overwrites.insert({hash, std::move(buffer)}).second;
+		m_filter.rebuild(m_callbacks, m_label_overwrites);
+		return inserted;
 	}
 
 	const char* custom_text_service::get_text(const char* label) const
 	{
+		const auto tag = m_filter.tag(label);
+		if (m_filter.is_memoized_miss(label, tag))
+			return nullptr;
+
 		const auto hash = rage::joaat(label);
-		if (const auto& it = m_callbacks.find(hash); it != m_callbacks.end())
-			return it->second(label);
-		if (const auto& it = m_label_overwrites.find(hash); it != m_label_overwrites.end())
-			return it->second.get();
+		if (m_filter.may_be_customized(hash))
+		{
+			if (const auto& it = m_callbacks.find(hash); it != m_callbacks.end())
+				return it->second(label);
+			if (const auto& it = m_label_overwrites.find(hash); it != m_label_overwrites.end())
+				return it->second.get();
+		}
+
+		m_filter.memoize_miss(label, tag);
 		return nullptr;
 	}
+
+	void custom_text_service::cache_read_only_ranges()
+	{
+		const auto module = memory::module("GTA5.exe");
+		if (!module.loaded())
+			return;
+
+		const auto base = module.begin().as<std::uintptr_t>();
+		const auto dos  = reinterpret_cast<const IMAGE_DOS_HEADER*>(base);
+		const auto nt   = reinterpret_cast<const IMAGE_NT_HEADERS*>(base + dos->e_lfanew);
+
+		auto section = IMAGE_FIRST_SECTION(nt);
+		for (WORD i = 0; i < nt->FileHeader.NumberOfSections; i++, section++)
+		{
+			if (section->Characteristics & IMAGE_SCN_MEM_WRITE)
+				continue;
+
+			const auto begin = base + section->VirtualAddress;
+			m_filter.add_read_only_range(begin, begin + section->Misc.VirtualSize);
+		}
+	}
 }
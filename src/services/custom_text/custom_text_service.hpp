@@ -1,5 +1,6 @@
 #pragma once
 #include "gta/joaat.hpp"
+#include "label_filter.hpp"
 
 namespace big
 {
@@ -9,6 +10,10 @@ namespace big
 		std::map<rage::joaat_t, custom_label_callback> m_callbacks;
 		std::map<rage::joaat_t, std::unique_ptr<char[]>> m_label_overwrites;
 
+		label_filter m_filter;
+
+		void cache_read_only_ranges();
+
 	public:
 		custom_text_service();
 		~custom_text_service();
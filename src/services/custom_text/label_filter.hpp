@@ -0,0 +1,93 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace big
+{
+	// The part of custom_text_service that lets get_text skip labels that aren't customized, without knowing the game.
+	class label_filter final
+	{
+		// One bit per (hash % filter_bits), set for every hash that has a callback or an overwrite.
+		// A clear bit means the label is definitely not customized and the maps don't need to be probed.
+		static constexpr std::size_t filter_bits = 4096;
+		// Direct mapped cache of label pointers into read-only memory that are known to not be customized.
+		// Entries are tagged with the filter generation they were stored under, user mode pointers leave the top 16 bits free.
+		static constexpr std::size_t miss_memo_size = 256;
+		static constexpr int generation_shift       = 48;
+
+		std::array<std::uint64_t, filter_bits / 64> m_filter{};
+		mutable std::array<std::atomic<std::uintptr_t>, miss_memo_size> m_miss_memo{};
+		std::atomic<std::uint16_t> m_generation{};
+		std::vector<std::pair<std::uintptr_t, std::uintptr_t>> m_read_only_ranges;
+
+		std::atomic<std::uintptr_t>& memo_for(const char* label) const
+		{
+			return m_miss_memo[(reinterpret_cast<std::uintptr_t>(label) >> 3) % miss_memo_size];
+		}
+
+	public:
+		// the pointer and the current generation, read once before the lookup
+		[[nodiscard]] std::uintptr_t tag(const char* label) const
+		{
+			return reinterpret_cast<std::uintptr_t>(label)
+			    | static_cast<std::uintptr_t>(m_generation.load(std::memory_order_acquire)) << generation_shift;
+		}
+
+		// only read-only labels are ever stored, so a hit doesn't need the section check
+		[[nodiscard]] bool is_memoized_miss(const char* label, std::uintptr_t tag) const
+		{
+			return memo_for(label).load(std::memory_order_relaxed) == tag;
+		}
+
+		// tagged with the generation read before the lookup, a rebuild in between makes the entry stale instead of wrong
+		void memoize_miss(const char* label, std::uintptr_t tag) const
+		{
+			if (is_read_only(label))
+				memo_for(label).store(tag, std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] bool may_be_customized(std::uint32_t hash) const
+		{
+			return m_filter[(hash % filter_bits) / 64] & (1ull << (hash % 64));
+		}
+
+		template<typename... Maps>
+		void rebuild(const Maps&... maps)
+		{
+			m_filter.fill(0);
+			const auto set = [this](std::uint32_t hash) {
+				m_filter[(hash % filter_bits) / 64] |= 1ull << (hash % 64);
+			};
+			(
+			    [&] {
+				    for (const auto& [hash, _] : maps)
+					    set(hash);
+			    }(),
+			    ...);
+
+			// a memoized miss might have just become a hit, entries of older generations no longer match
+			if (m_generation.fetch_add(1, std::memory_order_release) == std::numeric_limits<std::uint16_t>::max())
+				for (auto& memo : m_miss_memo)
+					memo.store(0, std::memory_order_relaxed);
+		}
+
+		// writable memory can have its strings changed under our feet, only constant data is memoized
+		void add_read_only_range(std::uintptr_t begin, std::uintptr_t end)
+		{
+			m_read_only_ranges.emplace_back(begin, end);
+		}
+
+		[[nodiscard]] bool is_read_only(const char* label) const
+		{
+			const auto addr = reinterpret_cast<std::uintptr_t>(label);
+			for (const auto& [begin, end] : m_read_only_ranges)
+				if (addr >= begin && addr < end)
+					return true;
+			return false;
+		}
+	};
+}
@@ -1,5 +1,7 @@
 #include "cache_file.hpp"
 
+#include <fstream>
+
 namespace big
 {
 	cache_file::cache_file(file cache_file) :
@@ -73,6 +75,11 @@ namespace big
 		return m_cache_version == m_cache_header.m_cache_version && file_version == m_cache_header.m_file_version;
 	}
 
+	bool cache_file::cache_version_matches() const
+	{
+		return m_data && m_cache_version == m_cache_header.m_cache_version;
+	}
+
 	void cache_file::set_data(cache_data&& data, uint64_t data_size)
 	{
 		m_data.swap(data);
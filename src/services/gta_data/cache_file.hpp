@@ -1,6 +1,9 @@
 #pragma once
 #include "file_manager/file.hpp"
 
+#include <cstdint>
+#include <memory>
+
 namespace big
 {
 	class cache_header final
@@ -57,6 +60,12 @@ namespace big
 		/// <returns>True if cache is up to date, false otherwise.</returns>
 		bool up_to_date(uint32_t file_version) const;
 
+		/// <summary>
+		/// Check if the cached data has the expected internal structure, regardless of the file version it was written for
+		/// </summary>
+		/// <returns>True if the data can be parsed, false otherwise.</returns>
+		bool cache_version_matches() const;
+
 
 		void set_data(cache_data&& data, uint64_t data_size);
 		/// <summary>
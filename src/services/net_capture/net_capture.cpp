@@ -0,0 +1,204 @@
+#include "net_capture.hpp"
+
+namespace big
+{
+	static constexpr char capture_magic[4] = {'Y', 'N', 'C', 'P'};
+
+	net_capture::net_capture()
+	{
+		for (std::size_t i = 0; i < capacity; i++)
+			m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+	}
+
+	net_capture::~net_capture()
+	{
+		stop();
+	}
+
+	bool net_capture::start(const std::filesystem::path& path)
+	{
+		stop();
+
+		std::lock_guard lock(m_mutex);
+
+		std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			LOG(WARNING) << "Failed to open net capture file " << path;
+			return false;
+		}
+
+		file.write(capture_magic, sizeof(capture_magic));
+		file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+
+		// a hook that was already past is_recording() when the last capture stopped can leave a record behind
+		net_capture_record stale;
+		while (pop(stale))
+			;
+
+		m_started_at.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+		m_record_count.store(0, std::memory_order_relaxed);
+		m_dropped.store(0, std::memory_order_relaxed);
+
+		// has to be set before the writer looks at it
+		m_recording.store(true, std::memory_order_relaxed);
+		m_thread = std::thread(&net_capture::writer, this, std::move(file));
+
+		LOG(INFO) << "Started net capture to " << path;
+		return true;
+	}
+
+	void net_capture::stop()
+	{
+		std::lock_guard lock(m_mutex);
+
+		m_recording.store(false, std::memory_order_relaxed);
+		if (!m_thread.joinable())
+			return;
+
+		m_thread.join();
+		LOG(INFO) << "Stopped net capture after " << m_record_count.load(std::memory_order_relaxed) << " records";
+	}
+
+	void net_capture::record(eNetCaptureSource source, std::uint32_t type, std::uint32_t sender, const void* data, std::uint32_t bit_length)
+	{
+		if (!data)
+			bit_length = 0;
+		bit_length = std::min(bit_length, max_payload_size * 8);
+
+		auto position = m_head.load(std::memory_order_relaxed);
+		slot* target;
+
+		while (true)
+		{
+			target           = &m_slots[position & (capacity - 1)];
+			const auto delta = static_cast<std::intptr_t>(target->m_sequence.load(std::memory_order_acquire))
+			    - static_cast<std::intptr_t>(position);
+
+			if (delta == 0)
+			{
+				if (m_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (delta < 0)
+			{
+				// the writer hasn't gotten to this slot since it was last filled
+				m_dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			else
+			{
+				position = m_head.load(std::memory_order_relaxed);
+			}
+		}
+
+		const auto started_at = std::chrono::steady_clock::time_point(
+		    std::chrono::steady_clock::duration(m_started_at.load(std::memory_order_relaxed)));
+
+		auto& record        = target->m_record;
+		record.m_timestamp  = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started_at).count();
+		record.m_source     = source;
+		record.m_type       = type;
+		record.m_sender     = sender;
+		record.m_bit_length = bit_length;
+		record.m_payload.assign(static_cast<const std::uint8_t*>(data), static_cast<const std::uint8_t*>(data) + (bit_length + 7) / 8);
+
+		target->m_sequence.store(position + 1, std::memory_order_release);
+	}
+
+	bool net_capture::pop(net_capture_record& record)
+	{
+		auto& source = m_slots[m_tail & (capacity - 1)];
+		if (source.m_sequence.load(std::memory_order_acquire) != m_tail + 1)
+			return false;
+
+		// swap rather than copy so both vectors keep their capacity
+		std::swap(record, source.m_record);
+		source.m_sequence.store(m_tail + capacity, std::memory_order_release);
+		m_tail++;
+
+		return true;
+	}
+
+	void net_capture::writer(std::ofstream file)
+	{
+		const auto write = [&file](const auto& value) {
+			file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+		};
+
+		const std::uint8_t padding[3]{};
+		net_capture_record record{};
+
+		// drain whatever is left once stopped
+		for (bool running = true; running;)
+		{
+			running = m_recording.load(std::memory_order_relaxed);
+
+			bool wrote = false;
+			while (pop(record))
+			{
+				write(record.m_timestamp);
+				write(static_cast<std::uint8_t>(record.m_source));
+				file.write(reinterpret_cast<const char*>(padding), sizeof(padding));
+				write(record.m_type);
+				write(record.m_sender);
+				write(record.m_bit_length);
+				file.write(reinterpret_cast<const char*>(record.m_payload.data()), record.m_payload.size());
+
+				m_record_count.fetch_add(1, std::memory_order_relaxed);
+				wrote = true;
+			}
+
+			if (wrote)
+				file.flush();
+			else if (running)
+				std::this_thread::sleep_for(50ms);
+		}
+	}
+
+	net_capture_reader::net_capture_reader(const std::filesystem::path& path) :
+	    m_file(path, std::ios::in | std::ios::binary)
+	{
+		char magic[4]{};
+		std::uint32_t file_version{};
+
+		m_file.read(magic, sizeof(magic));
+		m_file.read(reinterpret_cast<char*>(&file_version), sizeof(file_version));
+
+		m_valid = m_file.good() && std::equal(std::begin(magic), std::end(magic), std::begin(capture_magic))
+		    && file_version == net_capture::version;
+	}
+
+	bool net_capture_reader::next(net_capture_record& record)
+	{
+		if (!m_valid)
+			return false;
+
+		const auto read = [this](auto& value) {
+			m_file.read(reinterpret_cast<char*>(&value), sizeof(value));
+		};
+
+		std::uint8_t source{};
+		std::uint8_t padding[3]{};
+
+		read(record.m_timestamp);
+		read(source);
+		m_file.read(reinterpret_cast<char*>(padding), sizeof(padding));
+		read(record.m_type);
+		read(record.m_sender);
+		read(record.m_bit_length);
+
+		if (!m_file || source >= static_cast<std::uint8_t>(eNetCaptureSource::COUNT)
+		    || record.m_bit_length > net_capture::max_payload_size * 8)
+			return m_valid = false;
+
+		record.m_source = static_cast<eNetCaptureSource>(source);
+		record.m_payload.resize((record.m_bit_length + 7) / 8);
+		m_file.read(reinterpret_cast<char*>(record.m_payload.data()), record.m_payload.size());
+
+		if (!m_file)
+			return m_valid = false;
+
+		return true;
+	}
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+namespace big
+{
+	enum class eNetCaptureSource : std::uint8_t
+	{
+		NET_MESSAGE,
+		CLONE_SYNC,
+		SCRIPT_EVENT,
+		COUNT
+	};
+
+	inline const char* net_capture_source_name(eNetCaptureSource source)
+	{
+		switch (source)
+		{
+		case eNetCaptureSource::NET_MESSAGE: return "NET_MESSAGE";
+		case eNetCaptureSource::CLONE_SYNC: return "CLONE_SYNC";
+		case eNetCaptureSource::SCRIPT_EVENT: return "SCRIPT_EVENT";
+		default: return "UNKNOWN";
+		}
+	}
+
+	struct net_capture_record
+	{
+		// type of a message whose header couldn't be parsed
+		static constexpr std::uint32_t unknown_type = ~0u;
+
+		// nanoseconds since the capture was started
+		std::uint64_t m_timestamp;
+		eNetCaptureSource m_source;
+		// message type, object type or script event hash depending on the source
+		std::uint32_t m_type;
+		// connection identifier for net messages, player id otherwise
+		std::uint32_t m_sender;
+		std::uint32_t m_bit_length;
+		std::vector<std::uint8_t> m_payload;
+	};
+
+	// Opt-in capture of the raw payloads the protection hooks get to see, so that a session can be replayed later.
+	// The hooks copy records into a preallocated ring and a writer thread appends them to the file, same as the packet log.
+	// layout: "YNCP", u32 version
+	// then per record: u64 timestamp, u8 source, u8 padding[3], u32 type, u32 sender, u32 bit length, payload bytes
+	class net_capture final
+	{
+	public:
+		static constexpr std::uint32_t version = 1;
+		// anything larger than this is not a valid payload and is truncated
+		static constexpr std::uint32_t max_payload_size = 0x4000;
+		// must be a power of two
+		static constexpr std::size_t capacity = 1024;
+
+		net_capture();
+		~net_capture();
+
+		bool start(const std::filesystem::path& path);
+		void stop();
+
+		[[nodiscard]] inline bool is_recording() const
+		{
+			return m_recording.load(std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] std::uint64_t record_count() const
+		{
+			return m_record_count.load(std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] std::uint64_t dropped_count() const
+		{
+			return m_dropped.load(std::memory_order_relaxed);
+		}
+
+		// called from the hooks, does nothing unless a capture is running and never blocks, the record is dropped if the ring is full
+		void record(eNetCaptureSource source, std::uint32_t type, std::uint32_t sender, const void* data, std::uint32_t bit_length);
+
+	private:
+		struct slot
+		{
+			std::atomic<std::size_t> m_sequence;
+			net_capture_record m_record;
+		};
+
+		bool pop(net_capture_record& record);
+		void writer(std::ofstream file);
+
+		// the payload vectors keep their capacity between laps, so the hooks only allocate until the ring is warmed up
+		std::array<slot, capacity> m_slots;
+		alignas(64) std::atomic<std::size_t> m_head{};
+		// only touched by the writer, or by start() while there is none
+		alignas(64) std::size_t m_tail = 0;
+
+		std::atomic_bool m_recording{false};
+		std::atomic<std::uint64_t> m_record_count{};
+		std::atomic<std::uint64_t> m_dropped{};
+		// steady_clock ticks, read by the hooks to timestamp records
+		std::atomic<std::chrono::steady_clock::rep> m_started_at{};
+
+		// serializes start() and stop()
+		std::mutex m_mutex;
+		std::thread m_thread;
+	};
+
+	inline net_capture g_net_capture{};
+
+	class net_capture_reader final
+	{
+	public:
+		explicit net_capture_reader(const std::filesystem::path& path);
+
+		[[nodiscard]] bool is_valid() const
+		{
+			return m_valid;
+		}
+
+		// false once the end of the file or a truncated record is reached
+		bool next(net_capture_record& record);
+
+	private:
+		std::ifstream m_file;
+		bool m_valid = false;
+	};
+}
@@ -0,0 +1,119 @@
+#include "net_capture_replay.hpp"
+
+#include "gta/enums.hpp"
+#include "services/telemetry/telemetry_service.hpp"
+#include "util/net_message.hpp"
+#include "util/protection.hpp"
+
+namespace big
+{
+	std::string net_capture_replay::decide(net_capture_record& record)
+	{
+		switch (record.m_source)
+		{
+		case eNetCaptureSource::NET_MESSAGE:
+		{
+			if (record.m_payload.empty())
+				return "empty";
+
+			rage::datBitBuffer buffer(record.m_payload.data(), static_cast<uint32_t>(record.m_payload.size()));
+			rage::eNetMessage msgType;
+
+			if (!read_net_message_header(buffer, record.m_payload.data(), static_cast<uint32_t>(record.m_payload.size()), msgType))
+				return "malformed header";
+
+			if (record.m_type != net_capture_record::unknown_type && static_cast<std::uint32_t>(msgType) != record.m_type)
+				return "type mismatch";
+
+			if (auto reason = get_net_message_block_reason(msgType, buffer))
+				return std::format("blocked ({})", reason);
+
+			return "parsed";
+		}
+		case eNetCaptureSource::CLONE_SYNC:
+		{
+			if (!is_valid_sync_object_type(static_cast<eNetObjType>(record.m_type)))
+				return "blocked (out of bounds object type)";
+
+			return "parsed";
+		}
+		case eNetCaptureSource::SCRIPT_EVENT:
+		{
+			if (record.m_payload.size() < sizeof(std::int64_t) || record.m_payload.size() % sizeof(std::int64_t) != 0)
+				return "malformed args";
+
+			// the hook reads past the sent arguments into the rest of the event, which is zeroed here
+			decltype(CScriptedGameEvent::m_args) args{};
+			std::memcpy(args, record.m_payload.data(), std::min(record.m_payload.size(), sizeof(args)));
+
+			if (const auto verdict = protection::check_script_event_args(args); verdict.m_reason)
+				return std::format("blocked ({})", verdict.m_reason);
+
+			if (protection::is_script_event_sender_mismatch(args, static_cast<int>(record.m_sender)))
+				return "blocked (sender mismatch)";
+
+			return "parsed";
+		}
+		default: return "unknown source";
+		}
+	}
+
+	std::optional<std::vector<net_replay_result>> net_capture_replay::run(const std::filesystem::path& path)
+	{
+		net_capture_reader reader(path);
+		if (!reader.is_valid())
+		{
+			LOG(WARNING) << "Not a valid net capture: " << path;
+			return std::nullopt;
+		}
+
+		std::map<std::pair<eNetCaptureSource, std::uint32_t>, net_replay_result> results;
+		std::map<std::pair<eNetCaptureSource, std::uint32_t>, std::uint32_t> probes;
+
+		net_capture_record record{};
+		std::uint64_t total = 0;
+		while (reader.next(record))
+		{
+			const auto key = std::make_pair(record.m_source, record.m_type);
+
+			auto probe = probes.find(key);
+			if (probe == probes.end())
+				probe = probes.emplace(key, g_telemetry_service.register_probe(std::format("replay/{}/{}", net_capture_source_name(record.m_source), record.m_type))).first;
+
+			const auto start    = std::chrono::steady_clock::now();
+			const auto decision = decide(record);
+			g_telemetry_service.record(probe->second,
+			    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+			auto& result    = results[key];
+			result.m_source = record.m_source;
+			result.m_type   = record.m_type;
+			result.m_count++;
+			result.m_decisions[decision]++;
+			total++;
+		}
+
+		LOG(INFO) << "Replayed " << total << " net capture records of " << results.size() << " types";
+
+		std::vector<net_replay_result> list;
+		list.reserve(results.size());
+		for (auto& [key, result] : results)
+			list.push_back(std::move(result));
+
+		return list;
+	}
+
+	bool net_capture_replay::export_csv(const std::vector<net_replay_result>& results, const std::filesystem::path& path)
+	{
+		std::ofstream file(path, std::ios::out | std::ios::trunc);
+		if (!file.is_open())
+			return false;
+
+		file << "source,type,decision,count\n";
+		for (const auto& result : results)
+			for (const auto& [decision, count] : result.m_decisions)
+				file << std::format("{},{},\"{}\",{}\n", net_capture_source_name(result.m_source), result.m_type, decision, count);
+
+		return true;
+	}
+}
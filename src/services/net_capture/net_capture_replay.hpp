@@ -0,0 +1,29 @@
+#pragma once
+#include "net_capture.hpp"
+
+#include <map>
+
+namespace big
+{
+	struct net_replay_result
+	{
+		eNetCaptureSource m_source;
+		std::uint32_t m_type;
+		std::uint64_t m_count;
+		// decision name -> number of records that ended up with it
+		std::map<std::string, std::uint64_t> m_decisions;
+	};
+
+	// Feeds a capture back through the payload checks the protection hooks share with it (util/net_message.hpp and
+	// util/protection.hpp). Latencies go into the telemetry service as "replay/<source>/<type>" probes, decisions are
+	// returned per type. Decisions that depend on session state (host checks, player flags, rate limits) aren't reproduced.
+	class net_capture_replay final
+	{
+	public:
+		[[nodiscard]] static std::optional<std::vector<net_replay_result>> run(const std::filesystem::path& path);
+		static bool export_csv(const std::vector<net_replay_result>& results, const std::filesystem::path& path);
+
+	private:
+		static std::string decide(net_capture_record& record);
+	};
+}
@@ -4,6 +4,12 @@
 
 namespace big
 {
+	notification_service::notification_service()
+	{
+		m_pending.reserve(max_pending);
+		m_incoming.reserve(max_pending);
+	}
+
 	bool notification_service::initialise()
 	{
 		push("NOTIFICATION_WELCOME_TITLE"_T.data(),
@@ -32,36 +38,99 @@ namespace big
 		push({title, message, NotificationType::SUCCESS, 7s});
 	}
 
-	std::vector<notification> notification_service::get()
+	std::span<const notification> notification_service::get()
 	{
-		// remove old notifications
-		for (auto it = m_notifications.begin(); it != m_notifications.end();)
 		{
-			if (it->second.should_be_destroyed())
-			{
-				it = m_notifications.erase(it++);
+			std::lock_guard lock(m_pending_mutex);
+			std::swap(m_pending, m_incoming);
+		}
 
+		const auto now = std::chrono::steady_clock::now();
+		for (auto& notification : m_incoming)
+		{
+			if (coalesce(notification) || is_rate_limited(notification, now))
 				continue;
-			}
-			++it;
+
+			insert(notification);
 		}
+		m_incoming.clear();
 
-		// grab only the notifications, no need for the keys
-		auto sorted = m_notifications | std::views::values | std::ranges::to<std::vector<notification>>();
-		std::sort(sorted.begin(), sorted.end(), [](auto const& a, auto const& b) {
-			// inverse sorting, highest remaining time goes to top
-			return a.destroy_time() > b.destroy_time();
-		});
-		return sorted;
+		while (m_size && m_notifications[m_size - 1].should_be_destroyed())
+			m_notifications[--m_size] = {};
+
+		return {m_notifications.data(), m_size};
 	}
 
 	void notification_service::push(notification n)
 	{
-		const auto [pair, inserted] = m_notifications.insert({n.identifier(), n});
-		if (!inserted)
+		std::lock_guard lock(m_pending_mutex);
+		if (m_pending.size() < max_pending)
+			m_pending.push_back(std::move(n));
+	}
+
+	void notification_service::insert(notification& n)
+	{
+		const auto begin = m_notifications.begin();
+		const auto pos   = std::upper_bound(begin, begin + m_size, n, [](const notification& a, const notification& b) {
+			return a.destroy_time() > b.destroy_time();
+		});
+
+		if (m_size == max_notifications)
 		{
-			pair->second.reset();
+			// full, the one closest to expiring makes room unless that is the new one
+			if (pos == begin + m_size)
+				return;
+			m_size--;
 		}
+
+		std::move_backward(pos, begin + m_size, begin + m_size + 1);
+		*pos = std::move(n);
+		m_size++;
+	}
+
+	bool notification_service::coalesce(const notification& n)
+	{
+		const auto begin = m_notifications.begin();
+		const auto it    = std::find_if(begin, begin + m_size, [&n](const notification& existing) {
+			return existing.identifier() == n.identifier();
+		});
+		if (it == begin + m_size)
+			return false;
+
+		it->reset();
+
+		// its destroy time only moved forward, rotate it towards the front to keep the order
+		const auto pos = std::upper_bound(begin, it, *it, [](const notification& a, const notification& b) {
+			return a.destroy_time() > b.destroy_time();
+		});
+		std::rotate(pos, it, it + 1);
+
+		return true;
 	}
 
+	bool notification_service::is_rate_limited(const notification& n, std::chrono::steady_clock::time_point now)
+	{
+		const auto source = std::hash<std::string>{}(n.title());
+
+		auto rate = std::find_if(m_source_rates.begin(), m_source_rates.end(), [source](const source_rate& entry) {
+			return entry.m_source == source;
+		});
+		if (rate == m_source_rates.end())
+		{
+			// unused entries have the oldest window start of all
+			rate = std::min_element(m_source_rates.begin(), m_source_rates.end(), [](const source_rate& a, const source_rate& b) {
+				return a.m_window_start < b.m_window_start;
+			});
+			rate->m_source       = source;
+			rate->m_window_start = {};
+		}
+
+		if (now - rate->m_window_start > source_rate_window)
+		{
+			rate->m_window_start = now;
+			rate->m_count        = 0;
+		}
+
+		return ++rate->m_count > source_rate_limit;
+	}
 }
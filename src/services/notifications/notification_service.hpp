@@ -1,15 +1,24 @@
 #pragma once
 #include "notification.hpp"
 
+#include <span>
+
 namespace big
 {
 
 	class notification_service final
 	{
-		std::unordered_map<std::size_t, notification> m_notifications;
-
 	public:
-		notification_service() = default;
+		static constexpr std::size_t max_notifications = 32;
+		// pushes beyond this between two frames are dropped
+		static constexpr std::size_t max_pending = 256;
+		// new notifications a single source (title) can show per window, repeats of a visible one are always coalesced
+		static constexpr std::uint32_t source_rate_limit = 4;
+		static constexpr std::chrono::seconds source_rate_window{1};
+		// sources tracked at once, the one whose window started first makes room for a new one
+		static constexpr std::size_t max_sources = 32;
+
+		notification_service();
 		virtual ~notification_service() = default;
 
 		bool initialise();
@@ -19,12 +28,34 @@ namespace big
 		void push_error(const std::string& title, const std::string& message);
 		void push_success(const std::string& title, const std::string& message);
 
-		// cleans up old notifications from the map and returns a sorted list based on the destroy time
-		std::vector<notification> get();
+		// takes in the notifications pushed since the last frame, drops the expired ones and returns the rest,
+		// highest remaining time first. Only call this from the render thread, the span is valid until the next call.
+		std::span<const notification> get();
 
 	private:
+		struct source_rate
+		{
+			std::size_t m_source;
+			std::chrono::steady_clock::time_point m_window_start;
+			std::uint32_t m_count;
+		};
+
 		void push(notification notification);
 
+		void insert(notification& notification);
+		bool coalesce(const notification& notification);
+		bool is_rate_limited(const notification& notification, std::chrono::steady_clock::time_point now);
+
+		std::mutex m_pending_mutex;
+		std::vector<notification> m_pending;
+		// swapped with m_pending every frame so neither of them reallocates
+		std::vector<notification> m_incoming;
+
+		// sorted by destroy time, descending, so expired notifications are popped from the back
+		std::array<notification, max_notifications> m_notifications;
+		std::size_t m_size = 0;
+
+		std::array<source_rate, max_sources> m_source_rates{};
 	};
 
 	inline notification_service g_notification_service{};
@@ -0,0 +1,202 @@
+#include "packet_log.hpp"
+
+#include "core/data/packet_types.hpp"
+#include "file_manager.hpp"
+
+namespace big
+{
+	static const char* get_packet_type_name(rage::eNetMessage type)
+	{
+		for (const auto& p : packet_types)
+			if (p.second == (int)type)
+				return p.first;
+
+		return "<UNKNOWN>";
+	}
+
+	static std::string format_entry(const packet_log_entry& entry)
+	{
+		auto ms         = std::chrono::duration_cast<std::chrono::milliseconds>(entry.m_time.time_since_epoch()) % 1000;
+		auto timer      = std::chrono::system_clock::to_time_t(entry.m_time);
+		auto local_time = *std::localtime(&timer);
+
+		char time[32];
+		std::strftime(time, sizeof(time), "%m/%d/%Y %I:%M:%S", &local_time);
+
+		return std::format("[{}:{:03} {}] PKT | {} (0x{:X}) [size=0x{:X}, cxnId={:X}, peerId={}, msgId={}] {} {} ({})\n",
+		    time,
+		    ms.count(),
+		    local_time.tm_hour < 12 ? "AM" : "PM",
+		    get_packet_type_name(entry.m_type),
+		    (int)entry.m_type,
+		    entry.m_size,
+		    entry.m_connection_id,
+		    entry.m_peer_id,
+		    entry.m_msg_id,
+		    entry.m_direction == ePacketDirection::INCOMING ? "from" : "to",
+		    entry.m_name[0] ? entry.m_name : "???",
+		    entry.m_rockstar_id);
+	}
+
+	packet_log::packet_log()
+	{
+		for (std::size_t i = 0; i < capacity; i++)
+			m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+	}
+
+	packet_log::~packet_log()
+	{
+		stop();
+	}
+
+	void packet_log::start()
+	{
+		{
+			std::lock_guard lock(m_thread_mutex);
+			m_started = true;
+		}
+
+		update_filter();
+	}
+
+	void packet_log::stop()
+	{
+		std::lock_guard lock(m_thread_mutex);
+		m_started = false;
+		m_running = false;
+
+		if (m_thread.joinable())
+			m_thread.join();
+	}
+
+	void packet_log::start_writer()
+	{
+		std::lock_guard lock(m_thread_mutex);
+		if (!m_started || m_thread.joinable())
+			return;
+
+		m_running = true;
+		m_thread  = std::thread(&packet_log::writer, this);
+	}
+
+	void packet_log::update_filter()
+	{
+		const auto& logs = g.debug.logs;
+
+		std::array<std::uint64_t, filtered_types / 64> types{};
+		if (logs.packet_logs == 1 || logs.packet_logs == 2) // ALL or FILTERED
+			types.fill(~0ull);
+
+		if (logs.packet_logs == 2)
+			for (const auto type : logs.packet_filter.excluded_types)
+				if (type < filtered_types - 1)
+					types[type / 64] &= ~(1ull << (type % 64));
+
+		const bool directions[]{logs.packet_filter.incoming, logs.packet_filter.outgoing};
+		for (std::size_t direction = 0; direction < m_types.size(); direction++)
+			for (std::size_t i = 0; i < types.size(); i++)
+				m_types[direction][i].store(directions[direction] ? types[i] : 0, std::memory_order_relaxed);
+
+		m_players.store(logs.packet_filter.players | (logs.packet_filter.unknown_players ? 1ull << unknown_player_bit : 0),
+		    std::memory_order_relaxed);
+
+		// keeps running once started, turning logging off only empties the masks
+		if (logs.packet_logs != 0)
+			start_writer();
+	}
+
+	void packet_log::push(const packet_log_entry& entry)
+	{
+		auto position = m_head.load(std::memory_order_relaxed);
+		slot* target;
+
+		while (true)
+		{
+			target           = &m_slots[position & (capacity - 1)];
+			const auto delta = static_cast<std::intptr_t>(target->m_sequence.load(std::memory_order_acquire))
+			    - static_cast<std::intptr_t>(position);
+
+			if (delta == 0)
+			{
+				if (m_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (delta < 0)
+			{
+				// the writer hasn't gotten to this slot since it was last filled
+				m_dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			else
+			{
+				position = m_head.load(std::memory_order_relaxed);
+			}
+		}
+
+		target->m_entry = entry;
+		target->m_sequence.store(position + 1, std::memory_order_release);
+	}
+
+	bool packet_log::pop(packet_log_entry& entry)
+	{
+		auto& source = m_slots[m_tail & (capacity - 1)];
+		if (source.m_sequence.load(std::memory_order_acquire) != m_tail + 1)
+			return false;
+
+		entry = source.m_entry;
+		source.m_sequence.store(m_tail + capacity, std::memory_order_release);
+		m_tail++;
+
+		return true;
+	}
+
+	void packet_log::writer()
+	{
+		const auto path     = g_file_manager.get_project_file("./packets.log").get_path();
+		const auto old_path = g_file_manager.get_project_file("./packets.1.log").get_path();
+		std::ofstream file(path, std::ios::app);
+
+		std::error_code ec;
+		auto size = std::filesystem::file_size(path, ec);
+		if (ec)
+			size = 0;
+
+		std::uint64_t reported_dropped = m_dropped.load(std::memory_order_relaxed);
+		packet_log_entry entry;
+
+		// drain whatever is left once stopped, the hooks are gone by then
+		for (bool running = true; running;)
+		{
+			running = m_running.load(std::memory_order_relaxed);
+
+			bool wrote = false;
+			while (pop(entry))
+			{
+				const auto line = format_entry(entry);
+				file << line;
+				size += line.size();
+				wrote = true;
+
+				if (size >= max_file_size)
+				{
+					file.close();
+					std::filesystem::rename(path, old_path, ec);
+					file.open(path, std::ios::out | std::ios::trunc);
+					size = 0;
+				}
+			}
+
+			if (const auto dropped = m_dropped.load(std::memory_order_relaxed); dropped != reported_dropped)
+			{
+				file << std::format("PKT | Dropped {} messages, the log couldn't keep up\n", dropped - reported_dropped);
+				reported_dropped = dropped;
+				wrote            = true;
+			}
+
+			if (wrote)
+				file.flush();
+			else if (running)
+				std::this_thread::sleep_for(50ms);
+		}
+	}
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include "gta/net_game_event.hpp"
+
+namespace big
+{
+	enum class ePacketDirection : std::uint8_t
+	{
+		INCOMING,
+		OUTGOING,
+		COUNT
+	};
+
+	struct packet_log_entry
+	{
+		std::chrono::system_clock::time_point m_time;
+		rage::eNetMessage m_type;
+		ePacketDirection m_direction;
+		std::uint32_t m_size;
+		std::uint32_t m_connection_id;
+		std::uint32_t m_peer_id;
+		std::int32_t m_msg_id;
+		std::uint64_t m_rockstar_id;
+		char m_name[20];
+	};
+
+	// Packet logging that stays off the network thread: the hooks test a few precompiled bit masks and copy a fixed size
+	// entry into a preallocated ring, a writer thread formats the entries and rotates packets.log.
+	// When the writer falls behind entries are dropped and counted instead of making the hook wait.
+	// The writer is only started once logging is turned on, until then nothing runs and packets.log isn't touched.
+	class packet_log final
+	{
+	public:
+		// must be a power of two
+		static constexpr std::size_t capacity = 4096;
+		// packets.log is moved to packets.1.log once it grows past this
+		static constexpr std::uintmax_t max_file_size = 32 * 1024 * 1024;
+		// message types with their own bit in the filter, everything above shares the last one
+		static constexpr std::uint32_t filtered_types = 0x100;
+		// player id bit used for senders that don't have a player yet
+		static constexpr std::uint32_t unknown_player_bit = 32;
+
+		packet_log();
+		~packet_log();
+
+		void start();
+		void stop();
+
+		// recompiles the masks from g.debug.logs and starts the writer if logging got turned on, has to be called after changing them
+		void update_filter();
+
+		[[nodiscard]] inline bool should_log(rage::eNetMessage type, ePacketDirection direction, int player_id) const
+		{
+			const auto player_bit = player_id >= 0 && player_id < 32 ? player_id : unknown_player_bit;
+			if (!(m_players.load(std::memory_order_relaxed) >> player_bit & 1))
+				return false;
+
+			const auto type_bit = std::min(static_cast<std::uint32_t>(type), filtered_types - 1);
+			return m_types[static_cast<std::size_t>(direction)][type_bit / 64].load(std::memory_order_relaxed) >> (type_bit % 64) & 1;
+		}
+
+		// never blocks, the entry is dropped if the ring is full
+		void push(const packet_log_entry& entry);
+
+		[[nodiscard]] std::uint64_t dropped_count() const
+		{
+			return m_dropped.load(std::memory_order_relaxed);
+		}
+
+	private:
+		struct slot
+		{
+			std::atomic<std::size_t> m_sequence;
+			packet_log_entry m_entry;
+		};
+
+		bool pop(packet_log_entry& entry);
+		void start_writer();
+		void writer();
+
+		std::array<slot, capacity> m_slots;
+		alignas(64) std::atomic<std::size_t> m_head{};
+		// only touched by the writer
+		alignas(64) std::size_t m_tail = 0;
+
+		std::array<std::array<std::atomic<std::uint64_t>, filtered_types / 64>, static_cast<std::size_t>(ePacketDirection::COUNT)> m_types{};
+		std::atomic<std::uint64_t> m_players{};
+		std::atomic<std::uint64_t> m_dropped{};
+
+		// guards m_started and m_thread, update_filter() can start the writer from the gui while the service stops
+		std::mutex m_thread_mutex;
+		// between start() and stop(), the writer may only run in that window
+		bool m_started = false;
+		std::atomic_bool m_running{false};
+		std::thread m_thread;
+	};
+
+	inline packet_log g_packet_log{};
+}
@@ -32,62 +32,47 @@ namespace big
 		m_players_sending_modder_beacons.clear();
 		m_selected_player = m_dummy;
 		m_players.clear();
+
+		m_players_by_id.clear();
 	}
 
-	player_ptr player_service::get_by_msg_id(uint32_t msg_id) const
+	const player_ptr& player_service::get_by_msg_id(uint32_t msg_id) const
 	{
-		for (const auto& [_, player] : m_players)
-		{
-			if (auto net_game_player = player->get_net_game_player())
-			{
-				if (net_game_player->m_msg_id == msg_id)
-				{
-					return player;
-				}
-			}
-		}
-		return nullptr;
+		return m_players_by_id.find(m_msg_ids, msg_id, [](const player& plyr) {
+			auto net_game_player = plyr.get_net_game_player();
+			return net_game_player ? net_game_player->m_msg_id : std::numeric_limits<std::uint32_t>::max();
+		});
 	}
 
-	player_ptr player_service::get_by_id(uint32_t id) const
+	const player_ptr& player_service::get_by_id(uint32_t id) const
 	{
-		for (const auto& [_, player] : m_players)
-		{
-			if (player && player->id() == id)
-			{
-				return player;
-			}
-		}
-		return nullptr;
+		return m_players_by_id[id];
 	}
 
-	player_ptr player_service::get_by_host_token(uint64_t token) const
+	const player_ptr& player_service::get_by_host_token(uint64_t token) const
 	{
-		for (const auto& player : m_players | std::ranges::views::values)
-		{
-			if (auto net_data = player->get_net_data())
-			{
-				if (net_data->m_host_token == token)
-				{
-					return player;
-				}
-			}
-		}
-		return nullptr;
+		return m_players_by_id.find(m_host_tokens, token, [](const player& plyr) {
+			auto net_data = plyr.get_net_data();
+			return net_data ? net_data->m_host_token : 0;
+		});
 	}
 
-		player_ptr player_service::get_by_name(std::string_view name) const
+	const player_ptr& player_service::get_by_rockstar_id(int64_t rockstar_id) const
 	{
-		std::string self_name  = g_player_service->get_self()->get_name();
-		std::string name_lower = name.data();
-		std::transform(self_name.begin(), self_name.end(), self_name.begin(), ::tolower);
-		std::transform(name_lower.begin(), name_lower.end(), name_lower.begin(), ::tolower);
+		return m_players_by_id.find(m_rockstar_ids, rockstar_id, [](const player& plyr) {
+			return plyr.get_rockstar_id();
+		});
+	}
+
+	player_ptr player_service::get_by_name(std::string_view name) const
+	{
+		const auto equals_ignore_case = [](char a, char b) {
+			return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+		};
 
 		for (auto& [_, player] : m_players)
 		{
-			std::string player_name = player->get_name();
-			std::transform(player_name.begin(), player_name.end(), player_name.begin(), ::tolower);
-			if (player_name == name_lower)
+			if (std::ranges::equal(std::string_view(player->get_name()), name, equals_ignore_case))
 				return player;
 		}
 		return nullptr;
@@ -160,27 +145,48 @@ namespace big
 		if (net_game_player == nullptr || net_game_player == *m_self)
 			return;
 
+		const auto id = net_game_player->m_player_id;
+		if (id >= max_players)
+			return;
+
+		if (m_players_by_id[id])
+			clear_slot(id);
+
 		auto plyr = std::make_shared<player>(net_game_player);
+
+		m_players_by_id.set(id, plyr);
+		m_msg_ids[id]      = net_game_player->m_msg_id;
+		m_host_tokens[id]  = plyr->get_net_data() ? plyr->get_net_data()->m_host_token : 0;
+		m_rockstar_ids[id] = plyr->get_rockstar_id();
+
 		m_players.insert({plyr->get_name(), std::move(plyr)});
 	}
 
-	void player_service::player_leave(CNetGamePlayer* net_game_player)
+	void player_service::clear_slot(uint8_t id)
 	{
-		if (net_game_player == nullptr)
-			return;
-
-		if (m_selected_player && m_selected_player->equals(net_game_player))
-			m_selected_player = m_dummy;
-
 		if (auto it = std::find_if(m_players.begin(),
 		        m_players.end(),
-		        [net_game_player](const auto& p) {
-			        return p.second->id() == net_game_player->m_player_id;
+		        [this, id](const auto& p) {
+			        return p.second == m_players_by_id[id];
 		        });
 		    it != m_players.end())
 		{
 			m_players.erase(it);
 		}
+
+		m_players_by_id.erase(id);
+	}
+
+	void player_service::player_leave(CNetGamePlayer* net_game_player)
+	{
+		if (net_game_player == nullptr)
+			return;
+
+		if (m_selected_player && m_selected_player->equals(net_game_player))
+			m_selected_player = m_dummy;
+
+		if (const auto id = net_game_player->m_player_id; id < max_players && m_players_by_id[id])
+			clear_slot(id);
 	}
 
 	void player_service::mark_player_as_sending_modder_beacons(std::uint64_t rid)
@@ -1,5 +1,6 @@
 #pragma once
 #include "player.hpp"
+#include "player_slots.hpp"
 
 namespace big
 {
@@ -11,12 +12,24 @@ namespace big
 
 	class player_service final
 	{
+	public:
+		static constexpr std::size_t max_players = 32;
+
+	private:
 		CNetGamePlayer** m_self;
 
 		player_ptr m_self_ptr;
 
 		players m_players;
 
+		// flat tables indexed by player id, kept in sync with m_players in player_join and player_leave
+		// so that the lookups done from network hooks never have to walk the map
+		// the keys are captured on join and re-indexed by the lookups when the live value has changed since
+		player_slots<player, max_players> m_players_by_id;
+		mutable std::array<std::uint32_t, max_players> m_msg_ids{};
+		mutable std::array<std::uint64_t, max_players> m_host_tokens{};
+		mutable std::array<std::int64_t, max_players> m_rockstar_ids{};
+
 		player_ptr m_dummy = std::make_shared<player>(nullptr);
 		player_ptr m_selected_player;
 
@@ -35,9 +48,11 @@ namespace big
 
 		[[nodiscard]] player_ptr get_self();
 
-		[[nodiscard]] player_ptr get_by_msg_id(uint32_t msg_id) const;
-		[[nodiscard]] player_ptr get_by_id(uint32_t id) const;
-		[[nodiscard]] player_ptr get_by_host_token(uint64_t token) const;
+		// these return a reference into the id table, copy it if it has to outlive the next player_join or player_leave
+		[[nodiscard]] const player_ptr& get_by_msg_id(uint32_t msg_id) const;
+		[[nodiscard]] const player_ptr& get_by_id(uint32_t id) const;
+		[[nodiscard]] const player_ptr& get_by_host_token(uint64_t token) const;
+		[[nodiscard]] const player_ptr& get_by_rockstar_id(int64_t rockstar_id) const;
 		[[nodiscard]] player_ptr get_selected() const;
 		[[nodiscard]] player_ptr get_by_name(const std::string_view name) const;
 		[[nodiscard]] player_ptr get_by_name_closest(const std::string_view name) const;
@@ -60,6 +75,9 @@ namespace big
 		}
 
 		void set_selected(player_ptr plyr);
+
+	private:
+		void clear_slot(uint8_t id);
 	};
 
 	inline player_service* g_player_service{};
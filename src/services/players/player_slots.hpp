@@ -0,0 +1,76 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <memory>
+
+namespace big
+{
+	// Players indexed by player id, with a mask of the occupied ids so that lookups only visit the players in the session.
+	// Doesn't know about the game, the keys and how to read them live are passed in by player_service.
+	template<typename T, std::size_t capacity>
+	class player_slots
+	{
+		static_assert(capacity <= 32, "the occupied mask is 32 bits");
+
+	public:
+		using value_ptr = std::shared_ptr<T>;
+
+		const value_ptr& operator[](std::size_t id) const
+		{
+			return id < capacity ? m_values[id] : m_null;
+		}
+
+		void set(std::size_t id, value_ptr value)
+		{
+			m_values[id] = std::move(value);
+			m_occupied |= 1u << id;
+		}
+
+		void erase(std::size_t id)
+		{
+			m_values[id] = nullptr;
+			m_occupied &= ~(1u << id);
+		}
+
+		void clear()
+		{
+			m_values.fill(nullptr);
+			m_occupied = 0;
+		}
+
+		// a hit in keys is confirmed against the live key, a miss or a stale hit falls back to
+		// comparing the live keys of every occupied slot and re-indexes the ones that changed
+		template<typename K, typename F>
+		const value_ptr& find(std::array<K, capacity>& keys, K key, F&& live_key) const
+		{
+			for (auto slots = m_occupied; slots; slots &= slots - 1)
+			{
+				const auto id = std::countr_zero(slots);
+				if (keys[id] == key)
+				{
+					if (live_key(*m_values[id]) == key) [[likely]]
+						return m_values[id];
+					break;
+				}
+			}
+
+			const value_ptr* found = &m_null;
+			for (auto slots = m_occupied; slots; slots &= slots - 1)
+			{
+				const auto id   = std::countr_zero(slots);
+				const auto live = live_key(*m_values[id]);
+				keys[id]        = live;
+				if (live == key && !*found)
+					found = &m_values[id];
+			}
+			return *found;
+		}
+
+	private:
+		std::array<value_ptr, capacity> m_values{};
+		std::uint32_t m_occupied = 0;
+
+		inline static const value_ptr m_null{};
+	};
+}
@@ -0,0 +1,82 @@
+#include "pool_snapshot_service.hpp"
+
+#include "pointers.hpp"
+#include "util/pools.hpp"
+
+#include <entities/CDynamicEntity.hpp>
+
+namespace big
+{
+	void pool_snapshot::add(rage::CEntity* entity)
+	{
+		auto& entry     = m_entities.emplace_back();
+		entry.m_pointer = entity;
+		entry.m_model   = entity->m_model_info ? entity->m_model_info->m_hash : 0;
+
+		if (entity->m_navigation)
+			entry.m_position = *entity->m_navigation->get_position();
+		else
+			entry.m_position = {};
+
+		m_handles.push_back(0);
+	}
+
+	Entity pool_snapshot::handle(std::size_t index) const
+	{
+		auto& handle = m_handles[index];
+		if (!handle)
+			handle = g_pointers->m_gta.m_ptr_to_handle(m_entities[index].m_pointer);
+
+		return handle;
+	}
+
+	std::span<const Entity> pool_snapshot::handles() const
+	{
+		for (std::size_t i = 0; i < m_entities.size(); i++)
+			handle(i);
+
+		return m_handles;
+	}
+
+	const pool_snapshot& pool_snapshot_service::peds()
+	{
+		if (!m_peds_valid)
+		{
+			m_peds.clear();
+			pools::get_all_peds().for_each_entity([this](rage::CEntity* entity) {
+				m_peds.add(entity);
+			});
+			m_peds_valid = true;
+		}
+
+		return m_peds;
+	}
+
+	const pool_snapshot& pool_snapshot_service::vehicles()
+	{
+		if (!m_vehicles_valid)
+		{
+			m_vehicles.clear();
+			pools::get_all_vehicles().for_each_entity([this](rage::CEntity* entity) {
+				m_vehicles.add(entity);
+			});
+			m_vehicles_valid = true;
+		}
+
+		return m_vehicles;
+	}
+
+	const pool_snapshot& pool_snapshot_service::props()
+	{
+		if (!m_props_valid)
+		{
+			m_props.clear();
+			pools::get_all_props().for_each_entity([this](rage::CEntity* entity) {
+				m_props.add(entity);
+			});
+			m_props_valid = true;
+		}
+
+		return m_props;
+	}
+}
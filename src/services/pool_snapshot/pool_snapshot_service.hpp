@@ -0,0 +1,82 @@
+#pragma once
+#include <rage/vector.hpp>
+#include <script/types.hpp>
+
+#include <span>
+
+namespace rage
+{
+	class CEntity;
+}
+
+namespace big
+{
+	struct pool_entity
+	{
+		rage::CEntity* m_pointer;
+		Hash m_model;
+		rage::fvector3 m_position;
+	};
+
+	class pool_snapshot
+	{
+	public:
+		std::span<const pool_entity> entities() const
+		{
+			return m_entities;
+		}
+
+		// script handle of entities()[index], created on first use since most consumers only need the pointers
+		Entity handle(std::size_t index) const;
+
+		// handles of every entity, the span is only valid until the end of the frame
+		std::span<const Entity> handles() const;
+
+	private:
+		friend class pool_snapshot_service;
+
+		void clear()
+		{
+			m_entities.clear();
+			m_handles.clear();
+		}
+
+		void add(rage::CEntity* entity);
+
+		// only ever grow so that the steady state doesn't allocate
+		std::vector<pool_entity> m_entities;
+		// 0 until resolved
+		mutable std::vector<Entity> m_handles;
+	};
+
+	// Copies the ped, vehicle and object pools once per game frame, on first use, so that every
+	// consumer in that frame shares the same walk instead of doing its own.
+	// Must only be used from the game thread, and nothing it returns may be held across a yield since the
+	// snapshot is refilled on the next frame. Entities created later in the same frame show up on the next one.
+	// Deleting an entity through the entity helpers invalidates the snapshot, so a consumer that deletes entities
+	// has to resolve the handles it needs before the first delete.
+	class pool_snapshot_service final
+	{
+	public:
+		// called once per game frame from script_mgr and whenever an entity is deleted
+		void invalidate()
+		{
+			m_peds_valid = m_vehicles_valid = m_props_valid = false;
+		}
+
+		const pool_snapshot& peds();
+		const pool_snapshot& vehicles();
+		const pool_snapshot& props();
+
+	private:
+		pool_snapshot m_peds;
+		pool_snapshot m_vehicles;
+		pool_snapshot m_props;
+
+		bool m_peds_valid     = false;
+		bool m_vehicles_valid = false;
+		bool m_props_valid    = false;
+	};
+
+	inline pool_snapshot_service g_pool_snapshot_service{};
+}
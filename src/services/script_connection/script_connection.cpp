@@ -315,7 +315,7 @@ namespace big
 		}
 	}
 
-	bool script_connection::should_cleanup()
+	bool script_connection::has_lost_thread_or_target()
 	{
 		if (m_startup_failed)
 		{
@@ -341,6 +341,14 @@ namespace big
 			return true;
 		}
 
+		return false;
+	}
+
+	bool script_connection::should_cleanup()
+	{
+		if (has_lost_thread_or_target())
+			return true;
+
 		if (m_startup_done && m_target && m_target->get()->is_valid())
 		{
 			bool is_a_participant = false;
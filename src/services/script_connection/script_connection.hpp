@@ -48,12 +48,17 @@ namespace big
 		script_connection(const std::string& script_name, std::optional<player_ptr> target = std::nullopt);
 		void start();
 		void cleanup();
+		// startup failed, the local thread died or the target left, only reads memory so it's cheap enough for every tick
+		bool has_lost_thread_or_target();
+		// the checks above plus the participant check, which has to run as the script, and the timeout when stacks run low
 		bool should_cleanup();
 		void give_host();
 
 		// clang-format off
 
 		inline rage::joaat_t get_script_hash() { return m_script_hash; }
+		inline bool is_startup_done() { return m_startup_done; }
+		inline bool has_startup_failed() { return m_startup_failed; }
 		inline std::optional<player_ptr> get_target() { return m_target; }
 		inline rage::scrThread* get_script_thread() { return m_thread; }
 
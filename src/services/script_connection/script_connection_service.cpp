@@ -2,15 +2,17 @@
 
 namespace big
 {
-	script_connection* script_connection_service::get_connection(const std::string& script_name, std::optional<player_ptr> target)
+	script_connection_service::key_t script_connection_service::get_key(rage::joaat_t script_hash, const std::optional<player_ptr>& target)
 	{
-		auto hash = rage::joaat(script_name);
+		// player ids fit in a byte, 0xFFFF can't clash with one
+		const std::uint32_t target_id = target ? target->get()->id() : 0xFFFF;
+		return static_cast<key_t>(script_hash) << 32 | target_id;
+	}
 
-		for (auto& cxn : m_script_connections)
-			if (cxn->get_script_hash() == hash
-			    && ((!target && !cxn->get_target())
-			        || (target && cxn->get_target() && target->get()->id() == cxn->get_target()->get()->id())))
-				return cxn.get();
+	script_connection* script_connection_service::get_connection(const std::string& script_name, std::optional<player_ptr> target)
+	{
+		if (const auto it = m_script_connections.find(get_key(rage::joaat(script_name), target)); it != m_script_connections.end())
+			return it->second.get();
 
 		return nullptr;
 	}
@@ -30,23 +32,92 @@ namespace big
 		if (auto cxn = get_connection(script_name, target))
 			return cxn;
 
+		const auto key = get_key(rage::joaat(script_name), target);
+
 		auto cxn = std::make_unique<script_connection>(script_name, target);
 		auto ret = cxn.get();
-		m_script_connections.push_back(std::move(cxn));
+		m_script_connections.emplace(key, std::move(cxn));
+		m_pending.push_back(key);
 
 		return ret;
 	}
 
+	void script_connection_service::schedule(key_t key, std::chrono::milliseconds delay)
+	{
+		const auto slots = std::clamp<std::size_t>(delay / wheel_resolution, 1, wheel_slots - 1);
+		m_wheel[(m_wheel_position + slots) % wheel_slots].push_back(key);
+	}
+
+	bool script_connection_service::expire_if_needed(key_t key)
+	{
+		const auto it = m_script_connections.find(key);
+		if (it == m_script_connections.end())
+			return true;
+
+		if (!it->second->should_cleanup())
+			return false;
+
+		it->second->cleanup();
+		m_script_connections.erase(it);
+		return true;
+	}
+
+	void script_connection_service::expire_lost()
+	{
+		// the wheel still holds the keys of the erased connections, they're dropped when their slot comes up
+		std::erase_if(m_script_connections, [](const auto& entry) {
+			const auto& cxn = entry.second;
+			if (!cxn->is_startup_done() || !cxn->has_lost_thread_or_target())
+				return false;
+
+			cxn->cleanup();
+			return true;
+		});
+	}
+
 	void script_connection_service::on_tick()
 	{
-		std::erase_if(m_script_connections, [](auto& cxn) {
-			if (cxn.get()->should_cleanup())
+		// only the startup flags matter until a connection is established, those are cheap to poll every tick
+		std::erase_if(m_pending, [this](key_t key) {
+			const auto it = m_script_connections.find(key);
+			if (it == m_script_connections.end())
+				return true;
+
+			if (it->second->has_startup_failed())
 			{
-				cxn.get()->cleanup();
+				expire_if_needed(key);
+				return true;
+			}
+
+			if (it->second->is_startup_done())
+			{
+				schedule(key, check_interval);
 				return true;
 			}
 
 			return false;
 		});
+
+		// a dead thread or a target that left must not be used for another check_interval
+		expire_lost();
+
+		const auto now = std::chrono::steady_clock::now();
+
+		// after a long stall every slot is due anyway, no need to go around more than once
+		if (now - m_wheel_time > wheel_resolution * wheel_slots)
+			m_wheel_time = now - wheel_resolution * wheel_slots;
+
+		while (now - m_wheel_time >= wheel_resolution)
+		{
+			m_wheel_time += wheel_resolution;
+			m_wheel_position = (m_wheel_position + 1) % wheel_slots;
+
+			auto due = std::move(m_wheel[m_wheel_position]);
+			m_wheel[m_wheel_position].clear();
+
+			for (const auto key : due)
+				if (!expire_if_needed(key))
+					schedule(key, check_interval);
+		}
 	}
-}
\ No newline at end of file
+}
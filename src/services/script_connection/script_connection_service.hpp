@@ -3,10 +3,35 @@
 
 namespace big
 {
+	// Connections are indexed by script and target. Connections that are still starting up only have their startup state polled,
+	// established ones have their thread and target checked every tick and sit in a timer wheel for the checks that are too
+	// expensive for that, which run every check_interval.
 	class script_connection_service
 	{
-		std::vector<std::unique_ptr<script_connection>> m_script_connections;
+	public:
+		static constexpr std::chrono::milliseconds check_interval{250};
+		static constexpr std::chrono::milliseconds wheel_resolution{50};
+		static constexpr std::size_t wheel_slots = 64;
+
+	private:
+		using key_t = std::uint64_t;
+
+		std::unordered_map<key_t, std::unique_ptr<script_connection>> m_script_connections;
+		// still starting up
+		std::vector<key_t> m_pending;
+		// established, bucketed by when they're due to be checked next
+		std::array<std::vector<key_t>, wheel_slots> m_wheel;
+		std::size_t m_wheel_position = 0;
+		std::chrono::steady_clock::time_point m_wheel_time = std::chrono::steady_clock::now();
+
+		static key_t get_key(rage::joaat_t script_hash, const std::optional<player_ptr>& target);
+
 		script_connection* get_connection(const std::string& script_name, std::optional<player_ptr> target);
+		void schedule(key_t key, std::chrono::milliseconds delay);
+		// cleans up and removes the connection if it should be, returns true if it did
+		bool expire_if_needed(key_t key);
+		// cleans up and removes every established connection whose thread or target is gone
+		void expire_lost();
 
 	public:
 		script_connection_service();
@@ -17,4 +42,4 @@ namespace big
 	};
 
 	inline script_connection_service* g_script_connection_service;
-}
\ No newline at end of file
+}
@@ -0,0 +1,218 @@
+#include "script_function_cache.hpp"
+
+#include "file_manager.hpp"
+#include "memory/pattern.hpp"
+
+#include <script/scrProgram.hpp>
+
+namespace big
+{
+	std::vector<std::optional<uint32_t>> script_function_cache::resolve(rage::scrProgram* program, std::span<const std::string> patterns)
+	{
+		std::vector<std::optional<uint32_t>> results(patterns.size());
+		if (!program || !program->is_valid())
+			return results;
+
+		std::lock_guard lock(m_mutex);
+		if (!m_loaded)
+		{
+			load();
+			m_loaded = true;
+		}
+
+		auto& entry = get_entry(program);
+
+		std::vector<std::string_view> missing;
+		for (const auto& pattern : patterns)
+			if (!entry.m_patterns.contains(pattern))
+				missing.push_back(pattern);
+
+		if (!missing.empty())
+			scan(program, entry, missing);
+
+		// a rescan in get_entry and the scan of the new patterns are written out together
+		if (m_dirty)
+		{
+			save();
+			m_dirty = false;
+		}
+
+		for (std::size_t i = 0; i < patterns.size(); i++)
+			results[i] = entry.m_patterns.find(patterns[i])->second;
+
+		return results;
+	}
+
+	std::optional<uint32_t> script_function_cache::resolve(rage::scrProgram* program, const std::string& pattern)
+	{
+		return resolve(program, std::span(&pattern, 1)).front();
+	}
+
+	script_function_cache::script_entry& script_function_cache::get_entry(rage::scrProgram* program)
+	{
+		auto& entry = m_scripts[program->m_name_hash];
+		if (entry.m_program == program && entry.m_code_size == program->m_code_size)
+			return entry;
+
+		entry.m_program   = program;
+		entry.m_code_size = program->m_code_size;
+
+		if (const auto sum = checksum(program); sum != entry.m_checksum)
+		{
+			entry.m_checksum = sum;
+
+			if (!entry.m_patterns.empty())
+			{
+				LOG(VERBOSE) << "Bytecode of " << program->m_name << " changed, rescanning " << entry.m_patterns.size() << " script function patterns";
+
+				// keep the patterns so they all get rescanned in one go, only the locations are stale
+				std::vector<std::string_view> patterns;
+				for (auto& [pattern, location] : entry.m_patterns)
+					patterns.push_back(pattern);
+
+				scan(program, entry, patterns);
+			}
+		}
+
+		return entry;
+	}
+
+	void script_function_cache::scan(rage::scrProgram* program, script_entry& entry, const std::vector<std::string_view>& patterns)
+	{
+		struct pending
+		{
+			std::string_view m_name;
+			memory::pattern m_pattern;
+			std::optional<uint32_t> m_location;
+		};
+
+		std::vector<pending> scans;
+		scans.reserve(patterns.size());
+		for (const auto pattern : patterns)
+			scans.push_back({pattern, memory::pattern(pattern)});
+
+		// patterns starting with a known byte are only tried where that byte is, the rest everywhere
+		std::array<std::vector<pending*>, 256> by_first_byte;
+		std::vector<pending*> wildcards;
+		for (auto& scan : scans)
+		{
+			if (scan.m_pattern.m_bytes.empty())
+				continue;
+
+			if (const auto first = scan.m_pattern.m_bytes.front())
+				by_first_byte[*first].push_back(&scan);
+			else
+				wildcards.push_back(&scan);
+		}
+
+		const auto code_size = program->m_code_size;
+		auto remaining       = scans.size();
+
+		const auto try_match = [&](pending* scan, uint32_t location) {
+			if (scan->m_location)
+				return;
+
+			const auto& bytes = scan->m_pattern.m_bytes;
+			if (location + bytes.size() > code_size)
+				return;
+
+			for (uint32_t j = 1; j < bytes.size(); j++)
+				if (bytes[j] && *bytes[j] != *program->get_code_address(location + j))
+					return;
+
+			scan->m_location = location;
+			remaining--;
+		};
+
+		for (uint32_t page = 0; page < program->get_num_code_pages() && remaining; page++)
+		{
+			// not get_code_page_size(), that returns 0 for the last page if the code size is a multiple of the page size
+			const auto code      = program->get_code_page(page);
+			const auto page_size = std::min<uint32_t>(0x4000, code_size - (page << 14));
+
+			for (uint32_t offset = 0; offset < page_size && remaining; offset++)
+			{
+				const auto location = (page << 14) + offset;
+
+				for (const auto scan : by_first_byte[code[offset]])
+					try_match(scan, location);
+				for (const auto scan : wildcards)
+					try_match(scan, location);
+			}
+		}
+
+		for (const auto& scan : scans)
+		{
+			if (scan.m_location)
+				LOG(VERBOSE) << "Found script function pattern " << scan.m_name << " at " << HEX_TO_UPPER(*scan.m_location) << " in " << program->m_name;
+			else
+				LOG(WARNING) << "Failed to find script function pattern " << scan.m_name << " in " << program->m_name;
+
+			entry.m_patterns.insert_or_assign(std::string(scan.m_name), scan.m_location);
+		}
+
+		m_dirty = true;
+	}
+
+	void script_function_cache::load()
+	{
+		const auto file = g_file_manager.get_project_file("./cache/scr_function_cache.json");
+		if (!file.exists())
+			return;
+
+		try
+		{
+			std::ifstream stream(file.get_path());
+			const auto json = nlohmann::json::parse(stream);
+			if (json.at("version") != version)
+				return;
+
+			for (const auto& script : json.at("scripts"))
+			{
+				auto& entry      = m_scripts[script.at("hash").get<rage::joaat_t>()];
+				entry.m_checksum = script.at("checksum").get<std::uint64_t>();
+
+				for (const auto& [pattern, location] : script.at("patterns").items())
+					entry.m_patterns.emplace(pattern, location.is_null() ? std::nullopt : std::optional(location.get<uint32_t>()));
+			}
+		}
+		catch (const std::exception& e)
+		{
+			LOG(WARNING) << "Failed to load the script function cache: " << e.what();
+			m_scripts.clear();
+		}
+	}
+
+	void script_function_cache::save() const
+	{
+		nlohmann::json json;
+		json["version"] = version;
+		json["scripts"] = nlohmann::json::array();
+
+		for (const auto& [hash, entry] : m_scripts)
+		{
+			nlohmann::json patterns = nlohmann::json::object();
+			for (const auto& [pattern, location] : entry.m_patterns)
+				patterns[pattern] = location ? nlohmann::json(*location) : nlohmann::json(nullptr);
+
+			json["scripts"].push_back({{"hash", hash}, {"checksum", entry.m_checksum}, {"patterns", std::move(patterns)}});
+		}
+
+		std::ofstream stream(g_file_manager.get_project_file("./cache/scr_function_cache.json").get_path(), std::ios::out | std::ios::trunc);
+		stream << json;
+	}
+
+	std::uint64_t script_function_cache::checksum(const rage::scrProgram* program)
+	{
+		// FNV-1a over the code pages, only has to tell two versions of the same script apart
+		std::uint64_t hash = 0xCBF29CE484222325;
+		for (uint32_t page = 0; page < program->get_num_code_pages(); page++)
+		{
+			const auto code = program->get_code_page(page);
+			for (uint32_t i = 0, size = std::min<uint32_t>(0x4000, program->m_code_size - (page << 14)); i < size; i++)
+				hash = (hash ^ code[i]) * 0x100000001B3;
+		}
+
+		return hash ^ program->m_code_size;
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "gta/joaat.hpp"
+
+#include <map>
+#include <span>
+
+namespace rage
+{
+	class scrProgram;
+}
+
+namespace big
+{
+	// Instruction pointers of script functions found by bytecode pattern, keyed by (script, code checksum, pattern).
+	// Every pattern ever asked for a script is remembered, so when a script shows up with new bytecode they are all
+	// rescanned together in a single pass instead of one scan per caller.
+	// Results are persisted between sessions and dropped once the checksum of the script's code changes.
+	class script_function_cache
+	{
+	public:
+		static constexpr int version = 1;
+
+		/**
+		 * \brief Resolves every pattern against the program, scanning the bytecode at most once for all cache misses.
+		 * \return one entry per pattern, std::nullopt if the pattern isn't in this version of the script
+		 */
+		std::vector<std::optional<uint32_t>> resolve(rage::scrProgram* program, std::span<const std::string> patterns);
+		std::optional<uint32_t> resolve(rage::scrProgram* program, const std::string& pattern);
+
+	private:
+		struct script_entry
+		{
+			std::uint64_t m_checksum = 0;
+			// instruction pointer or std::nullopt if the pattern was scanned for and not found
+			std::map<std::string, std::optional<uint32_t>, std::less<>> m_patterns;
+
+			// the program the checksum was last computed for, hashing the whole script again on every call would defeat the cache
+			const rage::scrProgram* m_program = nullptr;
+			uint32_t m_code_size              = 0;
+		};
+
+		script_entry& get_entry(rage::scrProgram* program);
+		void scan(rage::scrProgram* program, script_entry& entry, const std::vector<std::string_view>& patterns);
+
+		void load();
+		void save() const;
+
+		static std::uint64_t checksum(const rage::scrProgram* program);
+
+		std::mutex m_mutex;
+		std::unordered_map<rage::joaat_t, script_entry> m_scripts;
+		bool m_loaded = false;
+		// set by scan(), resolve() saves once at the end however many scans it took
+		bool m_dirty = false;
+	};
+
+	inline script_function_cache g_script_function_cache{};
+}
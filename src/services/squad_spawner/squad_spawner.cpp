@@ -1,6 +1,7 @@
 #include "squad_spawner.hpp"
 
 #include "gta/joaat.hpp"
+#include "services/streaming/model_streaming_service.hpp"
 #include "services/vehicle/persist_car_service.hpp"
 #include "util/math.hpp"
 #include "util/pathfind.hpp"
@@ -216,6 +217,13 @@ namespace big
 		}
 
 		Hash veh_model_hash  = rage::joaat(s.m_vehicle_model);
+
+		// start streaming the members and their vehicle while the spawn position is being searched for
+		std::vector<Hash> models{rage::joaat(s.m_ped_model)};
+		if (s.does_squad_have_vehicle() && !s.does_squad_have_persistent_vehicle())
+			models.push_back(veh_model_hash);
+		const auto model_handles = g_model_streaming_service.prefetch(models);
+
 		s.current_target_ped = g_pointers->m_gta.m_ptr_to_handle(s.target->get_ped());
 		float heading;
 
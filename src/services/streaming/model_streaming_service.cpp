@@ -0,0 +1,296 @@
+#include "model_streaming_service.hpp"
+
+#include "natives.hpp"
+#include "script.hpp"
+
+namespace big
+{
+	struct model_handle::entry
+	{
+		model_streaming_service* m_service;
+		rage::joaat_t m_hash;
+		model_state m_state;
+		std::size_t m_ref_count = 0;
+		std::chrono::steady_clock::time_point m_requested_at;
+		std::vector<model_streaming_service::callback_t> m_callbacks;
+		std::optional<std::list<rage::joaat_t>::iterator> m_idle_it;
+	};
+
+	class native_streaming_backend final : public streaming_backend
+	{
+	public:
+		bool is_valid(rage::joaat_t model) override
+		{
+			return STREAMING::IS_MODEL_VALID(model) && STREAMING::IS_MODEL_IN_CDIMAGE(model);
+		}
+
+		void request(rage::joaat_t model) override
+		{
+			STREAMING::REQUEST_MODEL(model);
+		}
+
+		bool has_loaded(rage::joaat_t model) override
+		{
+			return STREAMING::HAS_MODEL_LOADED(model);
+		}
+
+		void release(rage::joaat_t model) override
+		{
+			STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(model);
+		}
+	};
+
+	model_handle::model_handle(entry* entry) :
+	    m_entry(entry)
+	{
+		if (m_entry)
+			m_entry->m_service->add_ref(m_entry);
+	}
+
+	model_handle::~model_handle()
+	{
+		if (m_entry)
+			m_entry->m_service->remove_ref(m_entry);
+	}
+
+	model_handle::model_handle(const model_handle& other) :
+	    model_handle(other.m_entry)
+	{
+	}
+
+	model_handle::model_handle(model_handle&& other) noexcept :
+	    m_entry(std::exchange(other.m_entry, nullptr))
+	{
+	}
+
+	model_handle& model_handle::operator=(const model_handle& other)
+	{
+		if (this != &other)
+			*this = model_handle(other);
+		return *this;
+	}
+
+	model_handle& model_handle::operator=(model_handle&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (m_entry)
+				m_entry->m_service->remove_ref(m_entry);
+			m_entry = std::exchange(other.m_entry, nullptr);
+		}
+		return *this;
+	}
+
+	rage::joaat_t model_handle::hash() const
+	{
+		return m_entry ? m_entry->m_hash : 0;
+	}
+
+	model_state model_handle::state() const
+	{
+		return m_entry ? m_entry->m_state : model_state::FAILED;
+	}
+
+	bool model_handle::wait() const
+	{
+		// the waiting fiber may well be the one that calls tick()
+		while (m_entry && m_entry->m_service->poll(m_entry) == model_state::REQUESTED)
+			script::get_current()->yield();
+
+		return loaded();
+	}
+
+	void model_handle::release()
+	{
+		if (m_entry)
+			m_entry->m_service->remove_ref(std::exchange(m_entry, nullptr), false);
+	}
+
+	model_streaming_service::model_streaming_service(std::unique_ptr<streaming_backend> backend) :
+	    m_backend(backend ? std::move(backend) : std::make_unique<native_streaming_backend>())
+	{
+	}
+
+	model_streaming_service::~model_streaming_service() = default;
+
+	model_handle model_streaming_service::acquire(rage::joaat_t hash)
+	{
+		auto& entry = m_entries[hash];
+		if (!entry)
+		{
+			entry = std::make_unique<model_handle::entry>(this, hash, model_state::FAILED);
+
+			if (m_backend->is_valid(hash))
+			{
+				entry->m_state        = model_state::REQUESTED;
+				entry->m_requested_at = std::chrono::steady_clock::now();
+				m_backend->request(hash);
+			}
+		}
+		else if (entry->m_state == model_state::LOADED && !m_backend->has_loaded(hash))
+		{
+			// someone else released it behind our back, e.g. a Lua script
+			entry->m_state        = model_state::REQUESTED;
+			entry->m_requested_at = std::chrono::steady_clock::now();
+			m_backend->request(hash);
+		}
+
+		if (entry->m_state == model_state::REQUESTED && m_backend->has_loaded(hash))
+			entry->m_state = model_state::LOADED;
+
+		return model_handle(entry.get());
+	}
+
+	std::vector<model_handle> model_streaming_service::prefetch(std::span<const rage::joaat_t> hashes)
+	{
+		std::vector<model_handle> handles;
+		handles.reserve(hashes.size());
+		for (const auto hash : hashes)
+			handles.push_back(acquire(hash));
+		return handles;
+	}
+
+	void model_streaming_service::on_loaded(const model_handle& handle, callback_t callback)
+	{
+		if (!handle.m_entry || handle.m_entry->m_state != model_state::REQUESTED)
+		{
+			callback(handle.loaded());
+			return;
+		}
+
+		// the callback keeps the model alive until it has been called
+		handle.m_entry->m_callbacks.emplace_back([handle, callback = std::move(callback)](bool loaded) {
+			callback(loaded);
+		});
+	}
+
+	bool model_streaming_service::wait_all(std::span<const model_handle> handles)
+	{
+		bool all_loaded = true;
+		for (const auto& handle : handles)
+			all_loaded &= handle.wait();
+		return all_loaded;
+	}
+
+	void model_streaming_service::set_idle_budget(std::size_t budget)
+	{
+		m_idle_budget = budget;
+		evict();
+	}
+
+	void model_streaming_service::update(model_handle::entry& entry, std::chrono::steady_clock::time_point now, completed_t& completed)
+	{
+		if (entry.m_state != model_state::REQUESTED)
+			return;
+
+		if (m_backend->has_loaded(entry.m_hash))
+			entry.m_state = model_state::LOADED;
+		else if (now - entry.m_requested_at > request_timeout)
+		{
+			LOG(WARNING) << "Timed out streaming model " << HEX_TO_UPPER(entry.m_hash);
+			entry.m_state = model_state::FAILED;
+		}
+		else
+		{
+			m_backend->request(entry.m_hash);
+			return;
+		}
+
+		for (auto& callback : entry.m_callbacks)
+			completed.emplace_back(std::move(callback), entry.m_state == model_state::LOADED);
+		entry.m_callbacks.clear();
+	}
+
+	model_state model_streaming_service::poll(model_handle::entry* entry)
+	{
+		completed_t completed;
+		update(*entry, std::chrono::steady_clock::now(), completed);
+
+		for (auto& [callback, loaded] : completed)
+			callback(loaded);
+
+		return entry->m_state;
+	}
+
+	void model_streaming_service::tick()
+	{
+		const auto now = std::chrono::steady_clock::now();
+
+		// invoked after the pass, the callbacks own handles and dropping those can modify m_entries
+		completed_t completed;
+
+		for (auto& [hash, entry] : m_entries)
+			update(*entry, now, completed);
+
+		for (auto& [callback, loaded] : completed)
+			callback(loaded);
+		completed.clear();
+
+		evict();
+	}
+
+	void model_streaming_service::release_all()
+	{
+		std::vector<callback_t> pending;
+
+		for (auto& [hash, entry] : m_entries)
+		{
+			if (entry->m_state != model_state::FAILED)
+				m_backend->release(hash);
+
+			// handles that are still alive will see the model as failed instead of waiting forever
+			entry->m_state = model_state::FAILED;
+			entry->m_idle_it.reset();
+
+			std::move(entry->m_callbacks.begin(), entry->m_callbacks.end(), std::back_inserter(pending));
+			entry->m_callbacks.clear();
+		}
+
+		for (const auto hash : m_idle)
+			m_entries.erase(hash);
+		m_idle.clear();
+
+		for (auto& callback : pending)
+			callback(false);
+	}
+
+	void model_streaming_service::add_ref(model_handle::entry* entry)
+	{
+		if (entry->m_ref_count++ == 0 && entry->m_idle_it)
+		{
+			m_idle.erase(*entry->m_idle_it);
+			entry->m_idle_it.reset();
+		}
+	}
+
+	void model_streaming_service::remove_ref(model_handle::entry* entry, bool keep_idle)
+	{
+		if (--entry->m_ref_count != 0)
+			return;
+
+		if (entry->m_state == model_state::LOADED && keep_idle)
+		{
+			m_idle.push_front(entry->m_hash);
+			entry->m_idle_it = m_idle.begin();
+			evict();
+			return;
+		}
+
+		// released on purpose, abandoned before it finished loading or never valid in the first place
+		if (entry->m_state != model_state::FAILED)
+			m_backend->release(entry->m_hash);
+		m_entries.erase(entry->m_hash);
+	}
+
+	void model_streaming_service::evict()
+	{
+		while (m_idle.size() > m_idle_budget)
+		{
+			const auto hash = m_idle.back();
+			m_idle.pop_back();
+
+			m_backend->release(hash);
+			m_entries.erase(hash);
+		}
+	}
+}
@@ -0,0 +1,134 @@
+#pragma once
+#include "gta/joaat.hpp"
+
+#include <list>
+#include <span>
+
+namespace big
+{
+	// The streaming calls the service makes, split out so that the state machine can be driven without the game.
+	class streaming_backend
+	{
+	public:
+		virtual ~streaming_backend() = default;
+
+		// IS_MODEL_VALID && IS_MODEL_IN_CDIMAGE
+		virtual bool is_valid(rage::joaat_t model)   = 0;
+		virtual void request(rage::joaat_t model)    = 0;
+		virtual bool has_loaded(rage::joaat_t model) = 0;
+		virtual void release(rage::joaat_t model)    = 0;
+	};
+
+	enum class model_state
+	{
+		REQUESTED,
+		LOADED,
+		FAILED
+	};
+
+	class model_streaming_service;
+
+	// Reference counted request for a streamed model, the model stays resident for as long as a handle to it exists.
+	class model_handle final
+	{
+	public:
+		model_handle() = default;
+		~model_handle();
+
+		model_handle(const model_handle& other);
+		model_handle(model_handle&& other) noexcept;
+		model_handle& operator=(const model_handle& other);
+		model_handle& operator=(model_handle&& other) noexcept;
+
+		rage::joaat_t hash() const;
+		model_state state() const;
+
+		bool loaded() const
+		{
+			return m_entry && state() == model_state::LOADED;
+		}
+
+		/**
+		 * \brief Yields the current script fiber until the model has finished streaming.
+		 * Polls the request itself, so it doesn't depend on tick() running while the caller waits.
+		 * \return true if the model is loaded, false if it is invalid or timed out
+		 */
+		bool wait() const;
+
+		// Drops this handle and gives the model back to the game right away if no other handle holds it,
+		// for one-off spawns that don't want the model to linger in the idle list.
+		void release();
+
+	private:
+		friend class model_streaming_service;
+
+		struct entry;
+		explicit model_handle(entry* entry);
+
+		entry* m_entry = nullptr;
+	};
+
+	// Owns every model request made by the menu. Models are requested once and polled in a single pass per frame,
+	// so spawning many entities overlaps their streaming instead of loading one model at a time.
+	// Models without handles are kept in an LRU and released once more than the idle budget are resident.
+	// Must only be used from the game thread.
+	class model_streaming_service final
+	{
+	public:
+		static constexpr std::size_t default_idle_budget = 64;
+		static constexpr std::chrono::seconds request_timeout{10};
+
+		using callback_t = std::function<void(bool loaded)>;
+
+		explicit model_streaming_service(std::unique_ptr<streaming_backend> backend = nullptr);
+		~model_streaming_service();
+
+		model_streaming_service(const model_streaming_service&)                = delete;
+		model_streaming_service(model_streaming_service&&) noexcept            = delete;
+		model_streaming_service& operator=(const model_streaming_service&)     = delete;
+		model_streaming_service& operator=(model_streaming_service&&) noexcept = delete;
+
+		[[nodiscard]] model_handle acquire(rage::joaat_t hash);
+
+		// Requests a whole manifest at once, for example every part of a saved vehicle or a squad.
+		[[nodiscard]] std::vector<model_handle> prefetch(std::span<const rage::joaat_t> hashes);
+
+		// Calls back from tick() once the model loaded or failed, or right away if it already has.
+		void on_loaded(const model_handle& handle, callback_t callback);
+
+		/**
+		 * \brief Yields the current script fiber until every handle has finished streaming.
+		 * \return true if all of them loaded
+		 */
+		static bool wait_all(std::span<const model_handle> handles);
+
+		void set_idle_budget(std::size_t budget);
+
+		// polls every pending request, called once per frame from the backend loop
+		void tick();
+
+		// releases every model back to the game, called from the game thread before unloading
+		void release_all();
+
+	private:
+		friend class model_handle;
+
+		using completed_t = std::vector<std::pair<callback_t, bool>>;
+
+		// moves a pending request to LOADED or FAILED once it is, collecting the callbacks that became due
+		void update(model_handle::entry& entry, std::chrono::steady_clock::time_point now, completed_t& completed);
+		model_state poll(model_handle::entry* entry);
+
+		void add_ref(model_handle::entry* entry);
+		void remove_ref(model_handle::entry* entry, bool keep_idle = true);
+		void evict();
+
+		std::unique_ptr<streaming_backend> m_backend;
+		std::unordered_map<rage::joaat_t, std::unique_ptr<model_handle::entry>> m_entries;
+		// loaded models without handles, most recently used first
+		std::list<rage::joaat_t> m_idle;
+		std::size_t m_idle_budget = default_idle_budget;
+	};
+
+	inline model_streaming_service g_model_streaming_service{};
+}
@@ -0,0 +1,199 @@
+#include "telemetry_service.hpp"
+
+#include <cmath>
+
+namespace big
+{
+	void telemetry_histogram::reset()
+	{
+		for (auto& bucket : m_buckets)
+			bucket.store(0, std::memory_order_relaxed);
+
+		m_count.store(0, std::memory_order_relaxed);
+		m_total.store(0, std::memory_order_relaxed);
+		m_max.store(0, std::memory_order_relaxed);
+	}
+
+	std::uint32_t telemetry_probe::id()
+	{
+		auto id = m_id.load(std::memory_order_acquire);
+		if (id == invalid_id) [[unlikely]]
+		{
+			id = g_telemetry_service.register_probe(m_name);
+			m_id.store(id, std::memory_order_release);
+		}
+
+		return id;
+	}
+
+	std::uint32_t telemetry_service::register_probe(const std::string& name)
+	{
+		std::lock_guard lock(m_mutex);
+
+		if (auto it = std::find(m_probe_names.begin(), m_probe_names.end(), name); it != m_probe_names.end())
+			return static_cast<std::uint32_t>(std::distance(m_probe_names.begin(), it));
+
+		if (m_probe_names.size() >= max_probes)
+		{
+			LOG(WARNING) << "Telemetry probe limit reached, dropping " << name;
+			return telemetry_probe::invalid_id;
+		}
+
+		m_probe_names.push_back(name);
+		return static_cast<std::uint32_t>(m_probe_names.size() - 1);
+	}
+
+	telemetry_service::thread_block* telemetry_service::get_thread_block()
+	{
+		thread_local thread_block* block = nullptr;
+
+		if (!block) [[unlikely]]
+		{
+			std::lock_guard lock(m_mutex);
+			block = m_thread_blocks.emplace_back(std::make_unique<thread_block>()).get();
+		}
+
+		return block;
+	}
+
+	void telemetry_service::record(std::uint32_t probe_id, std::uint64_t ns)
+	{
+		if (probe_id >= max_probes) [[unlikely]]
+			return;
+
+		auto block     = get_thread_block();
+		auto histogram = block->m_histograms[probe_id].load(std::memory_order_relaxed);
+		if (!histogram) [[unlikely]]
+		{
+			std::lock_guard lock(m_mutex);
+			histogram = block->m_owned.emplace_back(std::make_unique<telemetry_histogram>()).get();
+			block->m_histograms[probe_id].store(histogram, std::memory_order_release);
+		}
+
+		histogram->record(ns);
+	}
+
+	static std::uint64_t percentile(const std::array<std::uint64_t, telemetry_histogram::bucket_count>& buckets, std::uint64_t count, double fraction)
+	{
+		if (count == 0)
+			return 0;
+
+		const auto target = static_cast<std::uint64_t>(std::ceil(count * fraction));
+		std::uint64_t seen = 0;
+		for (std::uint32_t i = 0; i < telemetry_histogram::bucket_count; i++)
+		{
+			seen += buckets[i];
+			if (seen >= target)
+				return telemetry_histogram::bucket_lower_bound(i);
+		}
+
+		return telemetry_histogram::bucket_lower_bound(telemetry_histogram::bucket_count - 1);
+	}
+
+	void telemetry_service::collect(std::vector<telemetry_stats>& result)
+	{
+		std::lock_guard lock(m_mutex);
+
+		result.resize(m_probe_names.size());
+		for (std::size_t i = 0; i < m_probe_names.size(); i++)
+		{
+			auto& stats      = result[i];
+			stats.m_name     = m_probe_names[i];
+			stats.m_count    = 0;
+			stats.m_total_ns = 0;
+			stats.m_max_ns   = 0;
+			stats.m_buckets.fill(0);
+
+			for (const auto& block : m_thread_blocks)
+			{
+				auto histogram = block->m_histograms[i].load(std::memory_order_acquire);
+				if (!histogram)
+					continue;
+
+				for (std::uint32_t j = 0; j < telemetry_histogram::bucket_count; j++)
+					stats.m_buckets[j] += histogram->m_buckets[j].load(std::memory_order_relaxed);
+
+				stats.m_count += histogram->m_count.load(std::memory_order_relaxed);
+				stats.m_total_ns += histogram->m_total.load(std::memory_order_relaxed);
+				stats.m_max_ns = std::max(stats.m_max_ns, histogram->m_max.load(std::memory_order_relaxed));
+			}
+
+			stats.m_p50_ns = percentile(stats.m_buckets, stats.m_count, 0.50);
+			stats.m_p99_ns = percentile(stats.m_buckets, stats.m_count, 0.99);
+		}
+
+		std::erase_if(result, [](const telemetry_stats& stats) {
+			return stats.m_count == 0;
+		});
+		std::sort(result.begin(), result.end(), [](const telemetry_stats& a, const telemetry_stats& b) {
+			return a.m_total_ns > b.m_total_ns;
+		});
+	}
+
+	void telemetry_service::reset()
+	{
+		std::lock_guard lock(m_mutex);
+
+		for (const auto& block : m_thread_blocks)
+			for (const auto& histogram : block->m_owned)
+				histogram->reset();
+	}
+
+	bool telemetry_service::export_csv(const std::filesystem::path& path)
+	{
+		std::ofstream file(path, std::ios::out | std::ios::trunc);
+		if (!file.is_open())
+			return false;
+
+		std::vector<telemetry_stats> stats_list;
+		collect(stats_list);
+
+		file << "probe,count,total_us,mean_us,p50_us,p99_us,max_us\n";
+		for (const auto& stats : stats_list)
+		{
+			file << std::format("\"{}\",{},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f}\n",
+			    stats.m_name,
+			    stats.m_count,
+			    stats.m_total_ns / 1000.0,
+			    stats.m_total_ns / 1000.0 / stats.m_count,
+			    stats.m_p50_ns / 1000.0,
+			    stats.m_p99_ns / 1000.0,
+			    stats.m_max_ns / 1000.0);
+		}
+
+		return true;
+	}
+
+	// layout: "YTLM", u32 version, u32 bucket count, u32 probe count
+	// then per probe: u32 name length, name, u64 count, u64 total ns, u64 max ns, u64 buckets[bucket count]
+	bool telemetry_service::export_binary(const std::filesystem::path& path)
+	{
+		std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+			return false;
+
+		const auto write = [&file](const auto& value) {
+			file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+		};
+
+		std::vector<telemetry_stats> stats_list;
+		collect(stats_list);
+
+		file.write("YTLM", 4);
+		write(std::uint32_t(1));
+		write(telemetry_histogram::bucket_count);
+		write(static_cast<std::uint32_t>(stats_list.size()));
+
+		for (const auto& stats : stats_list)
+		{
+			write(static_cast<std::uint32_t>(stats.m_name.size()));
+			file.write(stats.m_name.data(), stats.m_name.size());
+			write(stats.m_count);
+			write(stats.m_total_ns);
+			write(stats.m_max_ns);
+			file.write(reinterpret_cast<const char*>(stats.m_buckets.data()), sizeof(stats.m_buckets));
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,165 @@
+#pragma once
+#include <bit>
+
+namespace big
+{
+	// Log-linear latency histogram, 4 sub-buckets per power of two.
+	// Only the owning thread writes to it, readers may see slightly stale values.
+	class telemetry_histogram
+	{
+	public:
+		static constexpr std::uint32_t sub_bucket_bits  = 2;
+		static constexpr std::uint32_t sub_bucket_count = 1 << sub_bucket_bits;
+		static constexpr std::uint32_t bucket_count     = (64 - sub_bucket_bits + 1) * sub_bucket_count;
+
+		static constexpr std::uint32_t bucket_index(std::uint64_t ns)
+		{
+			if (ns < sub_bucket_count)
+				return static_cast<std::uint32_t>(ns);
+
+			const auto msb   = static_cast<std::uint32_t>(std::bit_width(ns)) - 1;
+			const auto shift = msb - sub_bucket_bits;
+			return (shift + 1) * sub_bucket_count + static_cast<std::uint32_t>((ns >> shift) & (sub_bucket_count - 1));
+		}
+
+		static constexpr std::uint64_t bucket_lower_bound(std::uint32_t index)
+		{
+			if (index < sub_bucket_count)
+				return index;
+
+			const auto shift = index / sub_bucket_count - 1;
+			return (static_cast<std::uint64_t>(sub_bucket_count) + index % sub_bucket_count) << shift;
+		}
+
+		void record(std::uint64_t ns)
+		{
+			auto& bucket = m_buckets[bucket_index(ns)];
+			bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			m_count.store(m_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			m_total.store(m_total.load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+			if (ns > m_max.load(std::memory_order_relaxed))
+				m_max.store(ns, std::memory_order_relaxed);
+		}
+
+		void reset();
+
+	private:
+		friend class telemetry_service;
+
+		std::array<std::atomic<std::uint32_t>, bucket_count> m_buckets{};
+		std::atomic<std::uint64_t> m_count{};
+		std::atomic<std::uint64_t> m_total{};
+		std::atomic<std::uint64_t> m_max{};
+	};
+
+	// A named measurement point, resolved to a probe id the first time it records while telemetry is enabled.
+	class telemetry_probe
+	{
+	public:
+		static constexpr std::uint32_t invalid_id = ~0u;
+
+		telemetry_probe() = default;
+		explicit telemetry_probe(std::string name) :
+		    m_name(std::move(name))
+		{
+		}
+
+		void set_name(std::string name)
+		{
+			m_name = std::move(name);
+		}
+
+		const std::string& name() const
+		{
+			return m_name;
+		}
+
+		std::uint32_t id();
+
+	private:
+		std::string m_name;
+		std::atomic<std::uint32_t> m_id{invalid_id};
+	};
+
+	struct telemetry_stats
+	{
+		std::string m_name;
+		std::uint64_t m_count;
+		std::uint64_t m_total_ns;
+		std::uint64_t m_p50_ns;
+		std::uint64_t m_p99_ns;
+		std::uint64_t m_max_ns;
+		std::array<std::uint64_t, telemetry_histogram::bucket_count> m_buckets;
+	};
+
+	class telemetry_service final
+	{
+	public:
+		static constexpr std::uint32_t max_probes = 1024;
+
+		telemetry_service()          = default;
+		virtual ~telemetry_service() = default;
+
+		[[nodiscard]] inline bool is_enabled() const
+		{
+			return m_enabled.load(std::memory_order_relaxed);
+		}
+
+		inline void set_enabled(bool enabled)
+		{
+			m_enabled.store(enabled, std::memory_order_relaxed);
+		}
+
+		std::uint32_t register_probe(const std::string& name);
+		void record(std::uint32_t probe_id, std::uint64_t ns);
+
+		// merges the histograms of every thread into result, sorted by total time spent
+		// result keeps its capacity between calls, so callers that collect every frame can reuse one buffer
+		void collect(std::vector<telemetry_stats>& result);
+		void reset();
+
+		bool export_csv(const std::filesystem::path& path);
+		bool export_binary(const std::filesystem::path& path);
+
+	private:
+		struct thread_block
+		{
+			std::array<std::atomic<telemetry_histogram*>, max_probes> m_histograms{};
+			std::vector<std::unique_ptr<telemetry_histogram>> m_owned;
+		};
+
+		thread_block* get_thread_block();
+
+		std::atomic_bool m_enabled{false};
+
+		std::mutex m_mutex;
+		std::vector<std::string> m_probe_names;
+		std::vector<std::unique_ptr<thread_block>> m_thread_blocks;
+	};
+
+	inline telemetry_service g_telemetry_service{};
+
+	class telemetry_scope
+	{
+	public:
+		explicit telemetry_scope(telemetry_probe& probe) :
+		    m_probe(g_telemetry_service.is_enabled() ? &probe : nullptr)
+		{
+			if (m_probe)
+				m_start = std::chrono::steady_clock::now();
+		}
+
+		~telemetry_scope()
+		{
+			if (m_probe)
+				g_telemetry_service.record(m_probe->id(), std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count());
+		}
+
+		telemetry_scope(const telemetry_scope&)            = delete;
+		telemetry_scope& operator=(const telemetry_scope&) = delete;
+
+	private:
+		telemetry_probe* m_probe;
+		std::chrono::steady_clock::time_point m_start;
+	};
+}
@@ -279,9 +279,9 @@ namespace big
 
 	cpr::Response translation_service::download_file(const std::string& filename)
 	{
-		auto response = g_http_client.get(m_url + filename);
+		auto response = g_http_client.cached_get(m_url + filename);
 		if (response.status_code != 200)
-			response = g_http_client.get(m_fallback_url + filename);
+			response = g_http_client.cached_get(m_fallback_url + filename);
 		return response;
 	}
 
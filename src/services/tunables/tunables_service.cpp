@@ -1,6 +1,5 @@
 #include "tunables_service.hpp"
 
-#include "memory/module.hpp"
 #include "natives.hpp"
 #include "pointers.hpp"
 #include "script.hpp"
@@ -9,18 +8,72 @@
 #include "thread_pool.hpp"
 #include "util/scripts.hpp"
 
+#include <script/scrProgram.hpp>
+
 namespace big
 {
+	tunable_handle_base::tunable_handle_base(rage::joaat_t hash) :
+	    m_hash(hash),
+	    m_next(g_tunable_handles)
+	{
+		g_tunable_handles = this;
+	}
+
+	tunable_handle_base::~tunable_handle_base()
+	{
+		for (auto handle = &g_tunable_handles; *handle; handle = &(*handle)->m_next)
+		{
+			if (*handle == this)
+			{
+				*handle = m_next;
+				break;
+			}
+		}
+	}
+
+	// PUSH_CONST_U32, the registrations push the hash of their tunable with it
+	static constexpr uint8_t push_const_u32 = 0x28;
+	// code after the hash that belongs to its registration, covers the native call and the global the result is stored in
+	static constexpr std::size_t registration_site_size = 32;
+
+	static std::uint64_t fnv1a(const uint8_t* data, std::size_t size, std::uint64_t hash = 0xCBF29CE484222325)
+	{
+		for (std::size_t i = 0; i < size; i++)
+			hash = (hash ^ data[i]) * 0x100000001B3;
+		return hash;
+	}
+
+	static std::vector<uint8_t> copy_code(const rage::scrProgram* program)
+	{
+		std::vector<uint8_t> code(program->m_code_size);
+		for (uint32_t page = 0; page < program->get_num_code_pages(); page++)
+		{
+			const auto offset = page << 14;
+			std::memcpy(code.data() + offset, program->get_code_page(page), std::min<uint32_t>(0x4000, program->m_code_size - offset));
+		}
+
+		return code;
+	}
+
+	static uint32_t get_bytecode_version(const rage::scrProgram* processing, const rage::scrProgram* registration)
+	{
+		auto hash = fnv1a(copy_code(processing).data(), processing->m_code_size);
+		hash      = fnv1a(copy_code(registration).data(), registration->m_code_size, hash);
+		return static_cast<uint32_t>(hash ^ (hash >> 32));
+	}
+
 	tunables_service::tunables_service() :
-	    m_cache_file(g_file_manager.get_project_file("./cache/tunables.bin"), 1)
+	    m_cache_file(g_file_manager.get_project_file("./cache/tunables.bin"), 2)
 	{
 		g_tunables_service = this;
 	}
 
 	tunables_service::~tunables_service()
 	{
-		m_loading          = false;
 		g_tunables_service = nullptr;
+
+		for (auto handle = g_tunable_handles; handle; handle = handle->m_next)
+			handle->m_address = nullptr;
 	}
 
 	void tunables_service::run_script()
@@ -29,62 +82,73 @@ namespace big
 		{
 			script::get_current()->yield();
 
-			m_cache_file.load();
-
-			if (m_cache_file.up_to_date(memory::module("GTA5.exe").timestamp()))
-			{
-				LOG(INFO) << "Loading tunables from cache";
-				m_loading = true;
-
-				load();
-			}
-
-			if (m_initialized || m_loading)
-				return;
-
-			if (!m_script_started && SCRIPT::GET_NUMBER_OF_THREADS_RUNNING_THE_SCRIPT_WITH_THIS_HASH("tuneables_processing"_J) > 0)
+			if (m_initialized)
 				continue;
 
 			if (!m_script_started)
 			{
+				if (SCRIPT::GET_NUMBER_OF_THREADS_RUNNING_THE_SCRIPT_WITH_THIS_HASH("tuneables_processing"_J) > 0)
+					continue;
+
 				SCRIPT::REQUEST_SCRIPT_WITH_NAME_HASH("tuneables_processing"_J);
 				SCRIPT::REQUEST_SCRIPT_WITH_NAME_HASH("tunables_registration"_J);
 
-				if (SCRIPT::HAS_SCRIPT_WITH_NAME_HASH_LOADED("tuneables_processing"_J) && SCRIPT::HAS_SCRIPT_WITH_NAME_HASH_LOADED("tunables_registration"_J))
-				{
-					m_num_tunables = gta_util::find_script_program("tunables_registration"_J)->m_global_count - TUNABLE_BASE_ADDRESS;
+				if (!SCRIPT::HAS_SCRIPT_WITH_NAME_HASH_LOADED("tuneables_processing"_J) || !SCRIPT::HAS_SCRIPT_WITH_NAME_HASH_LOADED("tunables_registration"_J))
+					continue;
 
-					uint64_t args[] = {6, 27}; // TODO: check args
+				const auto processing   = gta_util::find_script_program("tuneables_processing"_J);
+				const auto registration = gta_util::find_script_program("tunables_registration"_J);
 
-					int id = SYSTEM::START_NEW_SCRIPT_WITH_NAME_HASH_AND_ARGS("tuneables_processing"_J, (Any*)args, sizeof(args) / 8, DEFAULT_STACK_SIZE);
+				// the cache is versioned by the scripts that define the tunables rather than the game build,
+				// so it survives game updates that don't touch them
+				const auto version   = get_bytecode_version(processing, registration);
+				m_registration_sites = get_registration_sites(processing);
 
-					if (!id)
-					{
-						LOG(FATAL) << "Failed to start tuneables_processing. Cannot cache tunables";
-						return;
-					}
+				m_cache_file.load();
+				const auto up_to_date = m_cache_file.up_to_date(version);
+				if (m_cache_file.cache_version_matches())
+					load(up_to_date);
+
+				if (up_to_date && !m_tunables.empty())
+				{
+					LOG(INFO) << "Loaded " << m_tunables.size() << " tunables from cache";
+					release_scripts();
+					m_initialized = true;
+					continue;
+				}
+
+				m_num_tunables = registration->m_global_count - TUNABLE_BASE_ADDRESS;
 
-					m_tunables_backup = std::make_unique<std::uint64_t[]>(m_num_tunables);
-					memcpy(m_tunables_backup.get(), script_global(TUNABLE_BASE_ADDRESS).as<void*>(), m_num_tunables * 8);
+				uint64_t args[] = {6, 27}; // TODO: check args
 
-					SCRIPT::SET_SCRIPT_WITH_NAME_HASH_AS_NO_LONGER_NEEDED("tuneables_processing"_J);
-					SCRIPT::SET_SCRIPT_WITH_NAME_HASH_AS_NO_LONGER_NEEDED("tunables_registration"_J);
-					m_script_started = true;
+				int id = SYSTEM::START_NEW_SCRIPT_WITH_NAME_HASH_AND_ARGS("tuneables_processing"_J, (Any*)args, sizeof(args) / 8, DEFAULT_STACK_SIZE);
+
+				if (!id)
+				{
+					LOG(FATAL) << "Failed to start tuneables_processing. Cannot cache tunables";
+					return;
 				}
+
+				m_tunables_backup = std::make_unique<std::uint64_t[]>(m_num_tunables);
+				memcpy(m_tunables_backup.get(), script_global(TUNABLE_BASE_ADDRESS).as<void*>(), m_num_tunables * 8);
+
+				release_scripts();
+				m_cache_file.set_header_version(version);
+				m_script_started = true;
 			}
 			else
 			{
 				if (SCRIPT::GET_NUMBER_OF_THREADS_RUNNING_THE_SCRIPT_WITH_THIS_HASH("tuneables_processing"_J) == 0)
 				{
+					// junk values are handed out sequentially, so finding them is a range check per global instead of a lookup
+					const auto globals = script_global(TUNABLE_BASE_ADDRESS).as<std::int64_t*>();
 					for (int i = 0; i < m_num_tunables; i++)
 					{
-						auto value = *script_global(TUNABLE_BASE_ADDRESS).at(i).as<int*>();
-						if (auto it = m_junk_values.find(value); it != m_junk_values.end())
-						{
-							m_tunables.emplace(it->second, TUNABLE_BASE_ADDRESS + i);
-						}
+						const auto index = static_cast<uint32_t>(*reinterpret_cast<int*>(&globals[i])) - junk_base;
+						if (index < m_junk_values.size())
+							m_tunables.emplace(m_junk_values[index], TUNABLE_BASE_ADDRESS + i);
 					}
-					memcpy(script_global(TUNABLE_BASE_ADDRESS).as<void*>(), m_tunables_backup.get(), m_num_tunables * 8);
+					memcpy(globals, m_tunables_backup.get(), m_num_tunables * 8);
 
 					if (m_tunables.size() == 0)
 					{
@@ -92,16 +156,62 @@ namespace big
 						return;
 					}
 
+					LOG(INFO) << "Discovered " << m_junk_values.size() << " tunables, saving " << m_tunables.size() << " tunables to cache";
+
 					m_script_started = false;
 					m_initialized    = true;
-					LOG(INFO) << "Saving " << m_tunables.size() << " tunables to cache";
-					m_tunables_backup.release();
+					m_tunables_backup.reset();
+					m_junk_values.clear();
 					save();
 				}
 			}
 		}
 	}
 
+	std::optional<int> tunables_service::get_junk_value(rage::joaat_t hash)
+	{
+		if (m_tunables.contains(hash))
+			return std::nullopt;
+
+		m_junk_values.push_back(hash);
+		return junk_base + static_cast<int>(m_junk_values.size() - 1);
+	}
+
+	tunables_service::registration_sites_t tunables_service::get_registration_sites(const rage::scrProgram* program)
+	{
+		const auto code = copy_code(program);
+
+		registration_sites_t sites;
+		for (std::size_t i = 0; i + 1 + sizeof(rage::joaat_t) <= code.size(); i++)
+		{
+			if (code[i] != push_const_u32)
+				continue;
+
+			rage::joaat_t hash;
+			std::memcpy(&hash, &code[i + 1], sizeof(hash));
+
+			const auto size     = std::min(registration_site_size, code.size() - i);
+			const auto checksum = static_cast<uint32_t>(fnv1a(&code[i], size)) | 1;
+
+			if (const auto [it, inserted] = sites.emplace(hash, checksum); !inserted)
+				it->second = 0;
+		}
+
+		return sites;
+	}
+
+	std::vector<rage::joaat_t> tunables_service::validate(std::span<const tunable_save_struct> cached, const registration_sites_t& sites)
+	{
+		std::vector<rage::joaat_t> moved;
+		for (const auto& tunable : cached)
+		{
+			if (const auto it = sites.find(tunable.hash); it == sites.end() || it->second == 0 || it->second != tunable.site)
+				moved.push_back(tunable.hash);
+		}
+
+		return moved;
+	}
+
 	void tunables_service::save()
 	{
 		auto data_size = sizeof(uint32_t) + sizeof(tunable_save_struct) * m_tunables.size();
@@ -116,29 +226,70 @@ namespace big
 			auto save_struct    = (tunable_save_struct*)data_ptr;
 			save_struct->hash   = hash;
 			save_struct->offset = val;
+			save_struct->site   = m_registration_sites.contains(hash) ? m_registration_sites[hash] : 0;
 			data_ptr += sizeof(tunable_save_struct);
 		}
 
-		m_cache_file.set_header_version(memory::module("GTA5.exe").timestamp());
+		m_registration_sites.clear();
+
 		m_cache_file.set_data(std::move(data), data_size);
 		m_cache_file.write();
 	}
 
-	void tunables_service::load()
+	void tunables_service::load(bool up_to_date)
 	{
 		auto data = m_cache_file.data();
+		if (m_cache_file.data_size() < sizeof(uint32_t))
+			return;
 
 		auto num_tunables = *(uint32_t*)data;
 		data += sizeof(uint32_t);
 
-		for (int i = 0; i < num_tunables; i++)
+		if (m_cache_file.data_size() < sizeof(uint32_t) + num_tunables * sizeof(tunable_save_struct))
+			return;
+
+		const std::span cached(reinterpret_cast<const tunable_save_struct*>(data), num_tunables);
+
+		std::unordered_set<rage::joaat_t> moved;
+		if (!up_to_date)
 		{
-			auto save_struct = (tunable_save_struct*)data;
-			m_tunables.emplace(save_struct->hash, save_struct->offset);
-			data += sizeof(tunable_save_struct);
+			const auto invalid = validate(cached, m_registration_sites);
+			moved.insert(invalid.begin(), invalid.end());
+
+			LOG(INFO) << "Tunables changed, keeping " << cached.size() - moved.size() << " of " << cached.size() << " cached tunables";
 		}
 
-		m_initialized = true;
-		m_loading     = false;
+		for (const auto& tunable : cached)
+			if (!moved.contains(tunable.hash))
+				m_tunables.emplace(tunable.hash, tunable.offset);
+	}
+
+	void tunables_service::release_scripts()
+	{
+		SCRIPT::SET_SCRIPT_WITH_NAME_HASH_AS_NO_LONGER_NEEDED("tuneables_processing"_J);
+		SCRIPT::SET_SCRIPT_WITH_NAME_HASH_AS_NO_LONGER_NEEDED("tunables_registration"_J);
+	}
+
+	void tunables_service::refresh_handles()
+	{
+		// the game allocates the block again when it re-registers the tunables, e.g. on session changes,
+		// and frees it in between, resolve_handles() nulls the handles while it's gone
+		if (m_initialized && g_pointers->m_gta.m_script_globals[TUNABLE_BASE_ADDRESS >> 0x12] != m_resolved_block)
+			resolve_handles();
+	}
+
+	void tunables_service::resolve_handles()
+	{
+		m_resolved_block = g_pointers->m_gta.m_script_globals[TUNABLE_BASE_ADDRESS >> 0x12];
+
+		for (auto handle = g_tunable_handles; handle; handle = handle->m_next)
+		{
+			handle->m_address = m_resolved_block ? get_tunable<void*>(handle->m_hash) : nullptr;
+
+			if (handle->m_address)
+				handle->on_resolved();
+			else if (m_resolved_block)
+				LOG(WARNING) << "Tunable 0x" << HEX_TO_UPPER(handle->m_hash) << " not found.";
+		}
 	}
-}
+}
\ No newline at end of file
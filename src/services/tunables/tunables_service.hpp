@@ -4,6 +4,13 @@
 #include "services/gta_data/cache_file.hpp"
 #include "script_global.hpp"
 
+#include <span>
+
+namespace rage
+{
+	class scrProgram;
+}
+
 namespace big
 {
 	constexpr int TUNABLE_BASE_ADDRESS = 0x40001; // This never changes
@@ -13,9 +20,85 @@ namespace big
 	{
 		rage::joaat_t hash;
 		uint32_t offset;
+		// checksum of the code that registers the tunable, see tunables_service::get_registration_sites()
+		uint32_t site;
 	};
 #pragma pack(pop)
 
+	// Base of the tunable<T> handles, every handle is linked into g_tunable_handles so the service can resolve them.
+	class tunable_handle_base
+	{
+	public:
+		explicit tunable_handle_base(rage::joaat_t hash);
+		virtual ~tunable_handle_base();
+
+		tunable_handle_base(const tunable_handle_base&)            = delete;
+		tunable_handle_base& operator=(const tunable_handle_base&) = delete;
+
+		rage::joaat_t hash() const
+		{
+			return m_hash;
+		}
+
+		explicit operator bool() const
+		{
+			return m_address != nullptr;
+		}
+
+	protected:
+		friend class tunables_service;
+
+		// called by the service after m_address has been (re)resolved to a valid tunable
+		virtual void on_resolved() = 0;
+
+		rage::joaat_t m_hash;
+		void* m_address             = nullptr;
+		tunable_handle_base* m_next = nullptr;
+	};
+
+	inline constinit tunable_handle_base* g_tunable_handles = nullptr;
+
+	// A tunable that is looked up once instead of on every access, meant to be declared statically by features that touch
+	// a tunable every tick. The service resolves it to a raw pointer once it knows the tunable offsets and again whenever the
+	// tunables are re-registered, until then get() returns nullptr and writes are held back.
+	template<typename T>
+	class tunable final : public tunable_handle_base
+	{
+	public:
+		using tunable_handle_base::tunable_handle_base;
+
+		T* get() const
+		{
+			return static_cast<T*>(m_address);
+		}
+
+		T& operator*() const
+		{
+			return *get();
+		}
+
+		// stores the value right away if resolved, otherwise once the tunable is resolved
+		void set(T value)
+		{
+			if (const auto address = get())
+				*address = value;
+			else
+				m_pending = value;
+		}
+
+	private:
+		void on_resolved() override
+		{
+			if (m_pending)
+			{
+				*get() = *m_pending;
+				m_pending.reset();
+			}
+		}
+
+		std::optional<T> m_pending;
+	};
+
 	class tunables_service
 	{
 	public:
@@ -23,6 +106,10 @@ namespace big
 		~tunables_service();
 		void run_script();
 
+		// resolves the tunable handles again if the tunables block moved, called by script_mgr before any script ticks
+		// so that no looped command writes through a handle into a block the game has already freed
+		void refresh_handles();
+
 		inline bool caching_tunables()
 		{
 			return m_script_started;
@@ -86,12 +173,32 @@ namespace big
 			return 0;
 		}
 
-		int m_current_junk_val = 0x1000000;
-		std::unordered_map<int, rage::joaat_t> m_junk_values{};
+		/**
+		 * \brief Called by the registration native hooks while tuneables_processing runs for us.
+		 * \return the value the native should return so the global it is stored in can be found, std::nullopt if the tunable is already known
+		 */
+		std::optional<int> get_junk_value(rage::joaat_t hash);
+
+		// tunable hash -> checksum of the code that registers it, 0 if the hash is pushed more than once and can't be told apart
+		using registration_sites_t = std::unordered_map<rage::joaat_t, uint32_t>;
+
+		// Finds where tuneables_processing registers each tunable by the hash constants in its bytecode.
+		static registration_sites_t get_registration_sites(const rage::scrProgram* program);
+
+		/**
+		 * \brief Checks cached tunables against the current bytecode without running any script or touching the globals.
+		 * \return the hashes of the tunables whose registration code changed and that have to be discovered again
+		 */
+		static std::vector<rage::joaat_t> validate(std::span<const tunable_save_struct> cached, const registration_sites_t& sites);
 
 	private:
+		static constexpr int junk_base = 0x1000000;
+
+		// tunable hash by junk value - junk_base
+		std::vector<rage::joaat_t> m_junk_values;
+		registration_sites_t m_registration_sites;
+
 		bool m_initialized    = false;
-		bool m_loading        = false;
 		bool m_script_started = false;
 
 		cache_file m_cache_file;
@@ -100,8 +207,14 @@ namespace big
 		std::unique_ptr<uint64_t[]> m_tunables_backup; 
 		int m_num_tunables;
 
+		// the tunables block the handles were last resolved against
+		void* m_resolved_block = nullptr;
+
 		void save();
-		void load();
+		// loads the cached tunables, only those whose registration didn't move unless the cache is up to date
+		void load(bool up_to_date);
+		void release_scripts();
+		void resolve_handles();
 	};
 
 	inline tunables_service* g_tunables_service;
@@ -3,6 +3,7 @@
 #include "base/CObject.hpp"
 #include "pointers.hpp"
 #include "script_function.hpp"
+#include "services/streaming/model_streaming_service.hpp"
 #include "util/misc.hpp"
 #include "util/vehicle.hpp"
 #include "util/pools.hpp"
@@ -114,8 +115,36 @@ namespace big
 		return spawn_vehicle_full(get_full_vehicle_json(vehicle), ped);
 	}
 
+	void persist_car_service::collect_models(const nlohmann::json& vehicle_json, std::vector<Hash>& models)
+	{
+		if (!vehicle_json.is_object())
+			return;
+
+		if (const auto it = vehicle_json.find(vehicle_model_hash_key); it != vehicle_json.end())
+			models.push_back(it->get<Hash>());
+
+		if (const auto it = vehicle_json.find(model_attachments_key); it != vehicle_json.end() && it->is_array())
+			for (const auto& j : *it)
+				models.push_back(j.get<model_attachment>().model_hash);
+
+		if (const auto it = vehicle_json.find(vehicle_attachments_key); it != vehicle_json.end() && it->is_array())
+			for (const auto& j : *it)
+				if (j.contains(vehicle_key))
+					collect_models(j[vehicle_key], models);
+
+		for (const auto key : {tow_key, trailer_key})
+			if (const auto it = vehicle_json.find(key); it != vehicle_json.end())
+				collect_models(*it, models);
+	}
+
 	Vehicle persist_car_service::spawn_vehicle_full(nlohmann::json vehicle_json, Ped ped, const std::optional<Vector3>& spawn_coords)
 	{
+		// stream every part of the vehicle at once instead of one model per spawn call
+		std::vector<Hash> models;
+		collect_models(vehicle_json, models);
+		const auto handles = g_model_streaming_service.prefetch(models);
+		model_streaming_service::wait_all(handles);
+
 		const auto vehicle = spawn_vehicle(vehicle_json, ped, spawn_coords);
 
 		if (!vehicle_json[tow_key].is_null())
@@ -67,6 +67,8 @@ namespace big
 		static constexpr auto clan_logo_key = "clan_logo";
 
 
+		static void collect_models(const nlohmann::json& vehicle_json, std::vector<Hash>& models);
+
 		static Vehicle spawn_vehicle_full(nlohmann::json vehicle_json, Ped ped, const std::optional<Vector3>& spawn_coords = std::nullopt);
 		static Vehicle spawn_vehicle(nlohmann::json vehicle_json, Ped ped, const std::optional<Vector3>& spawn_coords);
 		static Vehicle spawn_vehicle_json(nlohmann::json vehicle_json, Ped ped, const std::optional<Vector3>& spawn_coords = std::nullopt, bool is_preview = false);
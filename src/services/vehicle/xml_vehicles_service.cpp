@@ -21,28 +21,15 @@ namespace big
 
 	void xml_vehicles_service::fetch_xml_files()
 	{
-		auto folder_path = g_file_manager.get_project_folder("xml_vehicles").get_path();
+		m_library.refresh();
+	}
 
-		try
-		{
-			for (const auto& entry : std::filesystem::directory_iterator(folder_path))
-			{
-				if (entry.path().extension() == ".xml")
-				{
-					pugi::xml_document doc;
-					pugi::xml_parse_result result = doc.load_file(entry.path().c_str());
+	Vehicle xml_vehicles_service::spawn_from_xml(const std::string& name, Vector3 pos)
+	{
+		if (const auto doc = m_library.load(name))
+			return spawn_from_xml(*doc, pos);
 
-					if (result)
-						m_all_xml_vehicles.emplace(std::pair<std::string, pugi::xml_document>(entry.path().filename().generic_string(), std::move(doc)));
-					else
-						LOG(WARNING) << "Failed to load XML file: " << entry.path().filename().string() << std::endl;
-				}
-			}
-		}
-		catch (const std::exception& e)
-		{
-			LOG(WARNING) << "Failed fetching XML vehicles: " << e.what() << std::endl;
-		}
+		return 0;
 	}
 
 	void apply_vehicle_properties(Vehicle vehicle_handle, pugi::xml_node vehicle_node)
@@ -1,4 +1,5 @@
 #include "pugixml.hpp"
+#include "services/xml_library/xml_library.hpp"
 
 #include <filesystem>
 #include <iostream>
@@ -10,9 +11,10 @@ namespace big
 	public:
 		xml_vehicles_service();
 		~xml_vehicles_service();
-		std::map<std::string, pugi::xml_document> m_all_xml_vehicles;
+		xml_library m_library{"xml_vehicles"};
 
 		void fetch_xml_files();
+		Vehicle spawn_from_xml(const std::string& name, Vector3);
 		Vehicle spawn_from_xml(pugi::xml_document&, Vector3);
 	};
 
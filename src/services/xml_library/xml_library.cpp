@@ -0,0 +1,251 @@
+#include "xml_library.hpp"
+
+#include "file_manager.hpp"
+#include "thread_pool.hpp"
+
+namespace big
+{
+	static constexpr int index_version = 1;
+
+	namespace
+	{
+		// clears the flag when it goes out of scope, also when the code in between throws
+		struct flag_guard
+		{
+			std::atomic_bool& m_flag;
+
+			~flag_guard()
+			{
+				m_flag = false;
+			}
+		};
+	}
+
+	xml_library::xml_library(std::string folder_name) :
+	    m_state(std::make_shared<state>())
+	{
+		m_state->m_folder_name = std::move(folder_name);
+		m_state->m_entries     = std::make_shared<const entries_t>();
+	}
+
+	void xml_library::refresh()
+	{
+		m_state->m_refresh_pending = true;
+		if (m_state->m_refreshing.exchange(true))
+			return;
+
+		g_thread_pool->push([state = m_state] {
+			do
+			{
+				flag_guard guard{state->m_refreshing};
+
+				while (state->m_refresh_pending.exchange(false))
+					rebuild(*state);
+			}
+			// a refresh requested after the last check saw m_refreshing still set and left it to this task
+			while (state->m_refresh_pending && !state->m_refreshing.exchange(true));
+		});
+	}
+
+	std::shared_ptr<const xml_library::entries_t> xml_library::entries() const
+	{
+		return get_entries(*m_state);
+	}
+
+	std::shared_ptr<const xml_library::entries_t> xml_library::get_entries(const state& state)
+	{
+		std::lock_guard lock(state.m_entries_mutex);
+		return state.m_entries;
+	}
+
+	std::shared_ptr<pugi::xml_document> xml_library::load(const std::string& name)
+	{
+		auto& state = *m_state;
+
+		{
+			std::lock_guard lock(state.m_documents_mutex);
+			for (auto it = state.m_documents.begin(); it != state.m_documents.end(); ++it)
+			{
+				if (it->first == name)
+				{
+					state.m_documents.splice(state.m_documents.begin(), state.m_documents, it);
+					return it->second;
+				}
+			}
+		}
+
+		const auto path = g_file_manager.get_project_folder(state.m_folder_name).get_path() / name;
+
+		auto doc = std::make_shared<pugi::xml_document>();
+		if (const auto result = doc->load_file(path.c_str()); !result)
+		{
+			LOG(WARNING) << "Failed to load XML file: " << name << " " << result.description();
+			return nullptr;
+		}
+
+		std::lock_guard lock(state.m_documents_mutex);
+		state.m_documents.emplace_front(name, doc);
+		if (state.m_documents.size() > max_cached_documents)
+			state.m_documents.pop_back();
+
+		return doc;
+	}
+
+	void xml_library::load_index(state& state)
+	{
+		const auto file = g_file_manager.get_project_file(std::format("./cache/{}_index.json", state.m_folder_name));
+		if (!file.exists())
+			return;
+
+		try
+		{
+			std::ifstream stream(file.get_path());
+			const auto json = nlohmann::json::parse(stream);
+			if (json["version"] != index_version)
+				return;
+
+			auto entries = std::make_shared<entries_t>();
+			for (const auto& item : json["entries"])
+				entries->push_back({item["name"].get<std::string>(),
+				    item["size"].get<std::uintmax_t>(),
+				    item["last_write"].get<std::int64_t>(),
+				    item["entity_count"].get<int>()});
+
+			std::lock_guard lock(state.m_entries_mutex);
+			state.m_entries = std::move(entries);
+		}
+		catch (const std::exception& e)
+		{
+			LOG(WARNING) << "Failed to load " << state.m_folder_name << " index: " << e.what();
+		}
+	}
+
+	void xml_library::save_index(const state& state, const entries_t& entries)
+	{
+		nlohmann::json json;
+		json["version"] = index_version;
+		json["entries"] = nlohmann::json::array();
+
+		for (const auto& entry : entries)
+			json["entries"].push_back({{"name", entry.m_name}, {"size", entry.m_size}, {"last_write", entry.m_last_write}, {"entity_count", entry.m_entity_count}});
+
+		std::ofstream stream(g_file_manager.get_project_file(std::format("./cache/{}_index.json", state.m_folder_name)).get_path(),
+		    std::ios::out | std::ios::trunc);
+		stream << json;
+	}
+
+	void xml_library::rebuild(state& state)
+	{
+		if (!state.m_index_loaded)
+		{
+			// show what we had last session right away, the folder walk below corrects it
+			load_index(state);
+			state.m_index_loaded = true;
+		}
+
+		const auto previous = get_entries(state);
+		std::unordered_map<std::string_view, const xml_library_entry*> known;
+		for (const auto& entry : *previous)
+			known.emplace(entry.m_name, &entry);
+
+		const auto folder_path = g_file_manager.get_project_folder(state.m_folder_name).get_path();
+
+		entries_t entries;
+		try
+		{
+			for (const auto& file : std::filesystem::directory_iterator(folder_path))
+			{
+				if (file.path().extension() != ".xml")
+					continue;
+
+				xml_library_entry entry{file.path().filename().generic_string(), file.file_size(), file.last_write_time().time_since_epoch().count()};
+
+				if (const auto it = known.find(entry.m_name); it != known.end() && it->second->m_size == entry.m_size
+				    && it->second->m_last_write == entry.m_last_write)
+					entry.m_entity_count = it->second->m_entity_count;
+
+				entries.push_back(std::move(entry));
+			}
+		}
+		catch (const std::exception& e)
+		{
+			LOG(WARNING) << "Failed fetching " << state.m_folder_name << ": " << e.what();
+			return;
+		}
+
+		std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+			return a.m_name < b.m_name;
+		});
+
+		const auto publish = [&state, &entries] {
+			auto snapshot = std::make_shared<const entries_t>(entries);
+			std::lock_guard lock(state.m_entries_mutex);
+			state.m_entries = std::move(snapshot);
+		};
+
+		// list the files before counting anything so that large folders show up instantly
+		publish();
+
+		{
+			std::lock_guard lock(state.m_documents_mutex);
+			state.m_documents.clear();
+		}
+
+		bool changed = entries.size() != previous->size();
+		for (auto& entry : entries)
+		{
+			if (entry.m_entity_count != -1)
+				continue;
+
+			entry.m_entity_count = count_entities(folder_path / entry.m_name);
+			changed              = true;
+		}
+
+		if (changed)
+		{
+			publish();
+			save_index(state, entries);
+		}
+	}
+
+	int xml_library::count_entities(const std::filesystem::path& path)
+	{
+		// not a full parse, only counts the opening tags of the element every entity has
+		static constexpr std::string_view tag = "<ModelHash";
+
+		std::ifstream stream(path, std::ios::binary);
+		if (!stream)
+			return 0;
+
+		std::array<char, 64 * 1024> buffer;
+		std::size_t carried = 0;
+		int count           = 0;
+
+		while (stream)
+		{
+			stream.read(buffer.data() + carried, buffer.size() - carried);
+			const auto size = carried + static_cast<std::size_t>(stream.gcount());
+			const std::string_view chunk(buffer.data(), size);
+
+			std::size_t pos = 0;
+			while ((pos = chunk.find(tag, pos)) != std::string_view::npos)
+			{
+				if (pos + tag.size() >= chunk.size())
+					break;
+
+				if (const auto next = chunk[pos + tag.size()]; next == '>' || next == '/' || std::isspace(static_cast<unsigned char>(next)))
+					count++;
+				pos += tag.size();
+			}
+
+			// keep the tail around in case a tag is split between two reads
+			carried = std::min(size, tag.size());
+			std::memmove(buffer.data(), buffer.data() + size - carried, carried);
+
+			if (static_cast<std::size_t>(stream.gcount()) == 0)
+				break;
+		}
+
+		return count;
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include "pugixml.hpp"
+
+#include <filesystem>
+#include <list>
+
+namespace big
+{
+	struct xml_library_entry
+	{
+		std::string m_name;
+		std::uintmax_t m_size;
+		std::int64_t m_last_write;
+		// number of entities (ModelHash elements) in the file, -1 until the background scan got to it
+		int m_entity_count = -1;
+	};
+
+	// Index of a folder of Menyoo style XML files. Listing a folder only stats the files and counts their entities
+	// with a streaming scan on the thread pool, the index is persisted between sessions so unchanged files aren't scanned twice.
+	// Documents are only parsed when they are needed and a few recently used ones are kept around.
+	class xml_library
+	{
+	public:
+		static constexpr std::size_t max_cached_documents = 4;
+
+		using entries_t = std::vector<xml_library_entry>;
+
+		explicit xml_library(std::string folder_name);
+
+		// Rescans the folder in the background, entries() keeps returning the previous index until it is done.
+		// Calling it while a rescan is running queues one more rescan after it.
+		void refresh();
+
+		// sorted by name, safe to iterate from any thread
+		[[nodiscard]] std::shared_ptr<const entries_t> entries() const;
+
+		[[nodiscard]] bool is_refreshing() const
+		{
+			return m_state->m_refreshing;
+		}
+
+		/**
+		 * \brief Parses the file or returns it from the cache of recently used documents.
+		 * \return nullptr if the file couldn't be parsed
+		 */
+		[[nodiscard]] std::shared_ptr<pugi::xml_document> load(const std::string& name);
+
+	private:
+		// everything a background refresh touches, owned jointly by the library and the refresh task
+		// so that a refresh still running when the library goes away doesn't write into freed memory
+		struct state
+		{
+			std::string m_folder_name;
+
+			mutable std::mutex m_entries_mutex;
+			std::shared_ptr<const entries_t> m_entries;
+			std::atomic_bool m_refreshing      = false;
+			std::atomic_bool m_refresh_pending = false;
+			bool m_index_loaded                = false;
+
+			std::mutex m_documents_mutex;
+			// most recently used first
+			std::list<std::pair<std::string, std::shared_ptr<pugi::xml_document>>> m_documents;
+		};
+
+		static std::shared_ptr<const entries_t> get_entries(const state& state);
+		static void load_index(state& state);
+		static void save_index(const state& state, const entries_t& entries);
+		static void rebuild(state& state);
+
+		static int count_entities(const std::filesystem::path& path);
+
+		std::shared_ptr<state> m_state;
+	};
+}
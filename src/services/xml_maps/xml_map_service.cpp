@@ -19,28 +19,13 @@ namespace big
 
 	void xml_map_service::fetch_xml_files()
 	{
-		auto folder_path = g_file_manager.get_project_folder("xml_maps").get_path();
-
-		try
-		{
-			for (const auto& entry : std::filesystem::directory_iterator(folder_path))
-			{
-				if (entry.path().extension() == ".xml")
-				{
-					pugi::xml_document doc;
-					pugi::xml_parse_result result = doc.load_file(entry.path().c_str());
+		m_library.refresh();
+	}
 
-					if (result)
-						m_all_xml_maps.emplace(std::pair<std::string, pugi::xml_document>(entry.path().filename().generic_string(), std::move(doc)));
-					else
-						LOG(WARNING) << "Failed to load XML file: " << entry.path().filename().string() << std::endl;
-				}
-			}
-		}
-		catch (const std::exception& e)
-		{
-			LOG(WARNING) << "Failed fetching XML maps: " << e.what() << std::endl;
-		}
+	void xml_map_service::spawn_from_xml(const std::string& name)
+	{
+		if (const auto doc = m_library.load(name))
+			spawn_from_xml(*doc);
 	}
 
 	void manage_ipls(pugi::xml_node unload, pugi::xml_node load)
@@ -1,4 +1,5 @@
 #include "pugixml.hpp"
+#include "services/xml_library/xml_library.hpp"
 #include <filesystem>
 #include <iostream>
 
@@ -10,9 +11,10 @@ namespace big
     public:
         xml_map_service();
         ~xml_map_service();
-        std::map<std::string, pugi::xml_document> m_all_xml_maps;
+        xml_library m_library{"xml_maps"};
 
         void fetch_xml_files();
+        void spawn_from_xml(const std::string& name);
         void spawn_from_xml(pugi::xml_document&);
     };
 
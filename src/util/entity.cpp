@@ -6,6 +6,7 @@
 #include "pools.hpp"
 #include "script.hpp"
 #include "services/players/player_service.hpp"
+#include "services/streaming/model_streaming_service.hpp"
 #include "packet.hpp"
 #include "gta/net_object_mgr.hpp"
 
@@ -56,6 +57,9 @@ namespace big::entity
 			return;
 		}
 
+		// the snapshot would still point at the deleted entities for the rest of the frame
+		g_pool_snapshot_service.invalidate();
+
 		if (auto ptr = g_pointers->m_gta.m_handle_to_ptr(ent))
 		{
 			if (ptr->m_net_object)
@@ -195,35 +199,33 @@ namespace big::entity
 
 		if (vehicles)
 		{
-			for (auto vehicle : pools::get_all_vehicles())
+			const auto local_vehicle = gta_util::get_local_vehicle();
+			const auto& snapshot     = g_pool_snapshot_service.vehicles();
+			for (std::size_t i = 0; i < snapshot.entities().size(); i++)
 			{
-				if (!vehicle || (!include_self_veh && vehicle == gta_util::get_local_vehicle()))
+				if (!include_self_veh && snapshot.entities()[i].m_pointer == local_vehicle)
 					continue;
 
-				target_entities.push_back(g_pointers->m_gta.m_ptr_to_handle(vehicle));
+				target_entities.push_back(snapshot.handle(i));
 			}
 		}
 
 		if (peds)
 		{
-			for (auto ped : pools::get_all_peds())
+			const auto& snapshot = g_pool_snapshot_service.peds();
+			for (std::size_t i = 0; i < snapshot.entities().size(); i++)
 			{
-				if (!ped || ped == g_local_player)
+				if (snapshot.entities()[i].m_pointer == g_local_player)
 					continue;
 
-				target_entities.push_back(g_pointers->m_gta.m_ptr_to_handle(ped));
+				target_entities.push_back(snapshot.handle(i));
 			}
 		}
 
 		if (props)
 		{
-			for (auto prop : pools::get_all_props())
-			{
-				if (!prop)
-					continue;
-
-				target_entities.push_back(g_pointers->m_gta.m_ptr_to_handle(prop));
-			}
+			const auto handles = g_pool_snapshot_service.props().handles();
+			target_entities.insert(target_entities.end(), handles.begin(), handles.end());
 		}
 		return target_entities;
 	}
@@ -271,30 +273,8 @@ namespace big::entity
 
 	bool request_model(rage::joaat_t hash)
 	{
-		if (STREAMING::HAS_MODEL_LOADED(hash))
-		{
-			return true;
-		}
-
-		bool has_loaded;
-
-		if (STREAMING::IS_MODEL_VALID(hash) && STREAMING::IS_MODEL_IN_CDIMAGE(hash))
-		{
-			do
-			{
-				has_loaded = STREAMING::HAS_MODEL_LOADED(hash);
-				if (has_loaded)
-					break;
-
-				STREAMING::REQUEST_MODEL(hash);
-
-				script::get_current()->yield();
-			} while (!has_loaded);
-
-			return true;
-		}
-
-		return false;
+		// the model stays resident in the streaming service's idle list after the handle goes away
+		return g_model_streaming_service.acquire(hash).wait();
 	}
 
 	double distance_to_middle_of_screen(const rage::fvector2& screen_pos)
@@ -429,7 +409,12 @@ namespace big::entity
 		}
 
 		if (delete_locally)
+		{
 			if (auto object = (*g_pointers->m_gta.m_network_object_mgr)->find_object_by_id(net_id, true))
+			{
 				(*g_pointers->m_gta.m_network_object_mgr)->UnregisterNetworkObject(object, 8, true, true);
+				g_pool_snapshot_service.invalidate();
+			}
+		}
 	}
 }
@@ -0,0 +1,200 @@
+#pragma once
+#include "gta/enums.hpp"
+#include "gta/net_game_event.hpp"
+
+namespace big
+{
+	inline bool try_read_secondary_header(rage::datBitBuffer& buffer)
+	{
+		auto data = buffer.Read<std::uint32_t>(20);
+		return data == 0x8C253 || data == 0x8924F;
+	}
+
+	inline bool get_msg_type(rage::eNetMessage& msgType, rage::datBitBuffer& buffer)
+	{
+		uint32_t pos;
+		uint32_t magic;
+		uint32_t length;
+		uint32_t extended{};
+		if ((buffer.m_flagBits & 2) != 0 || (buffer.m_flagBits & 1) == 0 ? (pos = buffer.m_curBit) : (pos = buffer.m_maxBit),
+		    buffer.m_bitsRead + 15 > pos || !buffer.ReadDword(&magic, 14) || magic != 0x3246 || !buffer.ReadDword(&extended, 1))
+		{
+			msgType = rage::eNetMessage::MsgInvalid;
+			return false;
+		}
+		length = extended ? 16 : 8;
+		if ((buffer.m_flagBits & 1) == 0 ? (pos = buffer.m_curBit) : (pos = buffer.m_maxBit),
+		    length + buffer.m_bitsRead <= pos && buffer.ReadDword((uint32_t*)&msgType, length))
+			return true;
+		else
+			return false;
+	}
+
+	// Points buffer at the message body and reads the message type, skipping the secondary header if there is one.
+	inline bool read_net_message_header(rage::datBitBuffer& buffer, void* message_data, uint32_t message_size, rage::eNetMessage& msgType)
+	{
+		buffer            = rage::datBitBuffer(message_data, message_size);
+		buffer.m_flagBits = 1;
+
+		if (try_read_secondary_header(buffer))
+		{
+			buffer            = rage::datBitBuffer(((char*)message_data) + 7, message_size - 7);
+			buffer.m_flagBits = 1;
+		}
+		else
+		{
+			buffer.Seek(0);
+		}
+
+		return get_msg_type(msgType, buffer);
+	}
+
+	inline bool is_valid_sync_object_type(eNetObjType object_type)
+	{
+		return object_type >= eNetObjType::NET_OBJ_TYPE_AUTOMOBILE && object_type <= eNetObjType::NET_OBJ_TYPE_TRAIN;
+	}
+
+	// The payload checks of the receive_net_message protections. The net capture replay goes through the same ones, so
+	// everything that only depends on the message itself lives here, checks that need session state stay in the hook.
+	// block_reason() is nullptr when the message passes.
+
+	struct msg_kick_player
+	{
+		KickReason m_reason;
+
+		explicit msg_kick_player(rage::datBitBuffer& buffer) :
+		    m_reason(buffer.Read<KickReason>(3))
+		{
+		}
+
+		[[nodiscard]] const char* block_reason() const
+		{
+			return m_reason == KickReason::VOTED_OUT ? "we have been voted out" : nullptr;
+		}
+	};
+
+	struct msg_roaming_join_bubble_ack
+	{
+		int m_status;
+		int m_bubble;
+
+		explicit msg_roaming_join_bubble_ack(rage::datBitBuffer& buffer) :
+		    m_status(buffer.Read<int>(2)),
+		    m_bubble(buffer.Read<int>(4))
+		{
+		}
+
+		[[nodiscard]] bool is_null_bubble() const
+		{
+			return m_status == 0 && m_bubble == 10;
+		}
+
+		[[nodiscard]] const char* block_reason() const
+		{
+			if (is_null_bubble())
+				return "the bubble id is null";
+
+			if (m_status == 0)
+				return "joining their bubble is not a good idea";
+
+			return nullptr;
+		}
+	};
+
+	struct msg_roaming_initial_bubble
+	{
+		int m_my_bubble;
+		int m_my_pid;
+		int m_their_bubble;
+		int m_their_pid;
+
+		explicit msg_roaming_initial_bubble(rage::datBitBuffer& buffer) :
+		    m_my_bubble(buffer.Read<int>(4)),
+		    m_my_pid(buffer.Read<int>(6)),
+		    m_their_bubble(buffer.Read<int>(4)),
+		    m_their_pid(buffer.Read<int>(6))
+		{
+		}
+
+		[[nodiscard]] const char* block_reason() const
+		{
+			if (m_their_bubble == 10)
+				return "the host doesn't have a bubble";
+
+			if (m_my_bubble == 10)
+				return "the host didn't actually give us a valid bubble";
+
+			if (m_my_bubble > 10 || m_their_bubble > 10)
+				return "the host is trying to crash us by giving us an out of bounds bubble id";
+
+			if (m_my_bubble != m_their_bubble)
+				return "the host's bubble id doesn't match our bubble id";
+
+			if (m_my_pid == m_their_pid)
+				return "the host has the same player id as us";
+
+			return nullptr;
+		}
+	};
+
+	struct msg_non_physical_data
+	{
+		int m_bubble_id;
+		int m_player_id;
+
+		explicit msg_non_physical_data(rage::datBitBuffer& buffer)
+		{
+			buffer.Read<int>(7); // size
+			m_bubble_id = buffer.Read<int>(4);
+			m_player_id = buffer.Read<int>(6);
+		}
+
+		[[nodiscard]] const char* block_reason() const
+		{
+			if (m_bubble_id == 10)
+				return "they are not in a bubble";
+
+			if (m_bubble_id > 10)
+				return "they are trying to crash us by giving us an out of bounds bubble id";
+
+			if (m_player_id >= 32)
+				return "they have an invalid player id (or are trying to make us pick our own)";
+
+			return nullptr;
+		}
+	};
+
+	struct msg_inform_object_ids
+	{
+		int m_num_objects_in_our_range;
+
+		explicit msg_inform_object_ids(rage::datBitBuffer& buffer) :
+		    m_num_objects_in_our_range(buffer.Read<int>(13))
+		{
+		}
+
+		[[nodiscard]] const char* block_reason() const
+		{
+			if (m_num_objects_in_our_range > 256)
+				return "they have given us an unusual amount of occupied object IDs in our object range";
+
+			return nullptr;
+		}
+	};
+
+	// buffer has to point at the message body, as left by read_net_message_header
+	inline const char* get_net_message_block_reason(rage::eNetMessage type, rage::datBitBuffer& buffer)
+	{
+		switch (type)
+		{
+		case rage::eNetMessage::MsgKickPlayer: return msg_kick_player(buffer).block_reason();
+		case rage::eNetMessage::MsgRoamingJoinBubbleAck: return msg_roaming_join_bubble_ack(buffer).block_reason();
+		case rage::eNetMessage::MsgRoamingInitialBubble: return msg_roaming_initial_bubble(buffer).block_reason();
+		case rage::eNetMessage::MsgNonPhysicalData: return msg_non_physical_data(buffer).block_reason();
+		case rage::eNetMessage::MsgInformObjectIds: return msg_inform_object_ids(buffer).block_reason();
+		case rage::eNetMessage::MsgRequestKickFromHost:
+		case rage::eNetMessage::MsgConfigRequest: return "always denied";
+		default: return nullptr;
+		}
+	}
+}
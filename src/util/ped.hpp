@@ -6,6 +6,7 @@
 #include "outfit.hpp"
 #include "pointers.hpp"
 #include "services/players/player_service.hpp"
+#include "services/streaming/model_streaming_service.hpp"
 #include "script.hpp"
 
 namespace big::ped
@@ -447,12 +448,12 @@ namespace big::ped
 
 	inline bool change_player_model(const Hash hash)
 	{
-		if (entity::request_model(hash))
+		if (auto model = g_model_streaming_service.acquire(hash); model.wait())
 		{
 			self::ped = PLAYER::PLAYER_PED_ID();
 			PLAYER::SET_PLAYER_MODEL(self::id, hash);
 			script::get_current()->yield();
-			STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(hash);
+			model.release();
 			for (int i = 0; i < 12; i++)
 			{
 				PED::SET_PED_COMPONENT_VARIATION(self::ped, i, PED::GET_PED_DRAWABLE_VARIATION(self::ped, i), PED::GET_PED_TEXTURE_VARIATION(self::ped, i), PED::GET_PED_PALETTE_VARIATION(self::ped, i));
@@ -530,7 +531,7 @@ namespace big::ped
 
 	inline Ped spawn(ePedType pedType, Hash hash, Ped clone, Vector3 location, float heading, bool is_networked = true)
 	{
-		if (entity::request_model(hash))
+		if (auto model = g_model_streaming_service.acquire(hash); model.wait())
 		{
 			Ped ped = PED::CREATE_PED(pedType, hash, location.x, location.y, location.z, heading, is_networked, false);
 
@@ -541,7 +542,7 @@ namespace big::ped
 				clone_ped(clone, ped);
 		    }
 
-		    STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(hash);
+		    model.release();
 
 		    return ped;	
 		}
@@ -1,5 +1,6 @@
 #pragma once
 #include "gta/pools.hpp"
+#include "services/pool_snapshot/pool_snapshot_service.hpp"
 
 namespace big::pools
 {
@@ -18,18 +19,24 @@ namespace big::pools
 		return **g_pointers->m_gta.m_prop_pool;
 	}
 
-	inline auto get_all_peds_array()
+	// a copy of this frame's snapshot, see pool_snapshot_service
+	inline std::vector<Entity> get_all_peds_array()
 	{
-		return get_all_peds().to_array();
+		const auto handles = g_pool_snapshot_service.peds().handles();
+		return {handles.begin(), handles.end()};
 	}
 
-	inline auto get_all_vehicles_array()
+	// a copy of this frame's snapshot, see pool_snapshot_service
+	inline std::vector<Entity> get_all_vehicles_array()
 	{
-		return get_all_vehicles().to_array();
+		const auto handles = g_pool_snapshot_service.vehicles().handles();
+		return {handles.begin(), handles.end()};
 	}
 
-	inline auto get_all_props_array()
+	// a copy of this frame's snapshot, see pool_snapshot_service
+	inline std::vector<Entity> get_all_props_array()
 	{
-		return get_all_props().to_array();
+		const auto handles = g_pool_snapshot_service.props().handles();
+		return {handles.begin(), handles.end()};
 	}
 };
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+// Batched world to screen projection, kept free of game types so it can be checked on its own.
+namespace big::projection
+{
+	struct vec3
+	{
+		float x, y, z;
+	};
+
+	struct camera
+	{
+		vec3 position;
+		vec3 right;
+		vec3 forward;
+		vec3 up;
+		float x_scale; // 1 / (tan(fov / 2) * aspect ratio)
+		float y_scale; // 1 / tan(fov / 2)
+
+		// rotation is in degrees with rotation order 2, as returned by CAM::GET_FINAL_RENDERED_CAM_ROT
+		// fov is the vertical field of view in degrees, as returned by CAM::GET_FINAL_RENDERED_CAM_FOV
+		static camera from_rotation(vec3 position, vec3 rotation, float fov, float aspect_ratio)
+		{
+			constexpr float deg_to_rad = 3.14159265359f / 180.f;
+
+			const float pitch = rotation.x * deg_to_rad;
+			const float roll  = rotation.y * deg_to_rad;
+			const float yaw   = rotation.z * deg_to_rad;
+
+			camera cam{};
+			cam.position = position;
+			cam.forward  = {-std::sin(yaw) * std::cos(pitch), std::cos(yaw) * std::cos(pitch), std::sin(pitch)};
+
+			const vec3 flat_right = {std::cos(yaw), std::sin(yaw), 0.f};
+			const vec3 flat_up    = {
+			    flat_right.y * cam.forward.z - flat_right.z * cam.forward.y,
+			    flat_right.z * cam.forward.x - flat_right.x * cam.forward.z,
+			    flat_right.x * cam.forward.y - flat_right.y * cam.forward.x,
+			};
+
+			const float cos_roll = std::cos(roll);
+			const float sin_roll = std::sin(roll);
+			cam.right = {
+			    flat_right.x * cos_roll + flat_up.x * sin_roll,
+			    flat_right.y * cos_roll + flat_up.y * sin_roll,
+			    flat_right.z * cos_roll + flat_up.z * sin_roll,
+			};
+			cam.up = {
+			    flat_up.x * cos_roll - flat_right.x * sin_roll,
+			    flat_up.y * cos_roll - flat_right.y * sin_roll,
+			    flat_up.z * cos_roll - flat_right.z * sin_roll,
+			};
+
+			cam.y_scale = 1.f / std::tan(fov * deg_to_rad * 0.5f);
+			cam.x_scale = cam.y_scale / aspect_ratio;
+
+			return cam;
+		}
+	};
+
+	inline constexpr float near_plane = 0.05f;
+
+	// Projects count world positions stored as separate x, y and z arrays to normalized screen coordinates,
+	// (0, 0) being the top left corner and (1, 1) the bottom right one like GET_SCREEN_COORD_FROM_WORLD_COORD.
+	// in_front is set to 0 for positions behind the near plane, their screen coordinates are meaningless.
+	inline void project(const camera& cam, const float* x, const float* y, const float* z, float* screen_x, float* screen_y, std::uint8_t* in_front, std::size_t count)
+	{
+		std::size_t i = 0;
+
+		const __m128 pos_x   = _mm_set1_ps(cam.position.x);
+		const __m128 pos_y   = _mm_set1_ps(cam.position.y);
+		const __m128 pos_z   = _mm_set1_ps(cam.position.z);
+		const __m128 right_x = _mm_set1_ps(cam.right.x);
+		const __m128 right_y = _mm_set1_ps(cam.right.y);
+		const __m128 right_z = _mm_set1_ps(cam.right.z);
+		const __m128 fwd_x   = _mm_set1_ps(cam.forward.x);
+		const __m128 fwd_y   = _mm_set1_ps(cam.forward.y);
+		const __m128 fwd_z   = _mm_set1_ps(cam.forward.z);
+		const __m128 up_x    = _mm_set1_ps(cam.up.x);
+		const __m128 up_y    = _mm_set1_ps(cam.up.y);
+		const __m128 up_z    = _mm_set1_ps(cam.up.z);
+		const __m128 half_x  = _mm_set1_ps(0.5f * cam.x_scale);
+		const __m128 half_y  = _mm_set1_ps(-0.5f * cam.y_scale);
+		const __m128 half    = _mm_set1_ps(0.5f);
+		const __m128 near    = _mm_set1_ps(near_plane);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 dx = _mm_sub_ps(_mm_loadu_ps(x + i), pos_x);
+			const __m128 dy = _mm_sub_ps(_mm_loadu_ps(y + i), pos_y);
+			const __m128 dz = _mm_sub_ps(_mm_loadu_ps(z + i), pos_z);
+
+			const __m128 depth = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, fwd_x), _mm_mul_ps(dy, fwd_y)), _mm_mul_ps(dz, fwd_z));
+			const __m128 cam_x = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, right_x), _mm_mul_ps(dy, right_y)), _mm_mul_ps(dz, right_z));
+			const __m128 cam_y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, up_x), _mm_mul_ps(dy, up_y)), _mm_mul_ps(dz, up_z));
+
+			const __m128 visible   = _mm_cmpgt_ps(depth, near);
+			const __m128 inv_depth = _mm_div_ps(_mm_set1_ps(1.f), _mm_max_ps(depth, near));
+
+			_mm_storeu_ps(screen_x + i, _mm_add_ps(half, _mm_mul_ps(_mm_mul_ps(cam_x, inv_depth), half_x)));
+			_mm_storeu_ps(screen_y + i, _mm_add_ps(half, _mm_mul_ps(_mm_mul_ps(cam_y, inv_depth), half_y)));
+
+			const int mask  = _mm_movemask_ps(visible);
+			in_front[i]     = mask & 1;
+			in_front[i + 1] = (mask >> 1) & 1;
+			in_front[i + 2] = (mask >> 2) & 1;
+			in_front[i + 3] = (mask >> 3) & 1;
+		}
+
+		for (; i < count; i++)
+		{
+			const float dx = x[i] - cam.position.x;
+			const float dy = y[i] - cam.position.y;
+			const float dz = z[i] - cam.position.z;
+
+			const float depth = dx * cam.forward.x + dy * cam.forward.y + dz * cam.forward.z;
+			const float cam_x = dx * cam.right.x + dy * cam.right.y + dz * cam.right.z;
+			const float cam_y = dx * cam.up.x + dy * cam.up.y + dz * cam.up.z;
+
+			const float inv_depth = 1.f / (depth > near_plane ? depth : near_plane);
+
+			screen_x[i] = 0.5f + cam_x * inv_depth * 0.5f * cam.x_scale;
+			screen_y[i] = 0.5f - cam_y * inv_depth * 0.5f * cam.y_scale;
+			in_front[i] = depth > near_plane;
+		}
+	}
+}
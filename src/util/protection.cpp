@@ -1,4 +1,6 @@
 #include "protection.hpp"
+#include "core/enums.hpp"
+#include "gta/enums.hpp"
 #include "model_info.hpp"
 #include "scripts.hpp"
 
@@ -130,4 +132,48 @@ namespace big::protection
 
 		return true;
 	}
+
+	script_event_verdict check_script_event_args(const std::int64_t* args)
+	{
+		switch (static_cast<eRemoteEvent>(args[0]))
+		{
+		case eRemoteEvent::Crash: return {"crash", &g.reactions.crash};
+		case eRemoteEvent::Crash2:
+			if (args[3] > 32) // actual crash condition is if args[2] is above 255
+				return {"crash", &g.reactions.crash};
+			break;
+		case eRemoteEvent::Crash3:
+			if (isnan(*(float*)&args[3]) || isnan(*(float*)&args[4]) || isnan(*(float*)&args[5]))
+				return {"crash", &g.reactions.crash, Infraction::TRIED_CRASH_PLAYER};
+			if (args[3] == -4640169 && args[7] == -36565476 && args[8] == -53105203)
+				return {"crash", &g.reactions.crash, Infraction::TRIED_CRASH_PLAYER};
+			break;
+		case eRemoteEvent::Notification:
+			if (static_cast<eRemoteEvent>(args[3]) == eRemoteEvent::NotificationCrash1) // this isn't used by the game
+				return {"crash notification", nullptr, Infraction::TRIED_CRASH_PLAYER}; // stand user detected
+			break;
+		case eRemoteEvent::MCTeleport:
+			if (args[4] > 32)
+				return {"crash", &g.reactions.crash};
+			break;
+		case eRemoteEvent::TransactionError: return {"transaction error", &g.reactions.transaction_error};
+		case eRemoteEvent::NetworkBail: return {"network bail", &g.reactions.kick, Infraction::TRIED_KICK_PLAYER};
+		case eRemoteEvent::StartActivity:
+			if (!g.protections.script_events.start_activity && static_cast<eActivityType>(args[3]) == eActivityType::Tennis)
+				return {"crash", &g.reactions.crash};
+			break;
+		case eRemoteEvent::InteriorControl:
+			if (int interior = (int)args[3]; interior < 0 || interior > 171) // the upper bound will change after an update
+				return {"interior out of bounds", &g.reactions.kick, Infraction::TRIED_KICK_PLAYER};
+			break;
+		case eRemoteEvent::DestroyPersonalVehicle: return {"destroy personal vehicle", &g.reactions.destroy_personal_vehicle};
+		}
+
+		return {};
+	}
+
+	bool is_script_event_sender_mismatch(const std::int64_t* args, int sender)
+	{
+		return *(int*)&args[1] != sender && sender != -1;
+	}
 }
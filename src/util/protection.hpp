@@ -1,4 +1,5 @@
 #pragma once
+#include "core/data/infractions.hpp"
 
 namespace big::protection
 {
@@ -7,4 +8,18 @@ namespace big::protection
 	bool is_crash_vehicle(rage::joaat_t model);
 	bool is_valid_player_model(rage::joaat_t model);
 	bool should_allow_script_launch(int launcher_script);
+
+	struct script_event_verdict
+	{
+		// nullptr if the arguments pass
+		const char* m_reason = nullptr;
+		reaction* m_reaction = nullptr;
+		std::optional<Infraction> m_infraction;
+	};
+
+	// The part of the script event protections that only looks at the arguments, shared with the net capture replay.
+	// args has to hold as many entries as CScriptedGameEvent::m_args.
+	script_event_verdict check_script_event_args(const std::int64_t* args);
+	// pasted menus set args[1] to something other than PLAYER_ID()
+	bool is_script_event_sender_mismatch(const std::int64_t* args, int sender);
 }
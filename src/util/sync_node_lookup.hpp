@@ -0,0 +1,131 @@
+#pragma once
+#include "gta/joaat.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace big
+{
+	struct sync_node_id
+	{
+		rage::joaat_t id;
+		const char* name;
+
+		constexpr sync_node_id()
+		{
+			id   = 0;
+			name = "INVALID NODE ID!";
+		}
+
+		template<size_t N>
+		constexpr sync_node_id(char const (&pp)[N])
+		{
+			id   = rage::constexpr_joaat(pp);
+			name = pp;
+		}
+		// implicit conversion
+		constexpr operator rage::joaat_t() const
+		{
+			return id;
+		}
+	};
+
+	inline constexpr sync_node_id invalid_sync_node{};
+
+	// Sync Node Virtual Function Table address to all sync node identifiers that also have that vft address.
+	// Filled once by sync_node_finder::init and then frozen, the nodes stay sorted by address for iterating
+	// and lookups go through an open addressed index at most half full, so a miss never inserts or rehashes.
+	class sync_node_vft_to_ids
+	{
+	public:
+		using entry = std::pair<uint64_t, sync_node_id>;
+
+		void clear()
+		{
+			m_nodes.clear();
+			m_slots.clear();
+		}
+
+		void reserve(std::size_t count)
+		{
+			m_nodes.reserve(count);
+		}
+
+		void emplace_back(uint64_t addr, const sync_node_id& id)
+		{
+			m_nodes.emplace_back(addr, id);
+		}
+
+		void freeze()
+		{
+			// stable so that the first tree a shared node was found in wins, like it did with the old map
+			std::stable_sort(m_nodes.begin(), m_nodes.end(), [](const auto& a, const auto& b) {
+				return a.first < b.first;
+			});
+			m_nodes.erase(std::unique(m_nodes.begin(),
+			                  m_nodes.end(),
+			                  [](const auto& a, const auto& b) {
+				                  return a.first == b.first;
+			                  }),
+			    m_nodes.end());
+			m_nodes.shrink_to_fit();
+
+			const auto capacity = std::bit_ceil(std::max<std::size_t>(m_nodes.size() * 2, 2));
+			m_shift             = 64 - std::countr_zero(capacity);
+			m_slots.assign(capacity, entry{});
+
+			for (const auto& node : m_nodes)
+			{
+				auto i = slot(node.first);
+				while (m_slots[i].first)
+					i = (i + 1) & (capacity - 1);
+				m_slots[i] = node;
+			}
+		}
+
+		const sync_node_id& find(uintptr_t addr) const
+		{
+			if (m_slots.empty()) [[unlikely]]
+				return invalid_sync_node;
+
+			// an empty slot has address 0, which is never a vftable
+			for (auto i = slot(addr);; i = (i + 1) & (m_slots.size() - 1))
+			{
+				const auto& node = m_slots[i];
+				if (!node.first)
+					return invalid_sync_node;
+				if (node.first == addr)
+					return node.second;
+			}
+		}
+
+		auto begin() const
+		{
+			return m_nodes.begin();
+		}
+
+		auto end() const
+		{
+			return m_nodes.end();
+		}
+
+		std::size_t size() const
+		{
+			return m_nodes.size();
+		}
+
+	private:
+		// fibonacci hashing, the top bits of the product spread the 8 byte aligned addresses over the slots
+		std::size_t slot(uint64_t addr) const
+		{
+			return (addr * 0x9E3779B97F4A7C15) >> m_shift;
+		}
+
+		std::vector<entry> m_nodes;
+		std::vector<entry> m_slots;
+		int m_shift = 63;
+	};
+}
@@ -1,36 +1,10 @@
 #pragma once
 #include "gta/enums.hpp"
 #include "pointers.hpp"
+#include "sync_node_lookup.hpp"
 
 namespace big
 {
-	struct sync_node_id
-	{
-		Hash id;
-		const char* name;
-
-		constexpr sync_node_id()
-		{
-			id   = 0;
-			name = "INVALID NODE ID!";
-		}
-
-		template<size_t N>
-		constexpr sync_node_id(char const (&pp)[N])
-		{
-			id   = rage::constexpr_joaat(pp);
-			name = pp;
-		}
-		// implicit conversion
-		constexpr operator Hash() const
-		{
-			return id;
-		}
-	};
-
-	// Sync Node Virtual Function Table address to all sync node identifiers that also have that vft address.
-	using sync_node_vft_to_ids = std::unordered_map<uint64_t, sync_node_id>;
-
 	// Sync Tree node array index to node identifier.
 	using sync_tree_node_array_index_to_node_id_t = std::vector<sync_node_id>;
 
@@ -522,7 +496,10 @@ namespace big
 			if (!is_initialized()) [[unlikely]]
 				init();
 
-			return finder.sync_trees_sync_node_addr_to_ids[(int)obj_type][addr];
+			if ((size_t)obj_type >= sync_node_finder_t::sync_tree_count) [[unlikely]]
+				return invalid_sync_node;
+
+			return finder.sync_trees_sync_node_addr_to_ids[(int)obj_type].find(addr);
 		}
 
 		static const sync_node_id& find(uintptr_t addr)
@@ -530,10 +507,10 @@ namespace big
 			if (!is_initialized()) [[unlikely]]
 				init();
 
-			return finder.global_node_identifier[addr];
+			return finder.global_node_identifier.find(addr);
 		}
 
-		static sync_node_vft_to_ids& get_object_nodes(eNetObjType obj_type)
+		static const sync_node_vft_to_ids& get_object_nodes(eNetObjType obj_type)
 		{
 			return finder.sync_trees_sync_node_addr_to_ids[(int)obj_type];
 		}
@@ -557,17 +534,25 @@ namespace big
 					throw std::runtime_error("Failed to cache nodes");
 				}
 
+				auto& nodes = finder.sync_trees_sync_node_addr_to_ids[i];
+				nodes.clear();
+				nodes.reserve(tree->m_child_node_count);
+
 				for (int j = 0; j < tree->m_child_node_count; j++)
 				{
 					const uintptr_t addr = (uintptr_t)tree->m_child_nodes[j];
 
 					const sync_node_id node_id = finder.sync_trees_node_array_index_to_node_id[i][j];
 
-					finder.sync_trees_sync_node_addr_to_ids[i][addr] = node_id;
-					finder.global_node_identifier.emplace(addr, node_id);
+					nodes.emplace_back(addr, node_id);
+					finder.global_node_identifier.emplace_back(addr, node_id);
 				}
+
+				nodes.freeze();
 			}
 
+			finder.global_node_identifier.freeze();
+
 			inited = true;
 		}
 	};
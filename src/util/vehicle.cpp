@@ -1,6 +1,7 @@
 #include "vehicle.hpp"
 #include "pools.hpp"
 #include "script_function.hpp"
+#include "services/streaming/model_streaming_service.hpp"
 
 namespace big::vehicle
 {
@@ -166,11 +167,11 @@ namespace big::vehicle
 		if (is_networked && !*g_pointers->m_gta.m_is_session_started)
 			is_networked = false;
 
-		if (entity::request_model(hash))
+		if (auto model = g_model_streaming_service.acquire(hash); model.wait())
 		{
 			auto veh = VEHICLE::CREATE_VEHICLE(hash, location.x, location.y, location.z, heading, is_networked, script_veh, false);
 
-			STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(hash);
+			model.release();
 
 			if (is_networked)
 			{
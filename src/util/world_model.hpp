@@ -2,6 +2,7 @@
 #include "natives.hpp"
 #include "pointers.hpp"
 #include "script.hpp"
+#include "services/streaming/model_streaming_service.hpp"
 
 struct world_model_bypass
 {
@@ -12,7 +13,7 @@ namespace big::world_model
 {
 	inline Object spawn(Hash hash, Vector3 location = Vector3(), bool is_networked = true)
 	{
-		if (entity::request_model(hash))
+		if (auto model = g_model_streaming_service.acquire(hash); model.wait())
 		{
 			world_model_bypass::m_world_model_spawn_bypass->apply();
 
@@ -20,7 +21,7 @@ namespace big::world_model
 
 			world_model_bypass::m_world_model_spawn_bypass->restore();
 
-			STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(hash);
+			model.release();
 
 			return object;
 		}
@@ -20,6 +20,7 @@ namespace big
 			script_events();
 			scripts();
 			threads();
+			telemetry();
 		}
 		ImGui::End();
 	}
@@ -10,6 +10,7 @@ namespace big::debug
 	extern void script_events();
 	extern void scripts();
 	extern void threads();
+	extern void telemetry();
 
 	extern void main();
 }
\ No newline at end of file
@@ -97,7 +97,8 @@ namespace big
 
 			if (ImGui::TreeNode("VIEW_DEBUG_MISC_FUZZER"_T.data()))
 			{
-				ImGui::Checkbox("ENABLED"_T.data(), &g.debug.fuzzer.enabled);
+				if (ImGui::Checkbox("ENABLED"_T.data(), &g.debug.fuzzer.enabled))
+					g_hooking->set_owner_active("fuzzer", g.debug.fuzzer.enabled);
 
 				for (int i = 0; i < net_object_type_strs.size(); i++)
 				{
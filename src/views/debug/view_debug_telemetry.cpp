@@ -0,0 +1,113 @@
+#include "gui/components/components.hpp"
+#include "services/net_capture/net_capture_replay.hpp"
+#include "services/telemetry/telemetry_service.hpp"
+#include "thread_pool.hpp"
+#include "view_debug.hpp"
+
+namespace big
+{
+	void debug::telemetry()
+	{
+		if (ImGui::BeginTabItem("DEBUG_TAB_TELEMETRY"_T.data()))
+		{
+			bool enabled = g_telemetry_service.is_enabled();
+			if (ImGui::Checkbox("VIEW_DEBUG_TELEMETRY_ENABLE"_T.data(), &enabled))
+				g_telemetry_service.set_enabled(enabled);
+
+			ImGui::SameLine();
+			ImGui::Checkbox("VIEW_DEBUG_TELEMETRY_TIME_DETOURS"_T.data(), &g.debug.time_detours);
+			if (ImGui::IsItemHovered())
+				ImGui::SetTooltip("%s", "VIEW_DEBUG_TELEMETRY_TIME_DETOURS_DESC"_T.data());
+
+			ImGui::SameLine();
+			if (components::button("RESET"_T))
+				g_telemetry_service.reset();
+
+			ImGui::SameLine();
+			if (components::button("VIEW_DEBUG_TELEMETRY_EXPORT_CSV"_T))
+			{
+				if (g_telemetry_service.export_csv(g_file_manager.get_project_file("./telemetry.csv").get_path()))
+					g_notification_service.push_success("DEBUG_TAB_TELEMETRY"_T.data(), "VIEW_DEBUG_TELEMETRY_EXPORTED"_T.data());
+			}
+
+			ImGui::SameLine();
+			if (components::button("VIEW_DEBUG_TELEMETRY_EXPORT_BINARY"_T))
+			{
+				if (g_telemetry_service.export_binary(g_file_manager.get_project_file("./telemetry.bin").get_path()))
+					g_notification_service.push_success("DEBUG_TAB_TELEMETRY"_T.data(), "VIEW_DEBUG_TELEMETRY_EXPORTED"_T.data());
+			}
+
+			ImGui::SeparatorText("VIEW_DEBUG_TELEMETRY_NET_CAPTURE"_T.data());
+
+			if (g_net_capture.is_recording())
+			{
+				if (components::button("VIEW_DEBUG_TELEMETRY_STOP_CAPTURE"_T))
+					g_net_capture.stop();
+
+				ImGui::SameLine();
+				ImGui::Text("%llu", g_net_capture.record_count());
+			}
+			else
+			{
+				if (components::button("VIEW_DEBUG_TELEMETRY_START_CAPTURE"_T))
+					g_net_capture.start(g_file_manager.get_project_file("./net_capture.bin").get_path());
+
+				ImGui::SameLine();
+				if (components::button("VIEW_DEBUG_TELEMETRY_REPLAY_CAPTURE"_T))
+				{
+					g_thread_pool->push([] {
+						const auto results = net_capture_replay::run(g_file_manager.get_project_file("./net_capture.bin").get_path());
+						if (results && net_capture_replay::export_csv(*results, g_file_manager.get_project_file("./net_replay.csv").get_path()))
+							g_notification_service.push_success("DEBUG_TAB_TELEMETRY"_T.data(), "VIEW_DEBUG_TELEMETRY_EXPORTED"_T.data());
+						else
+							g_notification_service.push_error("DEBUG_TAB_TELEMETRY"_T.data(), "VIEW_DEBUG_TELEMETRY_REPLAY_FAILED"_T.data());
+					});
+				}
+			}
+
+			ImGui::Separator();
+
+			static char filter[64]{};
+			components::input_text_with_hint("###telemetry_filter", "SEARCH"_T, filter, sizeof(filter));
+
+			if (ImGui::BeginTable("##telemetry", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_ScrollY))
+			{
+				ImGui::TableSetupScrollFreeze(0, 1);
+				ImGui::TableSetupColumn("VIEW_DEBUG_TELEMETRY_PROBE"_T.data());
+				ImGui::TableSetupColumn("VIEW_DEBUG_TELEMETRY_COUNT"_T.data());
+				ImGui::TableSetupColumn("VIEW_DEBUG_TELEMETRY_MEAN"_T.data());
+				ImGui::TableSetupColumn("VIEW_DEBUG_TELEMETRY_P50"_T.data());
+				ImGui::TableSetupColumn("VIEW_DEBUG_TELEMETRY_P99"_T.data());
+				ImGui::TableSetupColumn("VIEW_DEBUG_TELEMETRY_MAX"_T.data());
+				ImGui::TableHeadersRow();
+
+				static std::vector<telemetry_stats> stats_list;
+				g_telemetry_service.collect(stats_list);
+
+				for (const auto& stats : stats_list)
+				{
+					if (filter[0] && stats.m_name.find(filter) == std::string::npos)
+						continue;
+
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(stats.m_name.c_str());
+					ImGui::TableNextColumn();
+					ImGui::Text("%llu", stats.m_count);
+					ImGui::TableNextColumn();
+					ImGui::Text("%.2f", stats.m_total_ns / 1000.0 / stats.m_count);
+					ImGui::TableNextColumn();
+					ImGui::Text("%.2f", stats.m_p50_ns / 1000.0);
+					ImGui::TableNextColumn();
+					ImGui::Text("%.2f", stats.m_p99_ns / 1000.0);
+					ImGui::TableNextColumn();
+					ImGui::Text("%.2f", stats.m_max_ns / 1000.0);
+				}
+
+				ImGui::EndTable();
+			}
+
+			ImGui::EndTabItem();
+		}
+	}
+}
@@ -1,4 +1,6 @@
+#include "core/data/packet_types.hpp"
 #include "gui/components/components.hpp"
+#include "services/packet_log/packet_log.hpp"
 #include "services/players/player_service.hpp"
 #include "view_debug.hpp"
 
@@ -10,9 +12,69 @@ namespace big
 		{
 			static const char* options[]{"OFF"_T.data(), "ALL"_T.data(), "FILTERS"_T.data()};
 			ImGui::Combo("DEBUG_LOG_METRICS"_T.data(), (int*)&g.debug.logs.metric_logs, options, IM_ARRAYSIZE(options));
-			ImGui::Combo("VIEW_DEBUG_LOGS_LOG_PACKETS"_T.data(), (int*)&g.debug.logs.packet_logs, options, IM_ARRAYSIZE(options));
+			if (ImGui::Combo("VIEW_DEBUG_LOGS_LOG_PACKETS"_T.data(), (int*)&g.debug.logs.packet_logs, options, IM_ARRAYSIZE(options)))
+				g_packet_log.update_filter();
 			ImGui::Checkbox("DEBUG_LOG_NATIVE_SCRIPT_HOOKS"_T.data(), &g.debug.logs.script_hook_logs);
 
+			if (ImGui::TreeNode("VIEW_DEBUG_LOGS_PACKET_FILTER"_T.data()))
+			{
+				auto& filter = g.debug.logs.packet_filter;
+				bool changed = false;
+
+				changed |= ImGui::Checkbox("VIEW_DEBUG_LOGS_PACKET_INCOMING"_T.data(), &filter.incoming);
+				ImGui::SameLine();
+				changed |= ImGui::Checkbox("VIEW_DEBUG_LOGS_PACKET_OUTGOING"_T.data(), &filter.outgoing);
+				ImGui::SameLine();
+				changed |= ImGui::Checkbox("VIEW_DEBUG_LOGS_PACKET_UNKNOWN_PLAYERS"_T.data(), &filter.unknown_players);
+
+				if (ImGui::BeginListBox("##packet_filter_players"))
+				{
+					for (const auto& [_, player] : g_player_service->players())
+					{
+						const auto bit = 1u << player->id();
+						bool enabled   = filter.players & bit;
+
+						ImGui::PushID(player->id());
+						if (ImGui::Checkbox(player->get_name(), &enabled))
+						{
+							filter.players = enabled ? filter.players | bit : filter.players & ~bit;
+							changed        = true;
+						}
+						ImGui::PopID();
+					}
+					ImGui::EndListBox();
+				}
+
+				ImGui::SameLine();
+
+				// only used in FILTERS mode
+				if (ImGui::BeginListBox("##packet_filter_types"))
+				{
+					for (const auto& [name, type] : packet_types)
+					{
+						const auto it = std::find(filter.excluded_types.begin(), filter.excluded_types.end(), type);
+						bool enabled  = it == filter.excluded_types.end();
+						if (ImGui::Checkbox(name, &enabled))
+						{
+							if (enabled)
+								filter.excluded_types.erase(it);
+							else
+								filter.excluded_types.push_back(type);
+							changed = true;
+						}
+					}
+					ImGui::EndListBox();
+				}
+
+				if (changed)
+					g_packet_log.update_filter();
+
+				if (const auto dropped = g_packet_log.dropped_count())
+					ImGui::Text("%s: %llu", "VIEW_DEBUG_LOGS_PACKETS_DROPPED"_T.data(), dropped);
+
+				ImGui::TreePop();
+			}
+
 			if (ImGui::TreeNode("DEBUG_LOG_TREE_SCRIPT_EVENT"_T.data()))
 			{
 				ImGui::Checkbox("DEBUG_LOG_SCRIPT_EVENT"_T.data(), &g.debug.logs.script_event.logs);
@@ -1,3 +1,4 @@
+#include "backend/looped_command.hpp"
 #include "core/data/language_codes.hpp"
 #include "pointers.hpp"
 #include "thread_pool.hpp"
@@ -65,6 +66,7 @@ namespace big
 		{
 			g.write_default_config();
 			g.load();
+			g_looped_command_dispatcher.invalidate();
 		}
 	}
 }
@@ -19,14 +19,15 @@ namespace big
 		});
 		if (ImGui::BeginListBox("##xmllist", {300, static_cast<float>(*g_pointers->m_gta.m_resolution_y - 188 - 38 * 4)}))
 		{
-			for (auto& [name, doc] : g_xml_vehicles_service->m_all_xml_vehicles)
+			const auto entries = g_xml_vehicles_service->m_library.entries();
+			for (const auto& entry : *entries)
 			{
-				std::string lower_name = name;
+				std::string lower_name = entry.m_name;
 				std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), tolower);
 				if (lower_name.find(lower_search) != std::string::npos)
 				{
-					components::selectable(name, false, [&doc] {
-						auto handle = g_xml_vehicles_service->spawn_from_xml(doc, self::pos);
+					components::selectable(entry.m_name, false, [name = entry.m_name] {
+						auto handle = g_xml_vehicles_service->spawn_from_xml(name, self::pos);
 						if (g.spawn_vehicle.spawn_inside)
 							vehicle::teleport_into_vehicle(handle);
 					});
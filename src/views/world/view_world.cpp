@@ -1,4 +1,5 @@
 #include "pointers.hpp"
+#include "services/pool_snapshot/pool_snapshot_service.hpp"
 #include "util/entity.hpp"
 #include "util/ped.hpp"
 #include "util/vehicle.hpp"
@@ -151,6 +152,8 @@ namespace big
 							case 3: g_pointers->m_gta.m_delete_vehicle(reinterpret_cast<CVehicle*>(ptr)); break;
 							case 5: g_pointers->m_gta.m_delete_object(reinterpret_cast<CObject*>(ptr), false); break;
 							}
+
+							g_pool_snapshot_service.invalidate();
 						}
 						else
 						{
@@ -12,14 +12,17 @@ namespace big
         });
         if(ImGui::BeginListBox("##xmlmaps", get_listbox_dimensions()))
         {
-            for (auto& [name, xml_map] : g_xml_map_service->m_all_xml_maps)
+            const auto entries = g_xml_map_service->m_library.entries();
+            for (const auto& entry : *entries)
             {
-                if (ImGui::Selectable(name.c_str()))
+                if (ImGui::Selectable(entry.m_name.c_str()))
                 {
-                    g_fiber_pool->queue_job([=, &xml_map] {
-                        g_xml_map_service->spawn_from_xml(xml_map);
+                    g_fiber_pool->queue_job([name = entry.m_name] {
+                        g_xml_map_service->spawn_from_xml(name);
                     });
                 }
+                if (entry.m_entity_count != -1 && ImGui::IsItemHovered())
+                    ImGui::SetTooltip("%s: %d", "VIEW_XML_MAPS_ENTITY_COUNT"_T.data(), entry.m_entity_count);
             }
             ImGui::EndListBox();
         }
@@ -0,0 +1,238 @@
+// Checks the YimMenuCore code that can be verified without the game, run through ctest.
+#include "gta/pool_bits.hpp"
+#include "lua/subscriber_table.hpp"
+#include "services/custom_text/label_filter.hpp"
+#include "services/players/player_slots.hpp"
+#include "util/sync_node_lookup.hpp"
+
+#include <array>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace
+{
+	int failures = 0;
+
+	void check(bool condition, const char* expression, int line)
+	{
+		if (!condition)
+		{
+			std::printf("core_tests.cpp:%d: check failed: %s\n", line, expression);
+			failures++;
+		}
+	}
+
+#define CHECK(expression) check((expression), #expression, __LINE__)
+
+	// the indices a plain per element walk finds, what the pool iterator does
+	std::vector<std::uint32_t> expected_set_bits(const std::vector<std::uint32_t>& words, std::uint32_t size)
+	{
+		std::vector<std::uint32_t> result;
+		for (std::uint32_t i = 0; i < size; i++)
+			if ((words[i >> 5] >> (i & 0x1F)) & 1)
+				result.push_back(i);
+		return result;
+	}
+
+	std::vector<std::uint32_t> expected_clear_high_bits(const std::vector<std::uint8_t>& bytes, std::uint32_t size)
+	{
+		std::vector<std::uint32_t> result;
+		for (std::uint32_t i = 0; i < size; i++)
+			if (!(bytes[i] & 0x80))
+				result.push_back(i);
+		return result;
+	}
+
+	std::vector<std::uint32_t> walk_set_bits(const std::vector<std::uint32_t>& words, std::uint32_t size)
+	{
+		std::vector<std::uint32_t> result;
+		for_each_set_bit(words.data(), size, [&result](std::uint32_t i) {
+			result.push_back(i);
+		});
+		return result;
+	}
+
+	std::vector<std::uint32_t> walk_clear_high_bits(const std::vector<std::uint8_t>& bytes, std::uint32_t size)
+	{
+		std::vector<std::uint32_t> result;
+		for_each_clear_high_bit(bytes.data(), size, [&result](std::uint32_t i) {
+			result.push_back(i);
+		});
+		return result;
+	}
+
+	void test_for_each_set_bit()
+	{
+		CHECK(walk_set_bits({0}, 0).empty());
+		CHECK(walk_set_bits({0}, 32).empty());
+		CHECK((walk_set_bits({0xFFFFFFFF}, 32) == expected_set_bits({0xFFFFFFFF}, 32)));
+		CHECK((walk_set_bits({0x80000001, 0x1}, 33) == std::vector<std::uint32_t>{0, 31, 32}));
+
+		// bits past size in the last word are garbage in the game's arrays and must be ignored
+		CHECK((walk_set_bits({0xFFFFFFFF}, 5) == std::vector<std::uint32_t>{0, 1, 2, 3, 4}));
+		CHECK((walk_set_bits({0x0, 0xF0F0F0F0}, 40) == std::vector<std::uint32_t>{36, 37, 38, 39}));
+
+		std::uint64_t state = 0x9E3779B97F4A7C15;
+		for (std::uint32_t size : {1u, 31u, 32u, 33u, 100u, 1000u, 1024u})
+		{
+			std::vector<std::uint32_t> words((size + 31) / 32);
+			for (auto& word : words)
+			{
+				state ^= state << 13;
+				state ^= state >> 7;
+				state ^= state << 17;
+				word = static_cast<std::uint32_t>(state);
+			}
+
+			CHECK(walk_set_bits(words, size) == expected_set_bits(words, size));
+		}
+	}
+
+	void test_for_each_clear_high_bit()
+	{
+		CHECK(walk_clear_high_bits({}, 0).empty());
+		CHECK((walk_clear_high_bits({0x80, 0x7F, 0xFF, 0x00}, 4) == std::vector<std::uint32_t>{1, 3}));
+
+		// exactly one 16 byte chunk, a chunk plus a tail and a tail shorter than a chunk
+		for (std::uint32_t size : {15u, 16u, 17u, 31u, 32u, 33u, 1000u})
+		{
+			std::vector<std::uint8_t> bytes(size);
+			for (std::uint32_t i = 0; i < size; i++)
+				bytes[i] = static_cast<std::uint8_t>((i * 37 + 11) % 7 < 3 ? 0x80 | i : i & 0x7F);
+
+			CHECK(walk_clear_high_bits(bytes, size) == expected_clear_high_bits(bytes, size));
+		}
+
+		// only the high bit decides, the low bits hold the generation counter of the slot in the game
+		std::vector<std::uint8_t> all_free(48, 0xFF);
+		CHECK(walk_clear_high_bits(all_free, 48).empty());
+		std::vector<std::uint8_t> all_used(48, 0x7F);
+		CHECK(walk_clear_high_bits(all_used, 48).size() == 48);
+	}
+
+	void test_player_slots()
+	{
+		struct fake_player
+		{
+			std::uint32_t m_msg_id;
+		};
+		const auto live_msg_id = [](const fake_player& plyr) {
+			return plyr.m_msg_id;
+		};
+
+		big::player_slots<fake_player, 32> slots;
+		std::array<std::uint32_t, 32> msg_ids{};
+		CHECK(!slots[0]);
+		CHECK(!slots[32]);
+		CHECK(!slots.find(msg_ids, 0u, live_msg_id));
+
+		const auto first  = std::make_shared<fake_player>(fake_player{10});
+		const auto second = std::make_shared<fake_player>(fake_player{20});
+		slots.set(3, first);
+		slots.set(31, second);
+		msg_ids[3]  = 10;
+		msg_ids[31] = 20;
+		CHECK(slots[3] == first);
+		CHECK(slots.find(msg_ids, 20u, live_msg_id) == second);
+		CHECK(!slots.find(msg_ids, 30u, live_msg_id));
+
+		// the key changed after the join, the stale index entry must not match and the new one is found and re-indexed
+		second->m_msg_id = 30;
+		CHECK(!slots.find(msg_ids, 20u, live_msg_id));
+		CHECK(msg_ids[31] == 30);
+		CHECK(slots.find(msg_ids, 30u, live_msg_id) == second);
+
+		slots.erase(3);
+		CHECK(!slots[3]);
+		CHECK(!slots.find(msg_ids, 10u, live_msg_id));
+
+		slots.clear();
+		CHECK(!slots[31]);
+		CHECK(!slots.find(msg_ids, 30u, live_msg_id));
+	}
+
+	void test_label_filter()
+	{
+		static const char labels[] = "RESPAWN_W\0GC_OTR_TMR";
+		const char* respawn        = labels;
+		const char* clowns         = labels + 10;
+		std::map<std::uint32_t, int> overwrites{{rage::constexpr_joaat(respawn), 0}};
+
+		big::label_filter filter;
+		filter.rebuild(overwrites);
+		CHECK(filter.may_be_customized(rage::constexpr_joaat(respawn)));
+
+		// only labels in read-only memory are memoized
+		auto tag = filter.tag(clowns);
+		filter.memoize_miss(clowns, tag);
+		CHECK(!filter.is_memoized_miss(clowns, tag));
+
+		filter.add_read_only_range(reinterpret_cast<std::uintptr_t>(labels), reinterpret_cast<std::uintptr_t>(labels + sizeof(labels)));
+		filter.memoize_miss(clowns, tag);
+		CHECK(filter.is_memoized_miss(clowns, tag));
+
+		// an overwrite added later must not be hidden by the memoized miss
+		overwrites.emplace(rage::constexpr_joaat(clowns), 0);
+		filter.rebuild(overwrites);
+		CHECK(!filter.is_memoized_miss(clowns, filter.tag(clowns)));
+		CHECK(filter.may_be_customized(rage::constexpr_joaat(clowns)));
+	}
+
+	void test_subscriber_table()
+	{
+		int first = 0, second = 0;
+		big::subscriber_table<int, int> table;
+		CHECK(!table.contains(1));
+		CHECK(table.find(1).empty());
+
+		table.add(1, &first);
+		table.add(1, &second);
+		table.add(2, &second);
+		CHECK(table.contains(1));
+		CHECK(!table.contains(3));
+		CHECK(table.find(1).size() == 2 && table.find(1)[0] == &first && table.find(1)[1] == &second);
+		CHECK(table.find(2).size() == 1 && table.find(2)[0] == &second);
+		CHECK(table.find(3).empty());
+	}
+
+	void test_sync_node_lookup()
+	{
+		big::sync_node_vft_to_ids nodes;
+		CHECK(nodes.find(0x1000).id == big::invalid_sync_node.id);
+
+		// neighbouring vftables share slots often enough to exercise the probing
+		for (std::uint64_t i = 1; i <= 200; i++)
+			nodes.emplace_back(0x7FF700000000 + i * 8, big::sync_node_id("CSectorDataNode"));
+		nodes.emplace_back(0x7FF700000000 + 8, big::sync_node_id("CMigrationDataNode"));
+		nodes.freeze();
+
+		CHECK(nodes.size() == 200);
+		for (std::uint64_t i = 1; i <= 200; i++)
+			CHECK(nodes.find(0x7FF700000000 + i * 8).id == rage::constexpr_joaat("CSectorDataNode"));
+
+		// the first tree a shared node was found in wins
+		CHECK(nodes.find(0x7FF700000000 + 8).id == rage::constexpr_joaat("CSectorDataNode"));
+
+		CHECK(nodes.find(0).id == big::invalid_sync_node.id);
+		CHECK(nodes.find(0x7FF700000004).id == big::invalid_sync_node.id);
+		CHECK(nodes.find(0x7FF700000000 + 201 * 8).id == big::invalid_sync_node.id);
+		CHECK(nodes.size() == 200);
+	}
+}
+
+int main()
+{
+	test_for_each_set_bit();
+	test_for_each_clear_high_bit();
+	test_label_filter();
+	test_player_slots();
+	test_subscriber_table();
+	test_sync_node_lookup();
+
+	if (failures)
+		std::printf("%d checks failed\n", failures);
+
+	return failures ? 1 : 0;
+}